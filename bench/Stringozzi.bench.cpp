@@ -0,0 +1,160 @@
+/**
+ * @file Stringozzi.bench.cpp
+ * @brief compares the runtime rule trees with the compiled programs, the
+ * generated parsers and the compile time grammars
+ *
+ * build with the stringozzi.bench target (not part of "all")
+ */
+#define EMBEDDED_SOURCE
+#include "Stringozzi.h"
+#include "Stringozzi.Static.h"
+// GeneratedRequestLine, the same request line rule written by Generate()
+#include "../test/Stringozzi.Generated.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace SPEG;
+using namespace SPEG::Operators;
+
+namespace {
+
+const int ITERATIONS = 1000000;
+
+// the cost per character is reported too when the characters each 
+// operation parses are given
+template <typename __FUNCTION>
+void Measure(const char* name, __FUNCTION function, size_t chars = 0) {
+  size_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++)
+    sink += function();
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  if (chars)
+    printf("%-32s %10.1f ns/op %6.2f ns/char (%zu)\n", name
+          , ns / ITERATIONS, ns / ITERATIONS / chars, sink);
+  else
+    printf("%-32s %10.1f ns/op (%zu)\n", name, ns / ITERATIONS, sink);
+}
+
+}  // namespace
+
+int main() {
+  const char* line = "GET /index.html?page=1&sort=desc HTTP/1.1\r\n";
+  const char* text = "Host: example.org\r\nAccept: */*\r\n"
+        "GET /index.html?page=1&sort=desc HTTP/1.1\r\n";
+
+  Rule tree = +CapitalAlphabet() > Is(' ') > +Out(" \r\n") > Is(' ')
+        > Is("HTTP/") > Digit() > Is('.') > Digit() > Is("\r\n");
+  Rule compiled = Compile(tree);
+  auto fixed = +Static::CapitalAlphabet() > Static::Is(' ')
+        > +Static::Out(" \r\n") > Static::Is(' ') > Static::Is("HTTP/")
+        > Static::Digit() > Static::Is('.') > Static::Digit()
+        > Static::Is("\r\n");
+
+  StringozziA runtime(tree);
+  StringozziA program(compiled);
+  StringozziA automaton(Determinize(tree));
+  StringozziA generated(Rule(new GeneratedRequestLine::Validator()));
+
+  Measure("Test tree", [&] { return runtime.Test(line); });
+  Measure("Test tree limited", [&] {
+    return runtime.Test(line, Utils::Limits::Within(1000, 100000));
+  });
+  Measure("Test compiled", [&] { return program.Test(line); });
+  Measure("Test iterative", [&] {
+    return program.Test(line, SPEG_ITERATIVE);
+  });
+  Measure("Test automaton", [&] { return automaton.Test(line); });
+  Measure("Test generated", [&] {
+    return GeneratedRequestLine::Test(line);
+  });
+  Measure("Test static", [&] { return Static::Test(fixed, line); });
+  Measure("Search tree", [&] {
+    return (size_t)runtime.SearchAndGetPtr(text);
+  });
+  Measure("Search tree limited", [&] {
+    return runtime.Search(text, Utils::Limits::Within(1000, 100000));
+  });
+  Measure("Search compiled", [&] {
+    return (size_t)program.SearchAndGetPtr(text);
+  });
+  Measure("Search iterative", [&] {
+    return (size_t)program.SearchAndGetPtr(text, SPEG_ITERATIVE);
+  });
+  Measure("Search automaton", [&] {
+    return (size_t)automaton.SearchAndGetPtr(text);
+  });
+  Measure("Search generated", [&] {
+    return (size_t)generated.SearchAndGetPtr(text);
+  });
+  Measure("Search static", [&] {
+    return (size_t)Static::Search(fixed, text);
+  });
+
+  // character by character: no span or literal shortcut applies, so the
+  // automaton visits each character once where the others try each choice
+  const char* words = "ab1cd2e3f4g5h6i7j8ab9cd0k1l2m3n4o5p6ab7cd8q9r0s1t2";
+  Rule chars = *((Is("ab") | Is("cd") | Between('e', 'z')) > Digit())
+        > End();
+  StringozziA perChar(chars);
+  StringozziA perCharCompiled(Compile(chars));
+  StringozziA perCharAutomaton(Determinize(chars));
+  Measure("Chars tree", [&] { return perChar.Test(words); }
+        , strlen(words));
+  Measure("Chars compiled", [&] { return perCharCompiled.Test(words); }
+        , strlen(words));
+  Measure("Chars automaton", [&] { return perCharAutomaton.Test(words); }
+        , strlen(words));
+  Measure("Chars tree bytes", [&] {
+    return perChar.Test(words, SPEG_BYTES);
+  }, strlen(words));
+  Measure("Chars compiled bytes", [&] {
+    return perCharCompiled.Test(words, SPEG_BYTES);
+  }, strlen(words));
+
+  // header names are case insensitive
+  string headers;
+  for (int i = 0; i < 16; i++)
+    headers += "Content-Length: 42\r\n";
+  const char* header = headers.c_str();
+  string lowered = headers;
+  for (size_t i = 0; i < lowered.size(); i++)
+    lowered[i] = static_cast<char>(Utils::CharToLower(lowered[i]));
+  Rule name = +(Is("Content-Length") > Is(": ") > +Digit() > Is("\r\n"))
+        > End();
+  StringozziA headerTree(name);
+  StringozziA headerCompiled(Compile(name));
+  Measure("Header tree", [&] { return headerTree.Test(header); }
+        , strlen(header));
+  Measure("Header tree nocase", [&] {
+    return headerTree.Test(lowered.c_str(), SPEG_CASEINSENSITIVE);
+  }, strlen(header));
+  Measure("Header compiled", [&] { return headerCompiled.Test(header); }
+        , strlen(header));
+  Measure("Header compiled nocase", [&] {
+    return headerCompiled.Test(lowered.c_str(), SPEG_CASEINSENSITIVE);
+  }, strlen(header));
+  Measure("Header compiled bytes", [&] {
+    return headerCompiled.Test(header, SPEG_BYTES);
+  }, strlen(header));
+
+  // the letters of the Latin, Greek and Cyrillic scripts, the ranges are
+  // fused into a single class either way
+  const char* letters = "Stringozzi \xCE\xB1\xCE\xB2\xCE\xB3\xCE\xB4 "
+        "\xD0\xB6\xD1\x83\xD0\xBA\xD0\x96 \xC3\x89t\xC3\xA9";
+  Rule chain = +(+(Between('a', 'z') | Between('A', 'Z')
+        | Between(0xC0, 0xD6) | Between(0xD8, 0xF6) | Between(0xF8, 0x24F)
+        | Between(0x391, 0x3A9) | Between(0x3B1, 0x3C9)
+        | Between(0x400, 0x481) | Between(0x48A, 0x52F)) > ~Is(' '))
+        > End();
+  Rule category = +(+Category("L") > ~Is(' ')) > End();
+  StringozziA chainTree(chain);
+  StringozziA categoryTree(category);
+  Measure("Letters ranges", [&] { return chainTree.Test(letters); }
+        , strlen(letters));
+  Measure("Letters category", [&] { return categoryTree.Test(letters); }
+        , strlen(letters));
+  return 0;
+}
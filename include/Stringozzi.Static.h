@@ -0,0 +1,781 @@
+/**
+ * @file Stringozzi.Static.h
+ * @author Osama Salem (usamamsalem@yahoo.com)
+ * @brief  compile time grammars
+ * @version 2.0.0.0
+ * @date 2020-10-25
+ * 
+ * @copyright Copyright (c) Osama Salem 2020
+ * 
+ */
+/*
+MIT License
+
+Copyright (c) 2020 Osama Salem
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @brief Header only front end for grammars fixed at build time. The
+ * operators build expression template types instead of validator trees,
+ * so the compiler inlines the whole grammar into one function specialized
+ * on the character type and the flags. It accepts the vocabulary of the
+ * Operators namespace and matches the same way, i.e.
+ *
+ *   using namespace SPEG::Static;
+ *   auto version = Is("HTTP/") > Digit() > Is('.') > Digit();
+ *   SPEG::Static::Test<SPEG_CASEINSENSITIVE>(version, "http/1.1");
+ *
+ * The rules only validate and search, there are no matches, callbacks,
+ * variables or references (recursive rules need the runtime tree)
+ */
+
+
+#ifndef INCLUDE_STRINGOZZI_STATIC_H_
+#define INCLUDE_STRINGOZZI_STATIC_H_
+
+#include "Stringozzi.h"
+
+#ifdef CX11_SUPPORTED
+
+#include <type_traits>
+
+namespace SPEG {
+namespace Static {
+
+/**
+ * @brief the decoding of the character types, UTF-8 for char and the 
+ * code units for the others, as the runtime Context reads them
+ *
+ * @tparam __CHARTYPE character type
+ */
+template <typename __CHARTYPE>
+struct Encoding {
+  static SChar Get(const __CHARTYPE* ptr) {
+    return static_cast<SChar>(*ptr);
+  }
+
+  static size_t Length(const __CHARTYPE* /* ptr */) {
+    return 1;
+  }
+
+  static bool Continuation(const __CHARTYPE* /* ptr */) {
+    return false;
+  }
+};
+
+template <>
+struct Encoding<char> {
+  static SChar Get(const char* ptr) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(ptr);
+    if (bytes[0] < 0x80)
+      return bytes[0];
+    if ((bytes[0] & 0xE0) == 0xC0)
+      return ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+    if ((bytes[0] & 0xF0) == 0xE0)
+      return ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6)
+            | (bytes[2] & 0x3F);
+    if ((bytes[0] & 0xF8) == 0xF0)
+      return ((bytes[0] & 0x07) << 18) | ((bytes[1] & 0x3F) << 12)
+            | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+    return 0;
+  }
+
+  static size_t Length(const char* ptr) {
+    unsigned char lead = static_cast<unsigned char>(*ptr);
+    if ((lead & 0xE0) == 0xC0)
+      return 2;
+    if ((lead & 0xF0) == 0xE0)
+      return 3;
+    if ((lead & 0xF8) == 0xF0)
+      return 4;
+    return 1;
+  }
+
+  static bool Continuation(const char* ptr) {
+    return (*ptr & 0xC0) == 0x80;
+  }
+};
+
+/**
+ * @brief the code units as characters (SPEG_BYTES), a byte of a char
+ * text is its Latin-1 character
+ *
+ * @tparam __CHARTYPE character type
+ */
+template <typename __CHARTYPE>
+struct Units {
+  static SChar Get(const __CHARTYPE* ptr) {
+    return static_cast<typename std::make_unsigned<__CHARTYPE>::type>(*ptr);
+  }
+
+  static size_t Length(const __CHARTYPE* /* ptr */) {
+    return 1;
+  }
+
+  static bool Continuation(const __CHARTYPE* /* ptr */) {
+    return false;
+  }
+};
+
+/**
+ * @brief the parsing cursor, the flags are part of the type so the
+ * checks of disabled modes are compiled out
+ *
+ * @tparam __CHARTYPE character type
+ * @tparam __FLAGS SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES and SPEG_BYTES
+ * are supported
+ */
+template <typename __CHARTYPE, unsigned long __FLAGS>
+struct Cursor {
+  typedef typename std::conditional<(__FLAGS & SPEG_BYTES) != 0
+        , Units<__CHARTYPE>, Encoding<__CHARTYPE> >::type Codec;
+
+  const __CHARTYPE* const Begin;
+  const __CHARTYPE* Pointer;
+
+  // as the runtime context, the leading spaces are not part of the text
+  explicit Cursor(const __CHARTYPE* str) : Begin(Skip(str)), Pointer(Begin) {}
+
+  static const __CHARTYPE* Skip(const __CHARTYPE* str) {
+    if (!(__FLAGS & SPEG_IGNORESPACES))
+      return str;
+    while (*str == ' ' || *str == '\t' || *str == '\n' || *str == '\r')
+      str++;
+    return str;
+  }
+
+  static SChar Fold(SChar chr) {
+    if (__FLAGS & SPEG_CASEINSENSITIVE)
+      return Utils::CharToLower(chr);
+    return chr;
+  }
+
+  SChar Get() const {
+    return Fold(Codec::Get(Pointer));
+  }
+
+  bool Forward() {
+    if (!*Pointer)
+      return false;
+    Pointer += Codec::Length(Pointer);
+    return true;
+  }
+
+  bool Backward() {
+    if (Pointer == Begin)
+      return false;
+    do {
+      Pointer--;
+    } while (Pointer != Begin && Codec::Continuation(Pointer));
+    return true;
+  }
+
+  void Adjust() {
+    Pointer = Skip(Pointer);
+  }
+};
+
+/**
+ * @brief the base of all expressions, the operators only accept its
+ * derived types
+ *
+ * @tparam __DERIVED the expression type
+ */
+template <typename __DERIVED>
+struct Expr {
+  const __DERIVED& Self() const {
+    return static_cast<const __DERIVED&>(*this);
+  }
+};
+
+/**
+ * @brief Is(char)
+ *
+ */
+struct CharRule : Expr<CharRule> {
+  SChar Character;
+  explicit CharRule(SChar chr) : Character(chr) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    cursor.Adjust();
+    if (cursor.Get() != __CURSOR::Fold(Character))
+      return false;
+    // Is('\0') matches the end of text without moving
+    cursor.Forward();
+    return true;
+  }
+};
+
+/**
+ * @brief Is("phrase")
+ *
+ */
+template <typename __CHARTYPE>
+struct PhraseRule : Expr<PhraseRule<__CHARTYPE> > {
+  const __CHARTYPE* Phrase;
+  explicit PhraseRule(const __CHARTYPE* phrase) : Phrase(phrase) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    typedef Encoding<__CHARTYPE> Codec;
+    cursor.Adjust();
+    auto start = cursor.Pointer;
+    for (const __CHARTYPE* chr = Phrase; *chr; chr += Codec::Length(chr)) {
+      if (cursor.Get() != __CURSOR::Fold(Codec::Get(chr))) {
+        cursor.Pointer = start;
+        return false;
+      }
+      cursor.Forward();
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief In("set")
+ *
+ */
+template <typename __CHARTYPE>
+struct SetRule : Expr<SetRule<__CHARTYPE> > {
+  const __CHARTYPE* Set;
+  explicit SetRule(const __CHARTYPE* set) : Set(set) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    typedef Encoding<__CHARTYPE> Codec;
+    cursor.Adjust();
+    SChar current = cursor.Get();
+    for (const __CHARTYPE* chr = Set; *chr; chr += Codec::Length(chr)) {
+      if (current == __CURSOR::Fold(Codec::Get(chr))) {
+        cursor.Forward();
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Between(min, max)
+ *
+ */
+struct RangeRule : Expr<RangeRule> {
+  SChar Min;
+  SChar Max;
+  RangeRule(SChar min, SChar max) : Min(min), Max(max) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    cursor.Adjust();
+    SChar current = cursor.Get();
+    return current >= __CURSOR::Fold(Min) && current <= __CURSOR::Fold(Max)
+          && cursor.Forward();
+  }
+};
+
+/**
+ * @brief Any()
+ *
+ */
+struct AnyRule : Expr<AnyRule> {
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    return cursor.Forward();
+  }
+};
+
+/**
+ * @brief Beginning()
+ *
+ */
+struct BeginningRule : Expr<BeginningRule> {
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    return cursor.Pointer == cursor.Begin;
+  }
+};
+
+/**
+ * @brief first > second
+ *
+ */
+template <typename __FIRST, typename __SECOND>
+struct SeqRule : Expr<SeqRule<__FIRST, __SECOND> > {
+  __FIRST First;
+  __SECOND Second;
+  SeqRule(const __FIRST& first, const __SECOND& second)
+    : First(first), Second(second) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    if (First.Check(cursor)) {
+      cursor.Adjust();
+      if (Second.Check(cursor))
+        return true;
+    }
+    cursor.Pointer = start;
+    return false;
+  }
+};
+
+/**
+ * @brief first & second, both have to match from the same position
+ *
+ */
+template <typename __FIRST, typename __SECOND>
+struct AndRule : Expr<AndRule<__FIRST, __SECOND> > {
+  __FIRST First;
+  __SECOND Second;
+  AndRule(const __FIRST& first, const __SECOND& second)
+    : First(first), Second(second) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    if (First.Check(cursor)) {
+      auto first = cursor.Pointer;
+      cursor.Pointer = start;
+      if (Second.Check(cursor)) {
+        if (first > cursor.Pointer)
+          cursor.Pointer = first;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief first | second, the first alternative that matches wins
+ *
+ */
+template <typename __FIRST, typename __SECOND>
+struct OrRule : Expr<OrRule<__FIRST, __SECOND> > {
+  __FIRST First;
+  __SECOND Second;
+  OrRule(const __FIRST& first, const __SECOND& second)
+    : First(first), Second(second) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    return First.Check(cursor) || Second.Check(cursor);
+  }
+};
+
+/**
+ * @brief first || second, the longest alternative wins
+ *
+ */
+template <typename __FIRST, typename __SECOND>
+struct GreedyOrRule : Expr<GreedyOrRule<__FIRST, __SECOND> > {
+  __FIRST First;
+  __SECOND Second;
+  GreedyOrRule(const __FIRST& first, const __SECOND& second)
+    : First(first), Second(second) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    bool success = First.Check(cursor);
+    auto first = cursor.Pointer;
+    cursor.Pointer = start;
+    if (Second.Check(cursor))
+      success = true;
+    if (!success)
+      return false;
+    if (first > cursor.Pointer)
+      cursor.Pointer = first;
+    return true;
+  }
+};
+
+/**
+ * @brief !rule
+ *
+ */
+template <typename __OPERAND>
+struct NotRule : Expr<NotRule<__OPERAND> > {
+  __OPERAND Operand;
+  explicit NotRule(const __OPERAND& operand) : Operand(operand) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    if (Operand.Check(cursor)) {
+      cursor.Pointer = start;
+      return false;
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief LookAhead(rule)
+ *
+ */
+template <typename __OPERAND>
+struct LookAheadRule : Expr<LookAheadRule<__OPERAND> > {
+  __OPERAND Operand;
+  explicit LookAheadRule(const __OPERAND& operand) : Operand(operand) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    bool success = Operand.Check(cursor);
+    cursor.Pointer = start;
+    return success;
+  }
+};
+
+/**
+ * @brief LookBack(rule), the rule has to end at the current position
+ *
+ */
+template <typename __OPERAND>
+struct LookBackRule : Expr<LookBackRule<__OPERAND> > {
+  __OPERAND Operand;
+  explicit LookBackRule(const __OPERAND& operand) : Operand(operand) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    while (cursor.Backward()) {
+      auto from = cursor.Pointer;
+      if (Operand.Check(cursor) && cursor.Pointer == start)
+        return true;
+      // a failed operand may have skipped the spaces it began with
+      cursor.Pointer = from;
+    }
+    cursor.Pointer = start;
+    return false;
+  }
+};
+
+/**
+ * @brief Until(rule), moves forward to where the rule matches
+ *
+ */
+template <typename __OPERAND>
+struct UntilRule : Expr<UntilRule<__OPERAND> > {
+  __OPERAND Operand;
+  explicit UntilRule(const __OPERAND& operand) : Operand(operand) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    do {
+      auto before = cursor.Pointer;
+      if (Operand.Check(cursor)) {
+        cursor.Pointer = before;
+        return true;
+      }
+    } while (cursor.Forward());
+    cursor.Pointer = start;
+    return false;
+  }
+};
+
+/**
+ * @brief repetition of the rule from min to max times
+ *
+ */
+template <typename __OPERAND>
+struct RepeatRule : Expr<RepeatRule<__OPERAND> > {
+  __OPERAND Operand;
+  unsigned int Min;
+  unsigned int Max;
+  RepeatRule(const __OPERAND& operand, unsigned int min, unsigned int max)
+    : Operand(operand), Min(min), Max(max) {}
+
+  template <typename __CURSOR>
+  bool Check(__CURSOR& cursor) const {
+    auto start = cursor.Pointer;
+    for (unsigned int counter = 0; counter < Max; counter++) {
+      if (!Operand.Check(cursor)) {
+        if (counter >= Min)
+          break;
+        cursor.Pointer = start;
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Is(char) for all the character types
+ *
+ */
+template <typename __CHARTYPE, typename std::enable_if<
+      std::is_integral<__CHARTYPE>::value, int>::type = 0>
+inline CharRule Is(__CHARTYPE chr) {
+  return CharRule(static_cast<SChar>(chr));
+}
+
+template <typename __CHARTYPE>
+inline PhraseRule<__CHARTYPE> Is(const __CHARTYPE* phrase) {
+  return PhraseRule<__CHARTYPE>(phrase);
+}
+
+template <typename __CHARTYPE>
+inline SetRule<__CHARTYPE> In(const __CHARTYPE* set) {
+  return SetRule<__CHARTYPE>(set);
+}
+
+template <typename __CHARTYPE>
+inline RangeRule Between(__CHARTYPE min, __CHARTYPE max) {
+  return RangeRule(static_cast<SChar>(min), static_cast<SChar>(max));
+}
+
+template <typename __CHARTYPE>
+inline RangeRule Between(const __CHARTYPE* range) {
+  return RangeRule(static_cast<SChar>(range[0])
+        , static_cast<SChar>(range[1]));
+}
+
+template <typename __OPERAND>
+inline NotRule<__OPERAND> Not(const Expr<__OPERAND>& rule) {
+  return NotRule<__OPERAND>(rule.Self());
+}
+
+template <typename __OPERAND>
+inline LookAheadRule<__OPERAND> LookAhead(const Expr<__OPERAND>& rule) {
+  return LookAheadRule<__OPERAND>(rule.Self());
+}
+
+template <typename __OPERAND>
+inline LookBackRule<__OPERAND> LookBack(const Expr<__OPERAND>& rule) {
+  return LookBackRule<__OPERAND>(rule.Self());
+}
+
+template <typename __OPERAND>
+inline UntilRule<__OPERAND> Until(const Expr<__OPERAND>& rule) {
+  return UntilRule<__OPERAND>(rule.Self());
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> Repeat(const Expr<__OPERAND>& rule
+      , unsigned int min, unsigned int max) {
+  return RepeatRule<__OPERAND>(rule.Self(), min, max);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> ZeroOrMore(const Expr<__OPERAND>& rule) {
+  return Repeat(rule, 0, -1);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> OneOrMore(const Expr<__OPERAND>& rule) {
+  return Repeat(rule, 1, -1);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> Optional(const Expr<__OPERAND>& rule) {
+  return Repeat(rule, 0, 1);
+}
+
+template <typename __FIRST, typename __SECOND>
+inline SeqRule<__FIRST, __SECOND> operator > (const Expr<__FIRST>& first
+      , const Expr<__SECOND>& second) {
+  return SeqRule<__FIRST, __SECOND>(first.Self(), second.Self());
+}
+
+template <typename __FIRST, typename __SECOND>
+inline AndRule<__FIRST, __SECOND> operator & (const Expr<__FIRST>& first
+      , const Expr<__SECOND>& second) {
+  return AndRule<__FIRST, __SECOND>(first.Self(), second.Self());
+}
+
+template <typename __FIRST, typename __SECOND>
+inline OrRule<__FIRST, __SECOND> operator | (const Expr<__FIRST>& first
+      , const Expr<__SECOND>& second) {
+  return OrRule<__FIRST, __SECOND>(first.Self(), second.Self());
+}
+
+template <typename __FIRST, typename __SECOND>
+inline GreedyOrRule<__FIRST, __SECOND> operator || (
+      const Expr<__FIRST>& first, const Expr<__SECOND>& second) {
+  return GreedyOrRule<__FIRST, __SECOND>(first.Self(), second.Self());
+}
+
+template <typename __OPERAND>
+inline NotRule<__OPERAND> operator ! (const Expr<__OPERAND>& rule) {
+  return Not(rule);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator * (const Expr<__OPERAND>& rule) {
+  return ZeroOrMore(rule);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator + (const Expr<__OPERAND>& rule) {
+  return OneOrMore(rule);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator ~ (const Expr<__OPERAND>& rule) {
+  return Optional(rule);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator * (unsigned int num
+      , const Expr<__OPERAND>& rule) {
+  return Repeat(rule, num, num);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator * (const Expr<__OPERAND>& rule
+      , unsigned int num) {
+  return Repeat(rule, num, num);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator + (unsigned int num
+      , const Expr<__OPERAND>& rule) {
+  return Repeat(rule, 1, num);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator + (const Expr<__OPERAND>& rule
+      , unsigned int num) {
+  return Repeat(rule, 1, num);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator * (const Utils::Range& range
+      , const Expr<__OPERAND>& rule) {
+  return Repeat(rule, range.MIN, range.MAX);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<__OPERAND> operator * (const Expr<__OPERAND>& rule
+      , const Utils::Range& range) {
+  return Repeat(rule, range.MIN, range.MAX);
+}
+
+// the builtins have the same definitions as in the Operators namespace
+#define SPEG_STATIC_BUILTIN(__NAME, __RULE) \
+  inline auto __NAME() -> decltype(__RULE) { return __RULE; }
+
+SPEG_STATIC_BUILTIN(Any, AnyRule())
+SPEG_STATIC_BUILTIN(Beginning, BeginningRule())
+SPEG_STATIC_BUILTIN(End, Is('\0'))
+SPEG_STATIC_BUILTIN(Digit, Between("09"))
+SPEG_STATIC_BUILTIN(SmallAlphabet, Between("az"))
+SPEG_STATIC_BUILTIN(CapitalAlphabet, Between("AZ"))
+SPEG_STATIC_BUILTIN(Alphabet, CapitalAlphabet() | SmallAlphabet())
+SPEG_STATIC_BUILTIN(Alphanumeric, Digit() | Alphabet())
+SPEG_STATIC_BUILTIN(Symbol, Any() & !Alphanumeric())
+SPEG_STATIC_BUILTIN(Hex, Digit() | Between("af") | Between("AF"))
+SPEG_STATIC_BUILTIN(Octet, Between("07"))
+SPEG_STATIC_BUILTIN(EndOfLine, Is("\r\n") | In("\n\r"))
+SPEG_STATIC_BUILTIN(WhiteSpace, In(" \t\r\n"))
+SPEG_STATIC_BUILTIN(WhiteSpaces, +WhiteSpace())
+SPEG_STATIC_BUILTIN(Binary, In("01"))
+SPEG_STATIC_BUILTIN(WordEnd, LookAhead(!Alphanumeric()))
+SPEG_STATIC_BUILTIN(WordStart, LookBack(!Alphanumeric()))
+SPEG_STATIC_BUILTIN(Natural, +Digit())
+SPEG_STATIC_BUILTIN(Integer, ~In("+-") > Natural())
+SPEG_STATIC_BUILTIN(Rational, Integer() > ~(Is('.') > Natural()))
+SPEG_STATIC_BUILTIN(Scientific
+      , Rational() > ~(In("Ee") > In("+-") > Natural()))
+SPEG_STATIC_BUILTIN(DecOctet, (Is("25") > Between("05"))
+      | (Is('2') > Between("04") > Digit())
+      | (Is('1') > (2 * Digit()))
+      | (Between("19") > Digit())
+      | Digit())
+SPEG_STATIC_BUILTIN(IPv4, DecOctet() > ((Is('.') > DecOctet()) * 3))
+
+#undef SPEG_STATIC_BUILTIN
+
+template <typename __CHARTYPE>
+inline AndRule<AnyRule, NotRule<SetRule<__CHARTYPE> > > Out(
+      const __CHARTYPE* set) {
+  return Any() & !In(set);
+}
+
+template <typename __OPERAND>
+inline RepeatRule<AndRule<AnyRule, NotRule<__OPERAND> > > SkipTo(
+      const Expr<__OPERAND>& rule) {
+  return ZeroOrMore(Any() & !rule);
+}
+
+/**
+ * @brief validate the text from its beginning, like Actions::Test
+ *
+ * @tparam __FLAGS parsing flags
+ * @param rule the rule
+ * @param str the text
+ * @return true if the rule matches at the beginning of the text
+ * @return false otherwise
+ */
+template <unsigned long __FLAGS = 0, typename __RULE, typename __CHARTYPE>
+inline bool Test(const Expr<__RULE>& rule, const __CHARTYPE* str) {
+  if (!str)
+    return false;
+  Cursor<__CHARTYPE, __FLAGS> cursor(str);
+  return rule.Self().Check(cursor);
+}
+
+/**
+ * @brief validate the text from its beginning and return where the match
+ * ends
+ *
+ * @tparam __FLAGS parsing flags
+ * @param rule the rule
+ * @param str the text
+ * @return const __CHARTYPE* the end of the match, NULL if not matched
+ */
+template <unsigned long __FLAGS = 0, typename __RULE, typename __CHARTYPE>
+inline const __CHARTYPE* Match(const Expr<__RULE>& rule
+      , const __CHARTYPE* str) {
+  if (!str)
+    return NULL;
+  Cursor<__CHARTYPE, __FLAGS> cursor(str);
+  if (!rule.Self().Check(cursor))
+    return NULL;
+  return cursor.Pointer;
+}
+
+/**
+ * @brief search the text for the rule, like Stringozzi::SearchAndGetPtr
+ *
+ * @tparam __FLAGS parsing flags
+ * @param rule the rule
+ * @param str the text
+ * @return const __CHARTYPE* where the first match starts, NULL if not found
+ */
+template <unsigned long __FLAGS = 0, typename __RULE, typename __CHARTYPE>
+inline const __CHARTYPE* Search(const Expr<__RULE>& rule
+      , const __CHARTYPE* str) {
+  if (!str)
+    return NULL;
+  Cursor<__CHARTYPE, __FLAGS> cursor(str);
+  if (!Until(rule).Check(cursor))
+    return NULL;
+  return cursor.Pointer;
+}
+
+}  // namespace Static
+}  // namespace SPEG
+
+#endif  // CX11_SUPPORTED
+#endif  // INCLUDE_STRINGOZZI_STATIC_H_
@@ -44,6 +44,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vector>
 #include <stack>
 
+#include "Stringozzi.CaseFolding.h"
+
 #ifdef __GNUC__
 #include <string.h>
 #include<cstring>
@@ -84,11 +86,25 @@ using namespace std;
 #define CX20_SUPPORTED (1)
 #endif
 
+#ifdef CX17_SUPPORTED
+#include <string_view>
+#endif
+
 
 #ifndef CX20_SUPPORTED
 typedef char char8_t;
 #endif
 
+// a class that can not be derived, so the calls through a pointer of its
+// type are direct
+#ifdef CX11_SUPPORTED
+#define SPEG_FINAL final
+#elif defined(__GNUC__)
+#define SPEG_FINAL __final
+#else
+#define SPEG_FINAL
+#endif
+
 
 /**
  * @brief Shared module attributes
@@ -130,6 +146,7 @@ typedef char char8_t;
 
 
 #define MAXIMUM(a, b) ( ( (a) > (b) ) ? (a) : (b))
+#define MINIMUM(a, b) ( ( (a) < (b) ) ? (a) : (b))
 
 
 
@@ -137,10 +154,53 @@ typedef char char8_t;
 #define MAX_ITER 5000
 #endif
 
+#ifndef SPEG_MEMO_LIMIT
+#define SPEG_MEMO_LIMIT 65536
+#endif
+
+// the states a lazily built automaton may have, it falls back to the tree
+// once the cache is full
+#ifndef SPEG_DFA_STATES
+#define SPEG_DFA_STATES 4096
+#endif
+
+// the positions a state of an automaton may remember
+#ifndef SPEG_DFA_REGISTERS
+#define SPEG_DFA_REGISTERS 64
+#endif
+
+// the steps a budgeted parse takes between two reads of the clock
+#ifndef SPEG_CLOCK_STRIDE
+#define SPEG_CLOCK_STRIDE 1024
+#endif
+
+#ifndef SPEG_SKIP_MIN
+#define SPEG_SKIP_MIN 4
+#endif
+
+#ifndef SPEG_SCAN_CHUNK
+#define SPEG_SCAN_CHUNK 512
+#endif
+
+// a null character inside a text of known length is read as this code 
+// point, above the Unicode range, as 0 stands for the end of text
+#define SPEG_NUL 0x110000
+
+// the span kernels are selected at runtime from the CPU features, 
+// define SPEG_NO_SIMD to use the portable loop only
+#if !defined(SPEG_NO_SIMD) && defined(__GNUC__) \
+      && (defined(__x86_64__) || defined(__i386__))
+#define SPEG_SIMD
+#endif
+
 #define SPEG_CASEINSENSITIVE (1 << 0)
 #define SPEG_MATCHNAMED (1 << 1)
 #define SPEG_MATCHUNNAMED (1 << 2)
 #define SPEG_IGNORESPACES (1 << 3)
+#define SPEG_MEMOIZE (1 << 4)
+#define SPEG_ITERATIVE (1 << 5)
+#define SPEG_BYTES (1 << 6)
+#define SPEG_VALIDATE (1 << 7)
 
 #define NORMALIZE(__X) ( ((__X) > 0)?(1):( ( (__X) < 0) ?(-1):0))
 #define MATCHES_TOKEN "<MATCHES>"
@@ -168,6 +228,7 @@ namespace SPEG {
  */
 namespace Core {
 class Rule;
+class ContextInterface;
 typedef const void* Position;
 
 }
@@ -178,12 +239,45 @@ typedef const void* Position;
  */
 namespace Utils {
 /**
- * @brief function conerts ASCII UTF32 characters to lower case
+ * @brief the Unicode simple case folding of the character, i.e. its lower
+ * case for nearly all cased characters
+ * 
+ * @param chr the code point
+ * @return SChar 
+ */
+inline SChar FoldCase(SChar chr) {
+  if (chr >= SPEG_FOLDING_LIMIT)
+    return chr;
+  SChar block = FoldingBlocks()[chr >> SPEG_FOLDING_SHIFT];
+  SChar offset = chr & ((1 << SPEG_FOLDING_SHIFT) - 1);
+  return chr + FoldingDeltas()[FoldingIndexes()[
+        (block << SPEG_FOLDING_SHIFT) | offset]];
+}
+
+/**
+ * @brief function conerts UTF32 characters to lower case (case folding)
  * 
- * @param long 
+ * @param chr the character
  * @return SChar 
  */
-DLL_PUBLIC SChar CharToLower(unsigned long);
+inline SChar CharToLower(SChar chr) {
+  if (chr < 0x80) {
+    // a single unsigned comparison, the characters below 'A' wrap around
+    if (chr - 'A' <= 'Z' - 'A')
+      return chr + ('a' - 'A');
+    return chr;
+  }
+  return FoldCase(chr);
+}
+
+/**
+ * @brief the characters converted to lower case, the rules keep it next
+ * to the original characters to match in case insensitive mode 
+ * 
+ * @param chars the characters
+ * @return vector<SChar> 
+ */
+DLL_PUBLIC vector<SChar> Fold(const vector<SChar>& chars);
 
 /**
  * @brief Convert UTF8 char to UTF32 
@@ -201,6 +295,14 @@ DLL_PUBLIC SChar UTF8ToUTF32(const char* ptr);
  */
 DLL_PUBLIC unsigned long UTF8ToUTF32Length(const char* ptr);
 
+/**
+ * @brief Convert UTF32 char to UTF8 
+ * 
+ * @param chr the input char in UTF32
+ * @param out the UTF8 bytes are appended here
+ */
+DLL_PUBLIC void UTF32ToUTF8(SChar chr, string& out);
+
 #ifdef CX11_SUPPORTED
 /**
  * @brief Convert UTF16 char to UTF32 
@@ -232,7 +334,10 @@ inline void Increment(const __T** pointer) {
 
 template<>
 inline void Increment<char>(const char** pointer) {
-  (*pointer) += UTF8ToUTF32Length(*pointer);
+  if (static_cast<unsigned char>(**pointer) < 0x80)
+    (*pointer)++;
+  else
+    (*pointer) += UTF8ToUTF32Length(*pointer);
 }
 
 /**
@@ -264,202 +369,1049 @@ inline SChar GetChar(const __T* pointer) {
 
 template<>
 inline SChar GetChar<char>(const char* pointer) {
+  unsigned char byte = static_cast<unsigned char>(*pointer);
+  if (byte < 0x80)
+    return byte;
   return UTF8ToUTF32(pointer);
 }
 
 /**
- * @brief Cross platform atomic increment the passed variable
+ * @brief Get the UTF32 Char of a text that ends at the end pointer, 0 at 
+ * the end and SPEG_NUL for the null characters before it
  * 
- * @param pnum a pointer to double word string  
+ * @tparam __T char type
+ * @param pointer string pointer
+ * @param end the end of text, NULL if the text is null terminated
+ * @return SChar the output UTF32 char
  */
-DLL_PUBLIC void SafeIncrement(unsigned long* pnum);
+template <typename __T>
+inline SChar GetChar(const __T* pointer, const __T* end) {
+  if (!end)
+    return GetChar(pointer);
+  if (pointer >= end)
+    return 0;
+  SChar chr = GetChar(pointer);
+  return chr ? chr : SPEG_NUL;
+}
+
 /**
- * @brief Cross platform atomic decrement the passed variable
+ * @brief UTF8 version, a sequence cut by the end is read as U+FFFD
  * 
- * @param pnum a pointer to double word string  
  */
-DLL_PUBLIC void SafeDecrement(unsigned long* pnum);
+template<>
+inline SChar GetChar<char>(const char* pointer, const char* end) {
+  if (!end)
+    return GetChar(pointer);
+  if (pointer >= end)
+    return 0;
+  if (!*pointer)
+    return SPEG_NUL;
+  if (UTF8ToUTF32Length(pointer) > static_cast<size_t>(end - pointer))
+    return 0xFFFD;
+  return GetChar(pointer);
+}
+
 /**
- * @brief Cross platform check if zero
+ * @brief Get the code unit as a character (SPEG_BYTES), a byte of a 
+ * char text is its Latin-1 character, the wider types are not decoded
+ * anyway
  * 
- * @param pnum a pointer to double word string  
+ * @tparam __T char type
+ * @param pointer string pointer
+ * @param end the end of text, NULL if the text is null terminated
+ * @return SChar the output UTF32 char
  */
-DLL_PUBLIC bool SafeIfZero(unsigned long* pnum);
+template <typename __T>
+inline SChar GetByte(const __T* pointer, const __T* end) {
+  return GetChar(pointer, end);
+}
 
+template<>
+inline SChar GetByte<char>(const char* pointer, const char* end) {
+  if (end && pointer >= end)
+    return 0;
+  SChar chr = static_cast<unsigned char>(*pointer);
+  return (chr || !end) ? chr : SPEG_NUL;
+}
 
 /**
- * @brief The data structure that hold matches result
+ * @brief Increment the pointer one step, never past the end of text
  * 
- * @tparam __CHARTYPE string pointer header
+ * @tparam __T char type
+ * @param pointer string pointer
+ * @param end the end of text, NULL if the text is null terminated
  */
-template<typename __CHARTYPE>
-class Matches {
- public:
-  /**
-   * @brief Represent a single expression Match
-   * 
-   * @tparam __T 
-   */
-  template<typename __T>
-  struct Match {
-    Match(Core::Position start, Core::Position end)
-    : Start(start)
-    , End(end)
-    , Index(-1) {}
-    Core::Position Start;
-    Core::Position End;
-    int Index;
-  };
+template <typename __T>
+inline void Increment(const __T** pointer, const __T* end) {
+  Increment(pointer);
+  if (end && *pointer > end)
+    *pointer = end;
+}
 
+/**
+ * @brief Get the UTF32 Char of a text checked by ValidateUTF8, the 
+ * sequences are decoded inline with no checks
+ * 
+ * @tparam __T char type
+ * @param pointer string pointer
+ * @param end the end of text, NULL if the text is null terminated
+ * @return SChar the output UTF32 char
+ */
+template <typename __T>
+inline SChar GetValid(const __T* pointer, const __T* end) {
+  return GetChar(pointer, end);
+}
 
- private:
-  typedef Match<__CHARTYPE> MATCH;
-  typedef vector<MATCH>  VECTOR;
-  typedef map<string, VECTOR>  MAP;
-  typedef pair<string, VECTOR>  PAIR;
-  typedef basic_string<__CHARTYPE> STRING;
-  typedef vector<STRING> STRARRAY;
+template<>
+inline SChar GetValid<char>(const char* pointer, const char* end) {
+  if (end && pointer >= end)
+    return 0;
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(
+        pointer);
+  if (bytes[0] < 0x80)
+    return (bytes[0] || !end) ? bytes[0] : SPEG_NUL;
+  if (bytes[0] < 0xE0)
+    return ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+  if (bytes[0] < 0xF0)
+    return ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6)
+          | (bytes[2] & 0x3F);
+  return ((bytes[0] & 0x07) << 18) | ((bytes[1] & 0x3F) << 12)
+        | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+}
 
-  MAP _matchesMap;
-  STRARRAY _matchesStrings;
+/**
+ * @brief Increment the pointer one step over a text checked by 
+ * ValidateUTF8, no sequence crosses its end
+ * 
+ * @tparam __T char type
+ * @param pointer string pointer
+ * @param end the end of text, NULL if the text is null terminated
+ */
+template <typename __T>
+inline void IncrementValid(const __T** pointer, const __T* end) {
+  Increment(pointer, end);
+}
 
- public:
-  /**
-  * @brief Construct a new Matches object
-  * 
-  */
-  Matches() {}
+template<>
+inline void IncrementValid<char>(const char** pointer
+      , const char* /* end */) {
+  unsigned char lead = static_cast<unsigned char>(**pointer);
+  *pointer += (lead < 0x80) ? 1 : (lead < 0xE0) ? 2 : (lead < 0xF0) ? 3 : 4;
+}
 
-  /**
-   * @brief Add a new match 
-   * 
-   * @param key   Match key 
-   * @param start Token's start pointer
-   * @param end   Token's end pointer
-   */
-  inline void Add(const char* key
-        , const Core::Position start
-        , const Core::Position end) {
-    _matchesMap[key].push_back(MATCH(start, end));
+/**
+ * @brief Decode null terminated string into UTF32 characters
+ *
+ * @tparam __T char type
+ * @param str input string
+ * @param out the decoded characters are appended here
+ */
+template <typename __T>
+void Decode(const __T* str, vector<SChar>& out) {
+  while (*str) {
+    out.push_back(GetChar(str));
+    Increment(&str);
   }
+}
 
+/**
+ * @brief a literal in both UTF32 and UTF8 forms, used to skip the text 
+ * quickly to the positions a rule may start at.. it keeps the Horspool
+ * skip tables of both forms, the UTF32 one is indexed by the low byte 
+ * of the character
+ * 
+ */
+struct Literal {
+  vector<SChar> Chars;
+  string Bytes;
+  size_t ByteShift[256];
+  size_t CharShift[256];
 
-  /**
-   * @brief Get a single Match
-   * 
-   * @param key Match name
-   * @param index Match index for multiple occurances (default 0)
-   * @return const __CHARTYPE* a pointer to null terminated string 
-   *                           containing the mtached token
-   */
-  const __CHARTYPE* Get(const char* key, const unsigned int index = 0) {
-    typename MAP::iterator it = _matchesMap.find(key);
-    if (it == _matchesMap.end())
-      return NULL;
-
-
-    VECTOR& vec = it->second;
-    if (index >= vec.size())
-      return NULL;
+  Literal() {}
 
+  explicit Literal(const vector<SChar>& chars) : Chars(chars) {
+    for (size_t i = 0; i < chars.size(); i++)
+      UTF32ToUTF8(chars[i], Bytes);
 
-    MATCH& match = vec.at(index);
-    if (match.Index == -1) {
-      size_t size = static_cast<const __CHARTYPE*>(match.End)
-                - static_cast<const __CHARTYPE*>(match.Start);
-      _matchesStrings.push_back(STRING((__CHARTYPE*)match.Start, size));
-      match.Index = (int)_matchesStrings.size() - 1;
+    for (size_t i = 0; i < 256; i++) {
+      ByteShift[i] = Bytes.size();
+      CharShift[i] = Chars.size();
     }
-
-    return _matchesStrings[match.Index].c_str();
+    for (size_t i = 0; i + 1 < Bytes.size(); i++)
+      ByteShift[static_cast<unsigned char>(Bytes[i])] = Bytes.size() - 1 - i;
+    for (size_t i = 0; i + 1 < Chars.size(); i++)
+      CharShift[Chars[i] & 0xFF] = Chars.size() - 1 - i;
   }
 
-  /**
-   * @brief return the number of keys in the matches table
-   * 
-   * @return size_t  number of keys in the matches table
-   */
-  size_t NumberOfMatches() {
-    return _matchesMap.size();
+  bool Empty() const {
+    return Chars.empty();
   }
+};
 
-  /**
- * @brief return the number of entries for a specific token key
+/**
+ * @brief a set of characters, a bitmap for characters from 0 to 255 and
+ * sorted disjoint ranges for the characters above 255
  * 
- * @param key the input token key  
- * @return int  the number of entries 
  */
-  size_t NumberOfMatches(const char* key) {
-    typename MAP::iterator it = _matchesMap.find(key);
-    if (it == _matchesMap.end())
-      return 0;
+struct CharClass {
+  typedef pair<SChar, SChar> RANGE;
 
-    return it->second.size();
+  unsigned char Bits[32];
+  vector<RANGE> Ranges;
+  // Rows[l] has bit h set when the character h * 16 + l belongs to the 
+  // class, the nibble lookup table of the ASCII part for the span kernels
+  unsigned char Rows[16];
+
+  CharClass() {
+    memset(Bits, 0, sizeof(Bits));
+    memset(Rows, 0, sizeof(Rows));
   }
 
-  /**
-   * @brief Clear all entries in the match table
-   *  
-   */
-  void Clear() {
-    _matchesMap.clear();
-    _matchesStrings.clear();
+  inline bool Contains(SChar chr) const {
+    if (chr < 256)
+      return (Bits[chr >> 3] & (1 << (chr & 7))) != 0;
+
+    size_t low = 0;
+    size_t high = Ranges.size();
+    while (low < high) {
+      size_t mid = (low + high) / 2;
+      if (Ranges[mid].second < chr)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return low < Ranges.size() && Ranges[low].first <= chr;
   }
-};
 
-typedef Matches<char> MatchesA;
-typedef Matches<wchar_t> MatchesW;
+  inline void Add(SChar chr) {
+    AddRange(chr, chr);
+  }
+
+  DLL_PUBLIC void AddRange(SChar min, SChar max);
+  DLL_PUBLIC void Remove(SChar chr);
+  DLL_PUBLIC void Unite(const CharClass& other);
+  DLL_PUBLIC void Intersect(const CharClass& other);
+  DLL_PUBLIC void Subtract(const CharClass& other);
+
+ private:
+  void _Index();
+};
 
 /**
- * @brief Represent a range of numbers used usaully with operators
+ * @brief adds the characters whose case folding is between min and max,
+ * the class then matches the characters of both cases in case insensitive
+ * mode whether the text is folded or not
  * 
+ * @param set the class
+ * @param min the lower bound, folded
+ * @param max the upper bound, folded
  */
-struct Range {
-  /**
-   * @brief Construct a new Range object
-   * 
-   * @param min range's lower bound
-   * @param max range's upper bound
-   */
-  Range(const unsigned int min, const unsigned int max) : MIN(min), MAX(max) {}
-  const unsigned int MIN;
-  const unsigned int MAX;
-};
+DLL_PUBLIC void Unfold(CharClass* set, SChar min, SChar max);
 
 /**
- * @brief Represent configuration flag set
+ * @brief adds the characters whose case folding is the folding of a 
+ * character of the class, the class itself included
  * 
+ * @param set the class
+ * @param chars the characters, not folded
  */
-class Flags {
-  typedef unsigned long FlagSet;
+DLL_PUBLIC void Unfold(CharClass* set, const CharClass& chars);
 
- public:
-  FlagSet _flags;
+/**
+ * @brief moves the pointer over the run of characters that belong to the
+ * class, the end of text is never part of a class
+ * 
+ * @tparam __T char type
+ * @param ptr string pointer, moved after the run
+ * @param set the characters to consume
+ * @param max the maximum number of characters to consume
+ * @return size_t the number of consumed characters
+ */
+template <typename __T>
+inline size_t Span(const __T** ptr, const CharClass& set, size_t max) {
+  size_t count = 0;
+  for (; count < max && **ptr && set.Contains(GetChar(*ptr)); count++)
+    Increment(ptr);
+  return count;
+}
 
-  explicit Flags(FlagSet init) : _flags(init) {}
+template<>
+DLL_PUBLIC size_t Span<char>(const char** ptr, const CharClass& set
+      , size_t max);
 
-  inline void SetFlag(FlagSet flag) {
-    _flags |= flag;
-  }
+/**
+ * @brief Span over a text that ends at the end pointer
+ * 
+ * @tparam __T char type
+ * @param ptr string pointer, moved after the run
+ * @param end the end of text, NULL if the text is null terminated
+ * @param set the characters to consume
+ * @param max the maximum number of characters to consume
+ * @return size_t the number of consumed characters
+ */
+template <typename __T>
+inline size_t Span(const __T** ptr, const __T* end, const CharClass& set
+      , size_t max) {
+  if (!end)
+    return Span(ptr, set, max);
+  size_t count = 0;
+  for (; count < max && *ptr < end && set.Contains(GetChar(*ptr, end))
+        ; count++)
+    Increment(ptr, end);
+  return count;
+}
 
-  inline void ClearFlag(FlagSet flag) {
-    _flags &= ~flag;
-  }
+template<>
+DLL_PUBLIC size_t Span<char>(const char** ptr, const char* end
+      , const CharClass& set, size_t max);
 
-  inline void ToggleFlag(FlagSet flag) {
-    _flags ^= flag;
-  }
+/**
+ * @brief Span over the code units (SPEG_BYTES)
+ * 
+ * @tparam __T char type
+ * @param ptr string pointer, moved after the run
+ * @param end the end of text, NULL if the text is null terminated
+ * @param set the characters to consume
+ * @param max the maximum number of characters to consume
+ * @return size_t the number of consumed characters
+ */
+template <typename __T>
+inline size_t SpanBytes(const __T** ptr, const __T* end
+      , const CharClass& set, size_t max) {
+  return Span(ptr, end, set, max);
+}
 
+template<>
+DLL_PUBLIC size_t SpanBytes<char>(const char** ptr, const char* end
+      , const CharClass& set, size_t max);
 
-  inline void SetFlag(FlagSet flag, bool value) {
-    if (value)
-      SetFlag(flag);
-    else
-      ClearFlag(flag);
+/**
+ * @brief make sure there is no null terminator before the target, the 
+ * checked part of the string is tracked by the end pointer
+ * 
+ * @tparam __T char type
+ * @param end the end of checked part, it is moved forward as needed
+ * @param target the position to be reached
+ * @return true if the target is within the string
+ * @return false otherwise
+ */
+template <typename __T>
+inline bool Reach(const __T** end, const __T* target) {
+  for (; *end < target; (*end)++) {
+    if (!**end)
+      return false;
   }
+  return true;
+}
 
-  inline void SetAllFlags(FlagSet flags) {
-    _flags = flags;
+template<>
+inline bool Reach<char>(const char** end, const char* target) {
+  while (*end < target) {
+    const char* nul = static_cast<const char*>(
+          memchr(*end, 0, SPEG_SCAN_CHUNK));
+    if (nul) {
+      *end = nul;
+      return nul >= target;
+    }
+    *end += SPEG_SCAN_CHUNK;
+  }
+  return true;
+}
+
+/**
+ * @brief Find the first occurance of the literal in null terminated string,
+ * literals of SPEG_SKIP_MIN or more characters are found by Horspool 
+ * algorithm
+ * 
+ * @tparam __T char type
+ * @param str string to be searched
+ * @param literal the literal to be found (should not be empty)
+ * @return const __T* pointer to the occurance or NULL if not found
+ */
+template <typename __T>
+const __T* Find(const __T* str, const Literal& literal) {
+  size_t size = literal.Chars.size();
+  if (size >= SPEG_SKIP_MIN) {
+    const __T* end = str;
+    while (Reach(&end, str + size)) {
+      SChar last = static_cast<SChar>(str[size - 1]);
+      if (last == literal.Chars[size - 1]) {
+        size_t i = 0;
+        while (i + 1 < size && static_cast<SChar>(str[i]) == literal.Chars[i])
+          i++;
+        if (i + 1 == size)
+          return str;
+      }
+      str += literal.CharShift[last & 0xFF];
+    }
+    return NULL;
+  }
+
+  for (; *str; Increment(&str)) {
+    if (GetChar(str) != literal.Chars[0])
+      continue;
+    const __T* ptr = str;
+    size_t i = 0;
+    for (; i < literal.Chars.size() && *ptr; i++, Increment(&ptr)) {
+      if (GetChar(ptr) != literal.Chars[i])
+        break;
+    }
+    if (i == literal.Chars.size())
+      return str;
+  }
+  return NULL;
+}
+
+/**
+ * @brief UTF8 version uses the standard library byte search, it expects
+ * the string to be well formed UTF8
+ * 
+ */
+template<>
+inline const char* Find<char>(const char* str, const Literal& literal) {
+  const char* bytes = literal.Bytes.c_str();
+  size_t size = literal.Bytes.size();
+  if (size >= SPEG_SKIP_MIN) {
+    const char* end = str;
+    unsigned char last = static_cast<unsigned char>(bytes[size - 1]);
+    while (Reach(&end, str + size)) {
+      unsigned char chr = static_cast<unsigned char>(str[size - 1]);
+      if (chr == last && !memcmp(str, bytes, size - 1))
+        return str;
+      str += literal.ByteShift[chr];
+    }
+    return NULL;
+  }
+
+  while ((str = strchr(str, bytes[0])) != NULL) {
+    if (!strncmp(str, bytes, size))
+      return str;
+    str++;
+  }
+  return NULL;
+}
+
+/**
+ * @brief Find the first occurance of the literal in a text that ends at 
+ * the end pointer, the Horspool loop needs no terminator check
+ * 
+ * @tparam __T char type
+ * @param str string to be searched
+ * @param end the end of text, NULL if the text is null terminated
+ * @param literal the literal to be found (should not be empty)
+ * @return const __T* pointer to the occurance or NULL if not found
+ */
+template <typename __T>
+const __T* Find(const __T* str, const __T* end, const Literal& literal) {
+  if (!end)
+    return Find(str, literal);
+  size_t size = literal.Chars.size();
+  if (size >= SPEG_SKIP_MIN) {
+    while (static_cast<size_t>(end - str) >= size) {
+      SChar last = static_cast<SChar>(str[size - 1]);
+      if (last == literal.Chars[size - 1]) {
+        size_t i = 0;
+        while (i + 1 < size && static_cast<SChar>(str[i]) == literal.Chars[i])
+          i++;
+        if (i + 1 == size)
+          return str;
+      }
+      str += literal.CharShift[last & 0xFF];
+    }
+    return NULL;
+  }
+
+  for (; str < end; Increment(&str, end)) {
+    if (GetChar(str, end) != literal.Chars[0])
+      continue;
+    const __T* ptr = str;
+    size_t i = 0;
+    for (; i < literal.Chars.size() && ptr < end; i++, Increment(&ptr, end)) {
+      if (GetChar(ptr, end) != literal.Chars[i])
+        break;
+    }
+    if (i == literal.Chars.size())
+      return str;
+  }
+  return NULL;
+}
+
+template<>
+inline const char* Find<char>(const char* str, const char* end
+      , const Literal& literal) {
+  if (!end)
+    return Find(str, literal);
+  const char* bytes = literal.Bytes.c_str();
+  size_t size = literal.Bytes.size();
+  if (size >= SPEG_SKIP_MIN) {
+    unsigned char last = static_cast<unsigned char>(bytes[size - 1]);
+    while (static_cast<size_t>(end - str) >= size) {
+      unsigned char chr = static_cast<unsigned char>(str[size - 1]);
+      if (chr == last && !memcmp(str, bytes, size - 1))
+        return str;
+      str += literal.ByteShift[chr];
+    }
+    return NULL;
+  }
+
+  while (static_cast<size_t>(end - str) >= size) {
+    str = static_cast<const char*>(memchr(str, bytes[0]
+          , end - str - size + 1));
+    if (!str)
+      return NULL;
+    if (!memcmp(str, bytes, size))
+      return str;
+    str++;
+  }
+  return NULL;
+}
+
+/**
+ * @brief Find the literal in the code units (SPEG_BYTES), the characters
+ * of the literal are sought as single bytes in a char text
+ * 
+ * @tparam __T char type
+ * @param str string to be searched
+ * @param end the end of text, NULL if the text is null terminated
+ * @param literal the literal to be found (should not be empty)
+ * @return const __T* pointer to the occurance or NULL if not found
+ */
+template <typename __T>
+inline const __T* FindBytes(const __T* str, const __T* end
+      , const Literal& literal) {
+  return Find(str, end, literal);
+}
+
+template<>
+inline const char* FindBytes<char>(const char* str, const char* end
+      , const Literal& literal) {
+  // an ASCII literal has the same bytes in both forms
+  if (literal.Bytes.size() == literal.Chars.size())
+    return Find(str, end, literal);
+  const unsigned char* found = Find(
+        reinterpret_cast<const unsigned char*>(str)
+        , reinterpret_cast<const unsigned char*>(end), literal);
+  return reinterpret_cast<const char*>(found);
+}
+
+/**
+ * @brief the text a rule runs on, null terminated when End is NULL, or 
+ * bounded by its length and then it may hold null characters.. the 
+ * pointers, the strings and the string views convert to it
+ * 
+ * @tparam __T char type
+ */
+template <typename __T>
+struct Text {
+  const __T* Begin;
+  const __T* End;
+
+  Text(const __T* str) : Begin(str), End(NULL) {}
+
+  Text(const __T* str, size_t length)
+    : Begin(str ? str : _Empty())
+    , End(Begin + (str ? length : 0)) {}
+
+  Text(const basic_string<__T>& str)
+    : Begin(str.data())
+    , End(str.data() + str.size()) {}
+
+#ifdef CX17_SUPPORTED
+  Text(basic_string_view<__T> str)
+    : Begin(str.data() ? str.data() : _Empty())
+    , End(Begin + str.size()) {}
+#endif
+
+  /**
+   * @brief the rest of the text from a position within it
+   * 
+   */
+  Text From(const __T* position) const {
+    Text text(*this);
+    text.Begin = position;
+    return text;
+  }
+
+  /**
+   * @brief the number of code units from a position within the text to 
+   * its end
+   * 
+   */
+  size_t Length(const __T* position) const {
+    if (End)
+      return End - position;
+    return char_traits<__T>::length(position);
+  }
+
+ private:
+  static const __T* _Empty() {
+    static const __T empty[1] = {0};
+    return empty;
+  }
+};
+
+/**
+ * @brief the text of known length, which may hold null characters
+ * 
+ * @tparam __T char type
+ * @param str the first character
+ * @param length the number of code units
+ * @return Text<__T> 
+ */
+template <typename __T>
+inline Text<__T> Bounded(const __T* str, size_t length) {
+  return Text<__T>(str, length);
+}
+
+/**
+ * @brief the char type of the types that convert to a Text, so the 
+ * actions can take them all
+ * 
+ * @tparam __TEXT text type
+ */
+template <typename __TEXT>
+struct TextTraits;
+
+template <typename __T>
+struct TextTraits<__T*> {
+  typedef __T Char;
+};
+
+template <typename __T>
+struct TextTraits<const __T*> {
+  typedef __T Char;
+};
+
+template <typename __T, size_t __N>
+struct TextTraits<__T[__N]> {
+  typedef __T Char;
+};
+
+template <typename __T>
+struct TextTraits<basic_string<__T> > {
+  typedef __T Char;
+};
+
+template <typename __T>
+struct TextTraits<Text<__T> > {
+  typedef __T Char;
+};
+
+#ifdef CX17_SUPPORTED
+template <typename __T>
+struct TextTraits<basic_string_view<__T> > {
+  typedef __T Char;
+};
+#endif
+
+/**
+ * @brief what ValidateUTF8 found the text to be
+ * 
+ */
+enum TextForm {
+  TF_UNCHECKED = 0,
+  TF_ASCII,
+  TF_UTF8,
+  TF_INVALID
+};
+
+/**
+ * @brief check that the text is well formed UTF8 (no overlong forms, 
+ * surrogates or code points above U+10FFFF), the ASCII runs are skipped 
+ * with SIMD
+ * 
+ * @param str the text
+ * @param end the end of text, NULL if the text is null terminated
+ * @param invalid receives the first byte of the invalid sequence if any
+ * @return TextForm TF_ASCII, TF_UTF8 or TF_INVALID
+ */
+DLL_PUBLIC TextForm ValidateUTF8(const char* str, const char* end = NULL
+      , const char** invalid = NULL);
+
+/**
+ * @brief ValidateUTF8 for the char texts, the others are not checked
+ * 
+ * @tparam __T char type
+ */
+template <typename __T>
+inline TextForm Validate(const __T* /* str */, const __T* /* end */) {
+  return TF_UNCHECKED;
+}
+
+template<>
+inline TextForm Validate<char>(const char* str, const char* end) {
+  return ValidateUTF8(str, end);
+}
+
+/**
+ * @brief Cross platform atomic increment the passed variable
+ * 
+ * @param pnum a pointer to double word string  
+ */
+DLL_PUBLIC void SafeIncrement(unsigned long* pnum);
+/**
+ * @brief Cross platform atomic decrement the passed variable
+ * 
+ * @param pnum a pointer to double word string  
+ */
+DLL_PUBLIC void SafeDecrement(unsigned long* pnum);
+/**
+ * @brief Cross platform check if zero
+ * 
+ * @param pnum a pointer to double word string  
+ */
+DLL_PUBLIC bool SafeIfZero(unsigned long* pnum);
+/**
+ * @brief Cross platform spin lock, wait until the lock is free and take it
+ * 
+ * @param lock a pointer to the lock word, zero when free
+ */
+DLL_PUBLIC void SafeLock(unsigned long* lock);
+/**
+ * @brief Cross platform release of a lock taken by SafeLock
+ * 
+ * @param lock a pointer to the lock word
+ */
+DLL_PUBLIC void SafeUnlock(unsigned long* lock);
+/**
+ * @brief Cross platform store that is seen by other threads only after
+ * every write that precedes it
+ * 
+ * @param slot a pointer to the published word
+ * @param value the value to publish
+ */
+DLL_PUBLIC void SafeStore(volatile long* slot, long value);
+/**
+ * @brief Cross platform load that is followed by the reads of every write
+ * that precedes the SafeStore of the value
+ * 
+ * @param slot a pointer to the published word
+ * @return long the published value
+ */
+DLL_PUBLIC long SafeLoad(volatile long* slot);
+/**
+ * @brief Cross platform monotonic clock
+ * 
+ * @return unsigned long microseconds since an arbitrary point, it wraps 
+ * around so only differences are meaningful
+ */
+DLL_PUBLIC unsigned long Clock();
+
+
+/**
+ * @brief The data structure that hold matches result
+ * 
+ * @tparam __CHARTYPE string pointer header
+ */
+template<typename __CHARTYPE>
+class Matches {
+ public:
+  /**
+   * @brief Represent a single expression Match
+   * 
+   * @tparam __T 
+   */
+  template<typename __T>
+  struct Match {
+    Match(Core::Position start, Core::Position end)
+    : Start(start)
+    , End(end)
+    , Index(-1) {}
+    Core::Position Start;
+    Core::Position End;
+    int Index;
+  };
+
+
+ private:
+  typedef Match<__CHARTYPE> MATCH;
+  typedef vector<MATCH>  VECTOR;
+  typedef map<string, VECTOR>  MAP;
+  typedef pair<string, VECTOR>  PAIR;
+  typedef basic_string<__CHARTYPE> STRING;
+  typedef vector<STRING> STRARRAY;
+
+  MAP _matchesMap;
+  STRARRAY _matchesStrings;
+
+ public:
+  /**
+  * @brief Construct a new Matches object
+  * 
+  */
+  Matches() {}
+
+  /**
+   * @brief Add a new match 
+   * 
+   * @param key   Match key 
+   * @param start Token's start pointer
+   * @param end   Token's end pointer
+   */
+  inline void Add(const char* key
+        , const Core::Position start
+        , const Core::Position end) {
+    _matchesMap[key].push_back(MATCH(start, end));
+  }
+
+
+  /**
+   * @brief Get a single Match
+   * 
+   * @param key Match name
+   * @param index Match index for multiple occurances (default 0)
+   * @return const __CHARTYPE* a pointer to null terminated string 
+   *                           containing the mtached token
+   */
+  const __CHARTYPE* Get(const char* key, const unsigned int index = 0) {
+    typename MAP::iterator it = _matchesMap.find(key);
+    if (it == _matchesMap.end())
+      return NULL;
+
+
+    VECTOR& vec = it->second;
+    if (index >= vec.size())
+      return NULL;
+
+
+    MATCH& match = vec.at(index);
+    if (match.Index == -1) {
+      size_t size = static_cast<const __CHARTYPE*>(match.End)
+                - static_cast<const __CHARTYPE*>(match.Start);
+      _matchesStrings.push_back(STRING((__CHARTYPE*)match.Start, size));
+      match.Index = (int)_matchesStrings.size() - 1;
+    }
+
+    return _matchesStrings[match.Index].c_str();
+  }
+
+  /**
+   * @brief return the number of keys in the matches table
+   * 
+   * @return size_t  number of keys in the matches table
+   */
+  size_t NumberOfMatches() {
+    return _matchesMap.size();
+  }
+
+  /**
+ * @brief return the number of entries for a specific token key
+ * 
+ * @param key the input token key  
+ * @return int  the number of entries 
+ */
+  size_t NumberOfMatches(const char* key) {
+    typename MAP::iterator it = _matchesMap.find(key);
+    if (it == _matchesMap.end())
+      return 0;
+
+    return it->second.size();
+  }
+
+  /**
+   * @brief Clear all entries in the match table
+   *  
+   */
+  void Clear() {
+    _matchesMap.clear();
+    _matchesStrings.clear();
+  }
+};
+
+typedef Matches<char> MatchesA;
+typedef Matches<wchar_t> MatchesW;
+
+/**
+ * @brief Packrat memo table, it keeps the outcome of a validator at a 
+ * position so it is not parsed again .. the matches added while parsing
+ * are recorded with the outcome to be replayed when it is recalled 
+ * 
+ */
+class MemoTable {
+ public:
+  /**
+   * @brief a match recorded while a memoized validator is parsing 
+   * 
+   */
+  struct Record {
+    string Key;
+    Core::Position Start;
+    Core::Position End;
+  };
+
+  /**
+   * @brief the outcome of a validator at a position
+   * 
+   */
+  struct Entry {
+    bool Result;
+    Core::Position End;
+    unsigned long Flags;
+    vector<Record> Records;
+  };
+
+ private:
+  struct Key {
+    const void* Validator;
+    Core::Position Start;
+    unsigned long Flags;
+
+    bool operator<(const Key& other) const {
+      if (Start != other.Start)
+        return Start < other.Start;
+      if (Validator != other.Validator)
+        return Validator < other.Validator;
+      return Flags < other.Flags;
+    }
+  };
+  typedef map<Key, Entry> MAP;
+
+  MAP _entries;
+  vector<Record> _journal;
+  unsigned int _depth;
+
+ public:
+  MemoTable() : _depth(0) {}
+
+  /**
+   * @brief find the outcome of a validator 
+   * 
+   * @param validator the validator (or any unique key)
+   * @param start where the validator started
+   * @param flags the configuration flags it started with
+   * @return const Entry* NULL if it is not memoized
+   */
+  const Entry* Find(const void* validator
+        , Core::Position start
+        , unsigned long flags) const {
+    Key key = { validator, start, flags };
+    MAP::const_iterator it = _entries.find(key);
+    if (it == _entries.end())
+      return NULL;
+    return &it->second;
+  }
+
+  /**
+   * @brief start recording the matches of a validator
+   * 
+   * @return size_t the mark to be passed to Store
+   */
+  size_t Begin() {
+    _depth++;
+    return _journal.size();
+  }
+
+  /**
+   * @brief record a match if any validator is being memoized
+   * 
+   */
+  void Journal(const char* key, Core::Position start, Core::Position end) {
+    if (_depth) {
+      Record rec;
+      rec.Key = key;
+      rec.Start = start;
+      rec.End = end;
+      _journal.push_back(rec);
+    }
+  }
+
+  /**
+   * @brief store the outcome of a validator .. once the table reaches 
+   * SPEG_MEMO_LIMIT entries it is emptied to keep the memory bounded 
+   * 
+   */
+  void Store(const void* validator
+        , Core::Position start
+        , unsigned long flags
+        , size_t mark
+        , bool result
+        , Core::Position end
+        , unsigned long endFlags) {
+    if (_entries.size() >= SPEG_MEMO_LIMIT)
+      _entries.clear();
+
+    Key key = { validator, start, flags };
+    Entry& entry = _entries[key];
+    entry.Result = result;
+    entry.End = end;
+    entry.Flags = endFlags;
+    entry.Records.assign(_journal.begin() + mark, _journal.end());
+
+    if (--_depth == 0)
+      _journal.clear();
+  }
+
+  /**
+   * @brief drop the outcomes of the validators that started before the
+   * position
+   * 
+   * @param position no parsing goes back before it
+   */
+  void Discard(Core::Position position) {
+    Key key = { NULL, position, 0 };
+    _entries.erase(_entries.begin(), _entries.lower_bound(key));
+  }
+
+  /**
+   * @brief number of memoized outcomes
+   * 
+   * @return size_t 
+   */
+  size_t Size() const {
+    return _entries.size();
+  }
+};
+
+/**
+ * @brief Represent a range of numbers used usaully with operators
+ * 
+ */
+struct Range {
+  /**
+   * @brief Construct a new Range object
+   * 
+   * @param min range's lower bound
+   * @param max range's upper bound
+   */
+  Range(const unsigned int min, const unsigned int max) : MIN(min), MAX(max) {}
+  const unsigned int MIN;
+  const unsigned int MAX;
+};
+
+/**
+ * @brief Represent configuration flag set
+ * 
+ */
+class Flags {
+  typedef unsigned long FlagSet;
+
+ public:
+  FlagSet _flags;
+
+  explicit Flags(FlagSet init) : _flags(init) {}
+
+  inline void SetFlag(FlagSet flag) {
+    _flags |= flag;
+  }
+
+  inline void ClearFlag(FlagSet flag) {
+    _flags &= ~flag;
+  }
+
+  inline void ToggleFlag(FlagSet flag) {
+    _flags ^= flag;
+  }
+
+
+  inline void SetFlag(FlagSet flag, bool value) {
+    if (value)
+      SetFlag(flag);
+    else
+      ClearFlag(flag);
+  }
+
+  inline void SetAllFlags(FlagSet flags) {
+    _flags = flags;
   }
 
 
@@ -468,9 +1420,220 @@ class Flags {
     return ((_flags & (flag)) == flag);
   }
 };
+
+/**
+ * @brief The outcome of a parsing call that has limits, ST_INVALID if 
+ * SPEG_VALIDATE found the text not to be well formed UTF8
+ * 
+ */
+enum Status {
+  ST_FAILED = 0,
+  ST_MATCHED,
+  ST_EXCEEDED,
+  ST_INVALID
+};
+
+/**
+ * @brief The work one parsing call may do .. a step is the cursor moving
+ * one character or a repetition that did not move it, so a hostile text 
+ * can not keep a backtracking rule running for long
+ * 
+ */
+struct Limits {
+  /**
+   * @brief No limits
+   * 
+   */
+  Limits() : Steps(0), Deadline(0), Timed(false) {}
+
+  /**
+   * @brief Construct a new Limits object
+   * 
+   * @param steps the maximum number of steps, zero for no limit
+   */
+  explicit Limits(unsigned long steps)
+    : Steps(steps), Deadline(0), Timed(false) {}
+
+  /**
+   * @brief Construct a new Limits object
+   * 
+   * @param steps the maximum number of steps, zero for no limit
+   * @param deadline Clock() value the parsing must not go beyond
+   */
+  Limits(unsigned long steps, unsigned long deadline)
+    : Steps(steps), Deadline(deadline), Timed(true) {}
+
+  /**
+   * @brief limits that expire after the specified time from now
+   * 
+   * @param microseconds the time the parsing may take
+   * @param steps the maximum number of steps, zero for no limit
+   * @return Limits 
+   */
+  static Limits Within(unsigned long microseconds, unsigned long steps = 0) {
+    return Limits(steps, Clock() + microseconds);
+  }
+
+  unsigned long Steps;
+  unsigned long Deadline;
+  bool Timed;
+};
+
+/**
+ * @brief The steps left to a parsing context .. the steps are counted
+ * down in strides so the clock and the limits are only checked once per
+ * stride
+ * 
+ */
+class Budget {
+  unsigned long _left;
+  unsigned long _steps;
+  Limits _limits;
+  bool _exceeded;
+
+  bool _Renew(unsigned long steps) {
+    if (!_exceeded && _limits.Steps) {
+      _exceeded = _steps < steps;
+      _steps -= _exceeded ? _steps : steps;
+    }
+    if (!_exceeded && _limits.Timed)
+      _exceeded = static_cast<long>(Clock() - _limits.Deadline) >= 0;
+    if (_exceeded) {
+      _left = 0;
+      return false;
+    }
+
+    _left = _limits.Timed ? SPEG_CLOCK_STRIDE : ~0UL;
+    if (_limits.Steps) {
+      _left = MINIMUM(_left, _steps);
+      _steps -= _left;
+    }
+    return true;
+  }
+
+ public:
+  /**
+   * @brief Construct an unlimited Budget object
+   * 
+   */
+  Budget()
+    : _left(~0UL)
+    , _steps(0)
+    , _exceeded(false) {}
+
+  /**
+   * @brief Construct a new Budget object
+   * 
+   * @param limits the limits of the parsing call
+   */
+  explicit Budget(const Limits& limits)
+    : _left(limits.Steps || limits.Timed ? 0 : ~0UL)
+    , _steps(limits.Steps)
+    , _limits(limits)
+    , _exceeded(false) {}
+
+  /**
+   * @brief take one step
+   * 
+   * @return true if the limits allow it
+   * @return false otherwise
+   */
+  inline bool Step() {
+    return _left-- ? true : _Renew(1);
+  }
+
+  /**
+   * @brief take a number of steps at once
+   * 
+   * @param steps number of steps
+   * @return true if the limits allow them
+   * @return false otherwise
+   */
+  inline bool Step(unsigned long steps) {
+    if (steps <= _left) {
+      _left -= steps;
+      return true;
+    }
+    steps -= _left;
+    _left = 0;
+    return _Renew(steps);
+  }
+
+  /**
+   * @brief whether the limits were exceeded
+   * 
+   */
+  inline bool Exceeded() const {
+    return _exceeded;
+  }
+};
 }  // namespace Utils
 
+namespace Engine {
+/**
+ * @brief the states, transitions and alphabet of an AutomatonValidator in
+ * one case mode
+ * 
+ */
+struct Automaton;
+
+/**
+ * @brief run the automaton from the parsing cursor through the context
+ * interface
+ * 
+ * @param automaton the automaton of the current case mode
+ * @param context the parsing context
+ * @return int 1 if matched (the cursor is moved to the end of the match),
+ *             0 if not, -1 if the automaton overflowed
+ */
+DLL_PUBLIC int Run(Automaton* automaton, Core::ContextInterface* context);
+
+/**
+ * @brief run the automaton over the text of the context directly
+ * 
+ * @tparam __T char type
+ * @param automaton the automaton of the current case mode
+ * @param context the parsing context
+ * @param pointer the parsing cursor
+ * @param end the end of text, NULL if the text is null terminated
+ * @return int as Run(automaton, context)
+ */
+template <typename __T>
+inline int Run(Automaton* automaton, Core::ContextInterface* context
+      , const __T** /* pointer */, const __T* /* end */) {
+  return Run(automaton, context);
+}
+
+template<>
+DLL_PUBLIC int Run<char>(Automaton* automaton, Core::ContextInterface* context
+      , const char** pointer, const char* end);
+}  // namespace Engine
+
 namespace Core {
+/**
+ * @brief the implementation behind a ContextInterface, the hot paths call
+ * a Context<> directly instead of through the virtual functions
+ * 
+ */
+enum ContextKind {
+  CK_CUSTOM = 0,
+  CK_CHAR,
+  CK_WCHAR
+};
+
+template <typename __T>
+inline ContextKind KindOf(const __T*) {
+  return CK_CUSTOM;
+}
+
+inline ContextKind KindOf(const char*) {
+  return CK_CHAR;
+}
+
+inline ContextKind KindOf(const wchar_t*) {
+  return CK_WCHAR;
+}
+
 /**
  * @brief This is a major interface in parsing process, 
  * this interface class holds the internal parsing context
@@ -479,7 +1642,21 @@ namespace Core {
  * 
  */
 class ContextInterface {
+ protected:
+  ContextKind _kind;
+
  public:
+  ContextInterface() : _kind(CK_CUSTOM) {}
+
+  /**
+   * @brief the implementation behind the interface
+   * 
+   * @return ContextKind 
+   */
+  inline ContextKind Kind() const {
+    return _kind;
+  }
+
  /**
   * @brief Move parsing cursor one step ahead
   * 
@@ -492,7 +1669,7 @@ class ContextInterface {
    * @brief moves the parsing cursor one step backward
    * 
    * @return true if not beginning of text
-   * @return false otherwises
+   * @return false otherwises or once the limits are exceeded
    */
   virtual bool Backward() = 0;
 
@@ -609,24 +1786,218 @@ class ContextInterface {
    * @return Position the new posistion
    */
   virtual Position AdjustPosition() = 0;
+
+  /**
+   * @brief recall the memoized outcome of a validator at the current 
+   * position, on success the cursor, flags and matches are restored as 
+   * if the validator was parsed again
+   * 
+   * @param validator the memoized validator
+   * @param result the memoized result
+   * @return true if memoized
+   * @return false otherwise
+   */
+  virtual bool Recall(const void* /* validator */, bool* /* result */) {
+    return false;
+  }
+
+  /**
+   * @brief start memoizing a validator at the current position
+   * 
+   * @return size_t the mark to be passed to Memorize
+   */
+  virtual size_t BeginMemo() {
+    return 0;
+  }
+
+  /**
+   * @brief memoize the outcome of a validator
+   * 
+   * @param validator the memoized validator
+   * @param start where the validator started 
+   * @param flags the flags it started with
+   * @param mark the mark returned by BeginMemo
+   * @param result the validator's result
+   */
+  virtual void Memorize(const void* /* validator */
+        , Position /* start */
+        , unsigned long /* flags */
+        , size_t /* mark */
+        , bool /* result */) {}
+
+  /**
+   * @brief open the scope of a choice alternative, a Commit() passed 
+   * inside it stops the choice from trying the alternatives after it
+   * 
+   * @return unsigned int the state to be passed to EndCut
+   */
+  virtual unsigned int BeginCut() {
+    return 0;
+  }
+
+  /**
+   * @brief close the scope opened by BeginCut
+   * 
+   * @param state the state returned by BeginCut
+   * @return true if a Commit() was passed in the scope
+   * @return false otherwise
+   */
+  virtual bool EndCut(unsigned int /* state */) {
+    return false;
+  }
+
+  /**
+   * @brief pass a cut point, it cuts the innermost open scope, outside
+   * any scope the parsing never goes back before the cursor so the 
+   * memoized outcomes before it are dropped
+   * 
+   */
+  virtual void Commit() {}
+
+  /**
+   * @brief move the parsing cursor to the next occurance of the literal
+   * (case sensitive), the cursor is not moved if it is already there
+   * 
+   * @param literal the literal to be found
+   * @return true if found 
+   * @return false otherwise
+   */
+  virtual bool Seek(const Utils::Literal& /* literal */) {
+    return true;
+  }
+
+  /**
+   * @brief moves the parsing cursor over the run of characters that 
+   * belong to the class
+   * 
+   * @param set the class of the current case mode
+   * @param max the maximum number of characters to consume
+   * @return size_t the number of consumed characters
+   */
+  virtual size_t Span(const Utils::CharClass& set, size_t max) {
+    size_t count = 0;
+    for (; count < max && Get() && set.Contains(Get()); count++)
+      Forward();
+    return count;
+  }
+
+  /**
+   * @brief moves the parsing cursor over a phrase of ASCII characters, 
+   * compared in the case mode of the context
+   * 
+   * @param phrase the phrase, all of its characters are below 0x80
+   * @param size the number of characters of the phrase
+   * @return true if the text goes on with the phrase
+   * @return false otherwise, the cursor is not moved then
+   */
+  virtual bool Skip(const char* phrase, size_t size) {
+    Position start = GetPosition();
+    for (size_t i = 0; i < size; i++) {
+      if (Compare(static_cast<unsigned char>(phrase[i]))) {
+        SetPosition(start);
+        return false;
+      }
+      Forward();
+    }
+    return true;
+  }
+
+  /**
+   * @brief run a lazily built automaton from the parsing cursor
+   * 
+   * @param automaton the automaton of the current case mode
+   * @return int 1 if matched (the cursor is moved to the end of the 
+   *             match), 0 if not, -1 if the automaton overflowed
+   */
+  virtual int Run(Engine::Automaton* automaton) {
+    return Engine::Run(automaton, this);
+  }
+
+  /**
+   * @brief account a step that did not move the parsing cursor, like a 
+   * repetition of an empty match
+   * 
+   * @return true if the parsing may go on
+   * @return false if the limits of the context are exceeded
+   */
+  virtual bool Step() {
+    return true;
+  }
 };
 
 
+/**
+ * @brief the parsing context over a string, it can not be derived so the
+ * validators that know they run on it call it directly
+ * 
+ * @tparam __CHARTYPE character type
+ */
 template<typename __CHARTYPE>
-class Context : public ContextInterface {
+class Context SPEG_FINAL : public ContextInterface {
   typedef basic_string<__CHARTYPE> STRING;
   typedef map<string, string>  MAP;
   typedef pair<string, string>  PAIR;
 
   const __CHARTYPE* _pointer;
   const __CHARTYPE* _string;
+  // the end of a text of known length, NULL if it is null terminated
+  const __CHARTYPE* _end;
   Utils::Flags _flags;
+  Utils::TextForm _form;
   Utils::Matches<__CHARTYPE> _matches;
+  Utils::MemoTable _memo;
   MAP _vars;
+  Utils::Budget _budget;
+  __CHARTYPE _halt;
+  unsigned int _cut;
+  unsigned int _scopes;
+
+  // once the limits are exceeded the cursor is parked on an empty text
+  // so every validator fails or matches nothing till the call returns
+  inline void _Halt() {
+    _pointer = _end ? _end : &_halt;
+  }
+
+  // a code unit is a character in SPEG_BYTES mode
+  inline bool _Bytes() {
+    return _flags.IsFlagSet(SPEG_BYTES);
+  }
+
+  inline SChar _Char() {
+    if (_Bytes())
+      return Utils::GetByte(_pointer, _end);
+    if (_form == Utils::TF_UTF8)
+      return Utils::GetValid(_pointer, _end);
+    return Utils::GetChar(_pointer, _end);
+  }
+
+  // SPEG_VALIDATE checks the text once, an ASCII text is then read byte
+  // by byte and a valid one with no checks.. nothing of an invalid text
+  // is parsed
+  inline void _Validate() {
+    _form = Utils::Validate(_pointer, _end);
+    if (_form == Utils::TF_ASCII)
+      _flags.SetFlag(SPEG_BYTES);
+    else if (_form == Utils::TF_INVALID)
+      _Halt();
+  }
 
   inline SChar _Get() {
-    SChar chr = Utils::GetChar(_pointer);
-    return _Get(chr);
+    return _Get(_Char());
+  }
+
+  // Skip() in case insensitive mode once a character beyond ASCII is met
+  bool _SkipFolded(const char* phrase, size_t size) {
+    const __CHARTYPE* start = _pointer;
+    for (size_t i = 0; i < size; i++) {
+      if (_Get() != Utils::CharToLower(
+            static_cast<unsigned char>(phrase[i]))) {
+        _pointer = start;
+        return false;
+      }
+      Forward();
+    }
+    return true;
   }
 
   inline SChar _Get(SChar chr) {
@@ -637,21 +2008,64 @@ class Context : public ContextInterface {
 
  public:
   virtual SChar Get() {
-    SChar chr = Utils::GetChar(_pointer);
-    return _Get(chr);
+    return _Get(_Char());
   }
 
   Utils::Matches<__CHARTYPE>  Matches() {
     return _matches;
   }
 
-  explicit Context(const __CHARTYPE* str, unsigned long flags)
-    : _pointer(str)
-    , _flags(flags) {
+  explicit Context(const Utils::Text<__CHARTYPE>& text, unsigned long flags
+        , const Utils::Budget& budget = Utils::Budget())
+    : _pointer(text.Begin)
+    , _end(text.End)
+    , _flags(flags)
+    , _form(Utils::TF_UNCHECKED)
+    , _budget(budget)
+    , _halt(0)
+    , _cut(0)
+    , _scopes(0) {
+    _kind = KindOf(text.Begin);
+    if (_flags.IsFlagSet(SPEG_VALIDATE) && !_Bytes())
+      _Validate();
     AdjustPosition();
     _string = _pointer;
   }
 
+  /**
+   * @brief the steps left to the context
+   * 
+   * @return const Utils::Budget& 
+   */
+  const Utils::Budget& Remaining() const {
+    return _budget;
+  }
+
+  /**
+   * @brief whether the parsing stopped because the limits were exceeded
+   * 
+   */
+  inline bool Exceeded() const {
+    return _budget.Exceeded();
+  }
+
+  /**
+   * @brief whether SPEG_VALIDATE found the text not to be well formed 
+   * UTF8, nothing of it is parsed then
+   * 
+   */
+  inline bool Invalid() const {
+    return _form == Utils::TF_INVALID;
+  }
+
+  /**
+   * @brief the number of memoized outcomes (SPEG_MEMOIZE)
+   * 
+   */
+  size_t Memoized() const {
+    return _memo.Size();
+  }
+
 
   virtual Position AdjustPosition() {
     if (_flags.IsFlagSet(SPEG_IGNORESPACES)) {
@@ -670,16 +2084,29 @@ class Context : public ContextInterface {
 
   inline bool Forward() {
     if (!EOT()) {
-      Utils::Increment(&_pointer);
+      if (!_budget.Step()) {
+        _Halt();
+        return false;
+      }
+      if (_Bytes())
+        _pointer++;
+      else if (_form == Utils::TF_UTF8)
+        Utils::IncrementValid(&_pointer, _end);
+      else
+        Utils::Increment(&_pointer, _end);
       return true;
     }
     return false;
   }
 
 
+  // the halted cursor may be out of the text, so it is never moved back
   inline bool Backward() {
-    if (!BOT()) {
-      Utils::Decrement(&_pointer);
+    if (!BOT() && !Exceeded()) {
+      if (_Bytes())
+        _pointer--;
+      else
+        Utils::Decrement(&_pointer);
       return true;
     }
     return false;
@@ -690,6 +2117,8 @@ class Context : public ContextInterface {
   }
 
   inline bool EOT() {
+    if (_end)
+      return _pointer >= _end;
     return !*_pointer;
   }
 
@@ -722,143 +2151,666 @@ class Context : public ContextInterface {
   }
 
   inline void AddMatch(const char* key, Position start) {
-    if (_flags.IsFlagSet(SPEG_MATCHNAMED)) {
+    if (_flags.IsFlagSet(SPEG_MATCHNAMED) && !Exceeded()) {
       _matches.Add(key, start, GetPosition());
+      _memo.Journal(key, start, GetPosition());
     }
   }
 
   inline void AddMatch(Position start) {
-    if (_flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    if (_flags.IsFlagSet(SPEG_MATCHUNNAMED) && !Exceeded()) {
       if (GetPosition() > start) {
         _matches.Add(MATCHES_TOKEN, start, GetPosition());
+        _memo.Journal(MATCHES_TOKEN, start, GetPosition());
       }
     }
   }
 
+  virtual bool Recall(const void* validator, bool* result) {
+    if (Exceeded())
+      return false;
+    const Utils::MemoTable::Entry* entry =
+          _memo.Find(validator, _pointer, _flags._flags);
+    if (!entry)
+      return false;
+
+    for (size_t i = 0; i < entry->Records.size(); i++) {
+      const Utils::MemoTable::Record& rec = entry->Records[i];
+      _matches.Add(rec.Key.c_str(), rec.Start, rec.End);
+      _memo.Journal(rec.Key.c_str(), rec.Start, rec.End);
+    }
+    SetPosition(entry->End);
+    _flags.SetAllFlags(entry->Flags);
+    *result = entry->Result;
+    return true;
+  }
+
+  virtual size_t BeginMemo() {
+    return _memo.Begin();
+  }
+
+  virtual void Memorize(const void* validator
+        , Position start
+        , unsigned long flags
+        , size_t mark
+        , bool result) {
+    _memo.Store(validator, start, flags, mark, result
+          , _pointer, _flags._flags);
+  }
+
+  virtual unsigned int BeginCut() {
+    unsigned int state = _cut;
+    _cut = 0;
+    _scopes++;
+    return state;
+  }
+
+  virtual bool EndCut(unsigned int state) {
+    bool cut = _cut != 0;
+    _cut = state;
+    _scopes--;
+    return cut;
+  }
+
+  virtual void Commit() {
+    if (_scopes)
+      _cut = 1;
+    else
+      _memo.Discard(_pointer);
+  }
+
+  virtual bool Seek(const Utils::Literal& literal) {
+    if (Exceeded())
+      return false;
+    const __CHARTYPE* found = _Bytes()
+          ? Utils::FindBytes(_pointer, _end, literal)
+          : Utils::Find(_pointer, _end, literal);
+    if (!found)
+      return false;
+    if (!_budget.Step(static_cast<unsigned long>(found - _pointer))) {
+      _Halt();
+      return false;
+    }
+    _pointer = found;
+    return true;
+  }
+
+  virtual size_t Span(const Utils::CharClass& set, size_t max) {
+    if (Exceeded())
+      return 0;
+    size_t count = _Bytes() ? Utils::SpanBytes(&_pointer, _end, set, max)
+          : Utils::Span(&_pointer, _end, set, max);
+    if (!_budget.Step(static_cast<unsigned long>(count)))
+      _Halt();
+    return count;
+  }
+
+  // a code unit below 0x80 is the character itself in every text form, 
+  // so the case sensitive phrase is compared with no decoding
+  virtual bool Skip(const char* phrase, size_t size) {
+    if (_end && static_cast<size_t>(_end - _pointer) < size)
+      return false;
+    // the terminator is not in the phrase, so it stops the comparison
+    bool folds = _flags.IsFlagSet(SPEG_CASEINSENSITIVE);
+    for (size_t i = 0; i < size; i++) {
+      if (_pointer[i] == static_cast<__CHARTYPE>(phrase[i]))
+        continue;
+      if (!folds)
+        return false;
+      // the characters beyond ASCII may fold into it, they are decoded
+      SChar unit = static_cast<SChar>(_pointer[i]);
+      if (unit >= 0x80)
+        return _SkipFolded(phrase, size);
+      if (Utils::CharToLower(unit) != Utils::CharToLower(
+            static_cast<unsigned char>(phrase[i])))
+        return false;
+    }
+    if (!_budget.Step(static_cast<unsigned long>(size))) {
+      _Halt();
+      return false;
+    }
+    _pointer += size;
+    return true;
+  }
+
+  virtual int Run(Engine::Automaton* automaton) {
+    if (Exceeded())
+      return 0;
+    const __CHARTYPE* start = _pointer;
+    int result = Engine::Run(automaton, this, &_pointer, _end);
+    if (!_budget.Step(static_cast<unsigned long>(_pointer - start)))
+      _Halt();
+    return result;
+  }
+
+  virtual bool Step() {
+    if (_budget.Step())
+      return true;
+    _Halt();
+    return false;
+  }
+
   inline void SetVar(const char* vname, const char* vval) {
     _vars[vname] = vval;
   }
 
-  inline bool GetVar(const char* vname, char const ** vval) {
-    if (_vars.find(vname) != _vars.end()) {
-      *vval = _vars[vname].c_str();
-      return true;
-    }
-    return false;
+  inline bool GetVar(const char* vname, char const ** vval) {
+    if (_vars.find(vname) != _vars.end()) {
+      *vval = _vars[vname].c_str();
+      return true;
+    }
+    return false;
+  }
+
+  inline bool DelVar(const char* vname) {
+    return _vars.erase(vname) == 1;
+  }
+};
+
+typedef Context<char> ContextA;
+typedef Context<wchar_t> ContextW;
+
+/**
+ * @brief identifies the kind of a validator, so the passes that walk
+ * the parsing tree (compiler, analysis) can inspect it without knowing
+ * its C++ type
+ *
+ */
+enum ValidatorType {
+  VT_CUSTOM = 0,
+  VT_IS,
+  VT_IN,
+  VT_BETWEEN,
+  VT_EXACT,
+  VT_ANY,
+  VT_BOT,
+  VT_INCHAIN,
+  VT_SEQ,
+  VT_AND,
+  VT_OR,
+  VT_GREEDYOR,
+  VT_NOT,
+  VT_LOOKAHEAD,
+  VT_LOOKBACK,
+  VT_UNTIL,
+  VT_REPEAT,
+  VT_EXTRACT,
+  VT_CALLBACK,
+  VT_REF,
+  VT_CASE,
+  VT_SETVAR,
+  VT_DELVAR,
+  VT_IF,
+  VT_IFMATCHED,
+  VT_MEMO,
+  VT_TRIE,
+  VT_CLASS,
+  VT_PROGRAM,
+  VT_AUTOMATON,
+  VT_COMMIT,
+  VT_PROPERTY
+};
+
+/**
+ * @brief the interface every parsing component should implement..
+ * all children of this interface is used to build the parsing engine 
+ * tree
+ * 
+ */
+class StringValidator {
+ public:
+  /**
+   * @brief the main function that perform parsing/validation
+   * 
+   * @param context a pointer to conext object that the parsing use 
+   * @return true if parsing is successful.. the parsing cursor may move
+   * @return false otherwise
+   */
+  virtual bool Check(ContextInterface* context) const = 0;
+
+  /**
+   * @brief the kind of this validator, user defined validators are
+   * reported as VT_CUSTOM and are always executed through Check()
+   *
+   * @return ValidatorType
+   */
+  virtual ValidatorType Type() const { return VT_CUSTOM; }
+
+  /**
+   * @brief Destroy the String Validator object
+   * 
+   */
+  virtual ~StringValidator() {}
+  /**
+   * @brief Decrement the reference count of object .. if reference count 
+   * reaches zero .. it will delete the object
+   * 
+   */
+  virtual void Release() = 0;
+
+  /**
+   * @brief Increment the reference count.. meaning that there is another 
+   * variable/object referring to this object
+   * 
+   */
+  virtual void AddReference() = 0;
+  /**
+   * @brief Destructor like function called before finally
+   * deleting the object
+   * 
+   */
+  virtual void Dispose() = 0;
+};
+
+/**
+ * @brief The father of all validation/parsing objects,
+ * it implements the reference counting mechanism 
+ * 
+ */
+class NormalValidator : public StringValidator {
+  unsigned long _referenceCount;
+ public:
+  NormalValidator() : _referenceCount(0) {}
+
+  DLL_PUBLIC virtual void AddReference();
+  DLL_PUBLIC virtual void Release();
+  virtual void Dispose() {}
+};
+
+/**
+ * @brief it represents a single argument operation that receives
+ * another operation as an argument  
+ * 
+ */
+class UnaryValidator : public NormalValidator {
+ protected:
+ /**
+  * @brief the operand the operation receives to execute it later
+  * 
+  */
+  StringValidator* const Operand;
+ public:
+  explicit UnaryValidator(StringValidator* op) : Operand(op) {
+    Operand->AddReference();
+  }
+
+  StringValidator* GetOperand() const {
+    return Operand;
+  }
+
+  virtual void Dispose();
+};
+
+/**
+ * @brief it represents a dual argument operation that receives
+ * another two operations as arguments  
+ */
+class BinaryValidator : public NormalValidator {
+ protected:
+ /**
+  * @brief the first operand
+  * 
+  */
+  StringValidator* const FirstOperand;
+  /**
+   * @brief the second one
+   * 
+   */
+  StringValidator* const SecondOperand;
+
+ public:
+  BinaryValidator(StringValidator* op1, StringValidator* op2)
+    : FirstOperand(op1)
+    , SecondOperand(op2) {
+    op1->AddReference();
+    op2->AddReference();
+  }
+
+  StringValidator* GetFirstOperand() const {
+    return FirstOperand;
+  }
+
+  StringValidator* GetSecondOperand() const {
+    return SecondOperand;
+  }
+
+  virtual void Dispose();
+};
+
+/**
+ * @brief it represents an operation over a list of operations, a chain
+ * of the same operation (a > b > c) is merged into one node so it runs
+ * in one loop
+ */
+class NaryValidator : public NormalValidator {
+  bool _committed;
+
+  void _Merge(ValidatorType type, const vector<StringValidator*>& validators);
+
+ protected:
+ /**
+  * @brief the operands in their order
+  * 
+  */
+  vector<StringValidator*> Operands;
+
+ public:
+  /**
+   * @brief Construct a new Nary Validator object of two validators, see
+   * the constructor of a list of validators
+   * 
+   * @param type the type of the node
+   * @param op1 first validator
+   * @param op2 second validator
+   */
+  NaryValidator(ValidatorType type, StringValidator* op1
+        , StringValidator* op2) : _committed(false) {
+    vector<StringValidator*> validators;
+    validators.push_back(op1);
+    validators.push_back(op2);
+    _Merge(type, validators);
+  }
+
+  /**
+   * @brief Construct a new Nary Validator object, the operands of a 
+   * validator of the same type are taken instead of the validator itself,
+   * but a choice with a Commit() written in it keeps its own cut scope
+   * 
+   * @param type the type of the node
+   * @param validators the validators in their order, at least two
+   */
+  NaryValidator(ValidatorType type
+        , const vector<StringValidator*>& validators) : _committed(false) {
+    _Merge(type, validators);
+  }
+
+  /**
+   * @brief whether a Commit() is written in the operands, at any depth 
+   * but behind a reference
+   * 
+   */
+  bool Committed() const {
+    return _committed;
+  }
+
+  size_t Count() const {
+    return Operands.size();
+  }
+
+  StringValidator* GetOperand(size_t index) const {
+    return Operands[index];
+  }
+
+  const vector<StringValidator*>& GetOperands() const {
+    return Operands;
+  }
+
+  virtual void Dispose();
+};
+
+}  // namespace Core
+
+/**
+ * @brief static analysis of parsing trees
+ * 
+ */
+namespace Analysis {
+/**
+ * @brief the characters a validator may start its match with, it is 
+ * computed for both case sensitive and insensitive modes unless asked 
+ * otherwise, so it holds every case variant of the characters
+ * 
+ */
+struct FirstSet {
+  /**
+   * @brief bitmap of characters between 0 and 255 
+   * 
+   */
+  unsigned char Chars[32];
+  /**
+   * @brief any character above 255 may start the match
+   * 
+   */
+  bool Beyond;
+  /**
+   * @brief the validator may succeed without consuming any character
+   * whatever the current character is
+   * 
+   */
+  bool Nullable;
+  /**
+   * @brief the validator has no side effects (matches, variables, flags
+   * or callbacks) so skipping it is not observable
+   * 
+   */
+  bool Pure;
+
+  FirstSet() : Beyond(false), Nullable(false), Pure(true) {
+    memset(Chars, 0, sizeof(Chars));
+  }
+
+  inline void Add(SChar chr) {
+    if (chr < 256)
+      Chars[chr >> 3] |= static_cast<unsigned char>(1 << (chr & 7));
+    else
+      Beyond = true;
   }
 
-  inline bool DelVar(const char* vname) {
-    return _vars.erase(vname) == 1;
+  inline bool Contains(SChar chr) const {
+    if (chr < 256)
+      return (Chars[chr >> 3] & (1 << (chr & 7))) != 0;
+    return Beyond;
   }
 };
 
-typedef Context<char> ContextA;
-typedef Context<wchar_t> ContextW;
 /**
- * @brief the interface every parsing component should implement..
- * all children of this interface is used to build the parsing engine 
- * tree
+ * @brief compute the first set of the validator, referenced rules (Ref) 
+ * and custom validators are considered to start with any character 
  * 
+ * @param validator the root of parsing tree
+ * @param folded false for the characters of the case sensitive mode only,
+ * a change of the case mode before the first character leaves the set 
+ * impure anyway
+ * @return FirstSet 
  */
-class StringValidator {
+DLL_PUBLIC FirstSet First(const Core::StringValidator* validator
+        , bool folded = true);
+
+/**
+ * @brief how Cuts() treats what it cannot see through
+ * 
+ */
+enum CutsMode {
+  /** @brief referenced rules and custom validators may pass a Commit() */
+  CUTS_ASSUMED,
+  /** @brief referenced rules are injected and analyzed */
+  CUTS_INJECTED,
+  /** @brief only the Commit() written in the alternatives count */
+  CUTS_WRITTEN
+};
+
+/**
+ * @brief whether parsing any of the alternatives may pass a Commit(), so
+ * a choice over them has to open a cut scope for each
+ * 
+ * @param alternatives the alternatives of the choice
+ * @param mode how referenced rules (Ref) and custom validators are treated
+ * @return true if a cut scope is needed
+ */
+DLL_PUBLIC bool Cuts(const vector<Core::StringValidator*>& alternatives
+        , CutsMode mode = CUTS_ASSUMED);
+
+/**
+ * @brief whether the validator reads or writes the variables or the 
+ * matches (If, IfMatched, Set, Del), so its result at a position does 
+ * not depend on the position and the flags only and it cannot be 
+ * memoized.. referenced rules are followed, a reference that is not 
+ * resolved yet is assumed stateful
+ * 
+ * @param validator the root of parsing tree
+ * @return true if the validator is stateful
+ */
+DLL_PUBLIC bool Stateful(const Core::StringValidator* validator);
+
+/**
+ * @brief the literal every match of the validator starts with, it is
+ * collected from the leading primitives in sequences so that no other
+ * validator is run before the literal is matched
+ * 
+ * @param validator the root of parsing tree
+ * @param extend if false only the literal of the leftmost primitive is
+ *  returned, otherwise the literals of the following primitives are 
+ *  appended to it 
+ * @return vector<SChar> the literal, empty if there is no such literal
+ */
+DLL_PUBLIC vector<SChar> Prefix(const Core::StringValidator* validator
+        , bool extend = true);
+
+// the alternatives of a choice past the first SPEG_CHOICE_BITS are always
+// tried
+#define SPEG_CHOICE_BITS 32
+#define SPEG_CHOICE_ALL (~0U)
+
+/**
+ * @brief a jump table that tells which alternatives of a choice can 
+ * match the character under parsing cursor.. an alternative is dropped 
+ * only if it is pure and cannot succeed without consuming a character 
+ * out of its first set, so ordered choice semantics are kept
+ * 
+ */
+class Dispatch {
+  unsigned int _table[256];
+  unsigned int _beyond;
+  bool _active;
+
  public:
   /**
-   * @brief the main function that perform parsing/validation
+   * @brief Construct an empty Dispatch table, that tries every alternative
    * 
-   * @param context a pointer to conext object that the parsing use 
-   * @return true if parsing is successful.. the parsing cursor may move
-   * @return false otherwise
    */
-  virtual bool Check(ContextInterface* context) const = 0;
+  Dispatch() : _beyond(SPEG_CHOICE_ALL), _active(false) {}
+
   /**
-   * @brief Destroy the String Validator object
+   * @brief Construct a new Dispatch table
    * 
+   * @param alternatives the alternatives in their order
    */
-  virtual ~StringValidator() {}
+  DLL_PUBLIC explicit Dispatch(
+        const vector<Core::StringValidator*>& alternatives);
+
   /**
-   * @brief Decrement the reference count of object .. if reference count 
-   * reaches zero .. it will delete the object
+   * @brief the alternatives that can match at the parsing cursor, it does
+   * not prune in SPEG_IGNORESPACES mode since the primitives skip the 
+   * spaces before they check the character
    * 
+   * @param context the parsing context
+   * @return unsigned int bit i is set if alternative i can match, see 
+   *                      Tries()
    */
-  virtual void Release() = 0;
+  inline unsigned int Candidates(Core::ContextInterface* context) const {
+    if (!_active || context->Flags().IsFlagSet(SPEG_IGNORESPACES))
+      return SPEG_CHOICE_ALL;
+    SChar chr = context->Get();
+    return (chr < 256) ? _table[chr] : _beyond;
+  }
 
   /**
-   * @brief Increment the reference count.. meaning that there is another 
-   * variable/object referring to this object
+   * @brief whether an alternative is to be tried
    * 
+   * @param candidates the result of Candidates()
+   * @param index the index of the alternative
    */
-  virtual void AddReference() = 0;
+  static inline bool Tries(unsigned int candidates, size_t index) {
+    return index >= SPEG_CHOICE_BITS || ((candidates >> index) & 1);
+  }
+
   /**
-   * @brief Destructor like function called before finally
-   * deleting the object
+   * @brief whether the table may drop any alternative
    * 
    */
-  virtual void Dispose() = 0;
+  bool Active() const {
+    return _active;
+  }
 };
 
 /**
- * @brief The father of all validation/parsing objects,
- * it implements the reference counting mechanism 
+ * @brief the jump table and the cut scopes of a choice, they are built 
+ * the first time the choice is parsed or compiled, so the choices merged
+ * into a longer chain (a | b | c) are never analyzed
  * 
  */
-class NormalValidator : public StringValidator {
-  unsigned long _referenceCount;
+class Choice {
+  Dispatch _dispatch;
+  bool _cuts;
+  volatile long _analyzed;
+  unsigned long _lock;
+
+  DLL_PUBLIC void _Analyze(const vector<Core::StringValidator*>& alternatives);
+
  public:
-  NormalValidator() : _referenceCount(0) {}
+  Choice() : _cuts(false), _analyzed(0), _lock(0) {}
 
-  DLL_PUBLIC virtual void AddReference();
-  DLL_PUBLIC virtual void Release();
-  virtual void Dispose() {}
+  /**
+   * @brief analyze the alternatives unless they have been already
+   * 
+   * @param alternatives the alternatives of the choice, always the same 
+   */
+  inline void Analyze(const vector<Core::StringValidator*>& alternatives) {
+    // the table is copied before _analyzed is stored
+    if (!Utils::SafeLoad(&_analyzed))
+      _Analyze(alternatives);
+  }
+
+  /**
+   * @brief the jump table of the alternatives, once analyzed
+   * 
+   */
+  const Dispatch& Table() const {
+    return _dispatch;
+  }
+
+  /**
+   * @brief whether parsing an alternative may pass a Commit(), once 
+   * analyzed
+   * 
+   */
+  bool Cuts() const {
+    return _cuts;
+  }
 };
 
 /**
- * @brief it represents a single argument operation that receives
- * another operation as an argument  
+ * @brief whether a validator can be memoized, that is it is not 
+ * Stateful().. it is found the first time the validator is parsed, once
+ * its references are resolved
  * 
  */
-class UnaryValidator : public NormalValidator {
- protected:
- /**
-  * @brief the operand the operation receives to execute it later
-  * 
-  */
-  StringValidator* const Operand;
+class Memoizable {
+  volatile long _known;
+
  public:
-  explicit UnaryValidator(StringValidator* op) : Operand(op) {
-    Operand->AddReference();
-  }
-  virtual void Dispose();
-};
+  Memoizable() : _known(0) {}
 
-/**
- * @brief it represents a dual argument operation that receives
- * another two operations as arguments  
- */
-class BinaryValidator : public NormalValidator {
- protected:
- /**
-  * @brief the first operand
-  * 
-  */
-  StringValidator* const FirstOperand;
   /**
-   * @brief the second one
+   * @brief whether the validator can be memoized
    * 
+   * @param validator the validator holding this, always the same
    */
-  StringValidator* const SecondOperand;
-
- public:
-  BinaryValidator(StringValidator* op1, StringValidator* op2)
-    : FirstOperand(op1)
-    , SecondOperand(op2) {
-    op1->AddReference();
-    op2->AddReference();
+  inline bool Of(const Core::StringValidator* validator) {
+    if (!_known)
+      Utils::SafeStore(&_known, Stateful(validator) ? 2 : 1);
+    return _known == 1;
   }
 
-  virtual void Dispose();
+  /**
+   * @brief forget the answer, the operands of the validator have changed
+   * 
+   */
+  void Reset() {
+    _known = 0;
+  }
 };
-
-}  // namespace Core
+}  // namespace Analysis
 
 /**
  * @brief the namespace of all real parsing validators that checks the 
@@ -866,6 +2818,28 @@ class BinaryValidator : public NormalValidator {
  * 
  */
 namespace Primitives {
+/**
+ * @brief the character type independent part of IsValidator, it holds
+ * the character in UTF32
+ * 
+ */
+class CharValidator : public Core::NormalValidator {
+  const SChar _character;
+  const SChar _folded;
+ public:
+  explicit CharValidator(SChar chr)
+    : _character(chr)
+    , _folded(Utils::CharToLower(chr)) {}
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_IS; }
+
+  SChar Character() const {
+    return _character;
+  }
+};
+
 /**
  * @brief receives a character .. if the character under cursor 
  * equals this character it returns true and move farward ... 
@@ -874,25 +2848,14 @@ namespace Primitives {
  * @tparam __CHARTYPE character type
  */
 template<typename __CHARTYPE>
-class IsValidator : public Core::NormalValidator {
-  const __CHARTYPE _character;
+class IsValidator : public CharValidator {
  public:
  /**
   * @brief Construct a new Is Validator object
   * 
   * @param chr the charcter which will compared to 
   */
-  explicit IsValidator(__CHARTYPE chr) : _character(chr) {}
-  virtual bool Check(Core::ContextInterface* context)const {
-    context->AdjustPosition();
-    Core::Position start = context->GetPosition();
-    if (!context->Compare(_character)) {
-      context->Forward();
-      context->AddMatch(start);
-      return true;
-    }
-    return false;
-  }
+  explicit IsValidator(__CHARTYPE chr) : CharValidator(chr) {}
 };
 
 typedef IsValidator<char>  IsValidatorA;
@@ -903,6 +2866,28 @@ typedef IsValidator<char16_t>  IsValidatorU16;
 typedef IsValidator<char32_t>  IsValidatorU32;
 #endif
 
+/**
+ * @brief the character type independent part of InValidator, it holds
+ * the decoded set characters
+ * 
+ */
+class CharSetValidator : public Core::NormalValidator {
+  vector<SChar> _set;
+  vector<SChar> _folded;
+ public:
+  explicit CharSetValidator(const vector<SChar>& set)
+    : _set(set)
+    , _folded(Utils::Fold(set)) {}
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_IN; }
+
+  const vector<SChar>& Characters() const {
+    return _set;
+  }
+};
+
 /**
  * @brief receives a string containing set .. if the character under cursor 
  * equals one of the set's characters it returns true and move farward ... 
@@ -910,30 +2895,21 @@ typedef IsValidator<char32_t>  IsValidatorU32;
  * @tparam __CHARTYPE 
  */
 template<typename __CHARTYPE>
-class InValidator : public Core::NormalValidator {
-  const __CHARTYPE* _set;
+class InValidator : public CharSetValidator {
+  static vector<SChar> _Decode(const __CHARTYPE* set) {
+    vector<SChar> out;
+    Utils::Decode(set, out);
+    return out;
+  }
+
  public:
  /**
   * @brief Construct a new In Validator object
   * 
   * @param set the string that contains character set
   */
-  explicit InValidator(const __CHARTYPE* set) : _set(set) {}
-  virtual bool Check(Core::ContextInterface* context)const {
-    context->AdjustPosition();
-    Core::Position start = context->GetPosition();
-    const __CHARTYPE* setPtr = _set;
-    while (*setPtr) {
-      SChar chr = Utils::GetChar(setPtr);
-      if (!context->Compare(chr)) {
-        context->Forward();
-        context->AddMatch(start);
-        return true;
-      }
-      Utils::Increment(&setPtr);
-    }
-    return false;
-  }
+  explicit InValidator(const __CHARTYPE* set)
+    : CharSetValidator(_Decode(set)) {}
 };
 
 typedef InValidator<char>  InValidatorA;
@@ -954,6 +2930,9 @@ class InChainValidator : public Core::NormalValidator {
  public:
   InChainValidator() {}
   virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_INCHAIN; }
 };
 
 /**
@@ -965,6 +2944,7 @@ class BOTValidator : public Core::NormalValidator {
  public:
   BOTValidator() {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_BOT; }
 };
 
 /**
@@ -975,6 +2955,76 @@ class AnyValidator : public Core::NormalValidator {
  public:
   AnyValidator() {}
   virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_ANY; }
+};
+
+/**
+ * @brief a cut point, it matches nothing and stops the enclosing choice
+ * from trying its remaining alternatives
+ * 
+ */
+class CommitValidator : public Core::NormalValidator {
+ public:
+  CommitValidator() {}
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_COMMIT; }
+};
+
+/**
+ * @brief a Unicode property, a general category, a script or White_Space,
+ * its characters are decoded from the range tables once when it is built
+ * 
+ */
+class PropertyValidator : public Core::NormalValidator {
+  Utils::CharClass _sensitive;
+  Utils::CharClass _folded;
+
+ public:
+  DLL_PUBLIC explicit PropertyValidator(const Utils::CharClass& chars);
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_PROPERTY; }
+
+  const Utils::CharClass& Sensitive() const {
+    return _sensitive;
+  }
+
+  const Utils::CharClass& Folded() const {
+    return _folded;
+  }
+};
+
+/**
+ * @brief the character type independent part of BetweenValidator
+ * 
+ */
+class CharRangeValidator : public Core::NormalValidator {
+  const SChar _min;
+  const SChar _max;
+  const SChar _foldedMin;
+  const SChar _foldedMax;
+
+ public:
+  CharRangeValidator(SChar min, SChar max)
+    : _min(min)
+    , _max(max)
+    , _foldedMin(Utils::CharToLower(min))
+    , _foldedMax(Utils::CharToLower(max)) {}
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_BETWEEN; }
+
+  SChar Min() const {
+    return _min;
+  }
+
+  SChar Max() const {
+    return _max;
+  }
 };
 
 /**
@@ -984,10 +3034,7 @@ class AnyValidator : public Core::NormalValidator {
  * @tparam __CHARTYPE character range 
  */
 template<typename __CHARTYPE>
-class BetweenValidator : public Core::NormalValidator {
-  __CHARTYPE _min;
-  __CHARTYPE _max;
-
+class BetweenValidator : public CharRangeValidator {
  public:
  /**
   * @brief Construct a new Between Validator object
@@ -996,24 +3043,10 @@ class BetweenValidator : public Core::NormalValidator {
   * @param max upper bound
   */
   BetweenValidator(const __CHARTYPE min, const __CHARTYPE max)
-    : _min(min)
-    , _max(max) {}
+    : CharRangeValidator(min, max) {}
 
   explicit BetweenValidator(const __CHARTYPE* range)
-    : _min(range[0])
-    , _max(range[1]) { }
-
-  virtual bool Check(Core::ContextInterface* context) const {
-    context->AdjustPosition();
-    Core::Position start = context->GetPosition();
-    if (context->Compare(_min) >= 0
-      && context->Compare(_max) <= 0
-      && context->Forward()) {
-      context->AddMatch(start);
-      return true;
-    }
-    return false;
-  }
+    : CharRangeValidator(range[0], range[1]) { }
 };
 
 
@@ -1025,6 +3058,29 @@ typedef BetweenValidator<char16_t>  BetweenValidatorU16;
 typedef BetweenValidator<char32_t>  BetweenValidatorU32;
 #endif
 
+/**
+ * @brief the character type independent part of ExactValidator, it holds
+ * the decoded phrase
+ * 
+ */
+class PhraseValidator : public Core::NormalValidator {
+  vector<SChar> _phrase;
+  vector<SChar> _folded;
+
+ public:
+  explicit PhraseValidator(const vector<SChar>& phrase)
+    : _phrase(phrase)
+    , _folded(Utils::Fold(phrase)) {}
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_EXACT; }
+
+  const vector<SChar>& Phrase() const {
+    return _phrase;
+  }
+};
+
 /**
  * @brief it recieves a string containing a sequence of characters 
  * if the character under the cursor follows the same context it returns 
@@ -1032,8 +3088,12 @@ typedef BetweenValidator<char32_t>  BetweenValidatorU32;
  * @tparam __CHARTYPE characted type
  */
 template<typename __CHARTYPE>
-class ExactValidator : public Core::NormalValidator {
-  const __CHARTYPE* _phrase;
+class ExactValidator : public PhraseValidator {
+  static vector<SChar> _Decode(const __CHARTYPE* phrase) {
+    vector<SChar> out;
+    Utils::Decode(phrase, out);
+    return out;
+  }
 
  public:
  /**
@@ -1041,33 +3101,156 @@ class ExactValidator : public Core::NormalValidator {
   * 
   * @param phrase the phrase which the text will be compared with
   */
-  explicit ExactValidator(const __CHARTYPE* phrase) : _phrase(phrase) {}
-
-  virtual bool Check(Core::ContextInterface* context) const {
-    context->AdjustPosition();
-    const __CHARTYPE* phrasePointer = _phrase;
-    Core::Position start = context->GetPosition();
-    while (*phrasePointer) {
-      SChar chr = Utils::GetChar(phrasePointer);
-      if (context->Compare(chr)) {
-        context->SetPosition(start);
-        return false;
-      }
-      Utils::Increment(&phrasePointer);
-      context->Forward();
-    }
-    context->AddMatch(start);
-    return true;
+  explicit ExactValidator(const __CHARTYPE* phrase)
+    : PhraseValidator(_Decode(phrase)) {}
+};
+
+typedef ExactValidator<char> ExactValidatorA;
+typedef ExactValidator<wchar_t> ExactValidatorW;
+typedef ExactValidator<char8_t> ExactValidatorU8;
+#ifdef  CX11_SUPPORTED
+typedef ExactValidator<char16_t> ExactValidatorU16;
+typedef ExactValidator<char32_t> ExactValidatorU32;
+#endif
+
+/**
+ * @brief matches one of a list of phrases by walking a trie, so every 
+ * character is read once whatever the number of phrases is .. it keeps 
+ * ordered choice semantics, the first listed phrase that matches wins
+ * 
+ */
+class TrieValidator : public Core::NormalValidator {
+ public:
+  /**
+   * @brief a trie node, edges are sorted by character
+   * 
+   */
+  struct Node {
+    vector<pair<SChar, unsigned int> > Edges;
+    /**
+     * @brief index of the phrase ending at this node, number of phrases
+     * if there is none
+     * 
+     */
+    unsigned int Phrase;
+    /**
+     * @brief smallest index of the phrases ending below this node
+     * 
+     */
+    unsigned int Below;
+  };
+
+ private:
+  vector<vector<SChar> > _phrases;
+  vector<unsigned int> _depths;
+  vector<Node> _sensitive;
+  vector<Node> _folded;
+
+  void _Build(vector<Node>* trie, bool fold);
+  static unsigned int _Next(const vector<Node>& trie
+        , unsigned int node
+        , SChar chr);
+
+ public:
+  /**
+   * @brief Construct a new Trie Validator object
+   * 
+   * @param phrases the phrases in order of precedence 
+   * @param depths number of choices (Or) each phrase was nested in, each 
+   *  one adds an unnamed match when the phrase is matched
+   */
+  DLL_PUBLIC TrieValidator(const vector<vector<SChar> >& phrases
+        , const vector<unsigned int>& depths);
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_TRIE; }
+
+  const vector<vector<SChar> >& Phrases() const {
+    return _phrases;
+  }
+
+  const vector<unsigned int>& Depths() const {
+    return _depths;
+  }
+
+  /**
+   * @brief the trie of the phrases, node 0 is the root
+   * 
+   * @param folded the lower cased trie used in case insensitive mode
+   */
+  const vector<Node>& Trie(bool folded) const {
+    return folded ? _folded : _sensitive;
+  }
+};
+
+/**
+ * @brief a character class that is tested by a single lookup, it is 
+ * fused from a tree of single character validators (Is, In, Between, Any
+ * combined by |, & and !) by In(), Between(), | and &, and holds two 
+ * sets, one for case sensitive mode and one for case insensitive mode 
+ * .. the original tree is kept 
+ * and used when SPEG_IGNORESPACES or SPEG_MATCHUNNAMED flags are set, 
+ * since the tree skips spaces and records unnamed matches in every node
+ * 
+ */
+class CharClassValidator : public Core::NormalValidator {
+  Utils::CharClass _sensitive;
+  Utils::CharClass _folded;
+  Core::StringValidator* const _tree;
+
+ public:
+  DLL_PUBLIC CharClassValidator(const Utils::CharClass& sensitive
+        , const Utils::CharClass& folded
+        , Core::StringValidator* tree);
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_CLASS; }
+  virtual void Dispose();
+
+  const Utils::CharClass& Sensitive() const {
+    return _sensitive;
+  }
+
+  const Utils::CharClass& Folded() const {
+    return _folded;
+  }
+
+  /**
+   * @brief the tree the class is fused from
+   * 
+   * @return Core::StringValidator* 
+   */
+  Core::StringValidator* Tree() const {
+    return _tree;
   }
 };
 
-typedef ExactValidator<char> ExactValidatorA;
-typedef ExactValidator<wchar_t> ExactValidatorW;
-typedef ExactValidator<char8_t> ExactValidatorU8;
-#ifdef  CX11_SUPPORTED
-typedef ExactValidator<char16_t> ExactValidatorU16;
-typedef ExactValidator<char32_t> ExactValidatorU32;
-#endif
+/**
+ * @brief fuse the tree into a character class validator if it consists 
+ * of single character validators only
+ * 
+ * @param tree the tree to be fused
+ * @return Core::StringValidator* the class validator or the tree itself
+ */
+DLL_PUBLIC Core::StringValidator* Fuse(Core::StringValidator* tree);
+
+/**
+ * @brief the characters a single character validator matches in case 
+ * sensitive and case insensitive modes
+ * 
+ * @param validator Is(char), In, Between, Any, fused classes or their 
+ * Or/And/Not combinations
+ * @param sensitive receives the case sensitive class
+ * @param folded receives the case insensitive class
+ * @return true if the validator always consumes exactly one character
+ * @return false otherwise
+ */
+DLL_PUBLIC bool Classify(const Core::StringValidator* validator
+      , Utils::CharClass* sensitive, Utils::CharClass* folded);
 }  // namespace Primitives
 
 
@@ -1079,14 +3262,19 @@ typedef ExactValidator<char32_t> ExactValidatorU32;
 namespace Manipulators {
 
 /**
- * @brief Executes the operands sequentially the first then second
+ * @brief Executes the operands sequentially in their order
  * 
  */
-class SeqValidator : public Core::BinaryValidator {
+class SeqValidator : public Core::NaryValidator {
  public:
   explicit SeqValidator(Core::StringValidator* s1, Core::StringValidator* s2) :
-    Core::BinaryValidator(s1, s2) {}
+    Core::NaryValidator(Core::VT_SEQ, s1, s2) {}
+  explicit SeqValidator(const vector<Core::StringValidator*>& operands) :
+    Core::NaryValidator(Core::VT_SEQ, operands) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_SEQ; }
 };
 
 /**
@@ -1100,34 +3288,93 @@ class AndValidator : public Core::BinaryValidator {
     Core::BinaryValidator(s1, s2) {}
 
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_AND; }
 };
 
 /**
- * @brief perform Or operation between the two operations results . it applies 
- * the first successful operation.. if both are failed it will fail this 
+ * @brief perform Or operation between the operations results . it applies 
+ * the first successful operation.. if all are failed it will fail this 
  * operation and restore cursor positions
  * 
  */
-class OrValidator : public Core::BinaryValidator {
+class OrValidator : public Core::NaryValidator {
+  mutable Analysis::Choice _choice;
+  mutable Analysis::Memoizable _memoizable;
+
  public:
   explicit OrValidator(Core::StringValidator* s1, Core::StringValidator* s2) :
-    BinaryValidator(s1, s2) {}
+    NaryValidator(Core::VT_OR, s1, s2) {}
+  explicit OrValidator(const vector<Core::StringValidator*>& operands) :
+    NaryValidator(Core::VT_OR, operands) {}
 
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_OR; }
+
+  /**
+   * @brief parse without consulting the memo table (SPEG_MEMOIZE)
+   * 
+   */
+  bool Evaluate(Core::ContextInterface* context) const;
+
+  /**
+   * @brief the jump table of the alternatives
+   * 
+   */
+  const Analysis::Dispatch& Choices() const {
+    _choice.Analyze(Operands);
+    return _choice.Table();
+  }
+
+  /**
+   * @brief whether the results can be memoized, see Analysis::Stateful()
+   * 
+   */
+  bool CanMemoize() const {
+    return _memoizable.Of(this);
+  }
 };
 
 /**
- * @brief perform Or operation between the two operations results . it applies 
- * the the most relevant match.. if both are failed it will fail this 
- * operation and restore cursor positions
+ * @brief perform Or operation between the operations results . it applies 
+ * the the most relevant (longest) match.. if all are failed it will fail 
+ * this operation and restore cursor positions
  * 
  */
-class GreedyOrValidator : public Core::BinaryValidator {
+class GreedyOrValidator : public Core::NaryValidator {
+  mutable Analysis::Choice _choice;
+  mutable Analysis::Memoizable _memoizable;
+
  public:
   explicit GreedyOrValidator(Core::StringValidator* op1
       , Core::StringValidator* op2) :
-    BinaryValidator(op1, op2) {}
+    NaryValidator(Core::VT_GREEDYOR, op1, op2) {}
+  explicit GreedyOrValidator(const vector<Core::StringValidator*>& operands) :
+    NaryValidator(Core::VT_GREEDYOR, operands) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_GREEDYOR; }
+
+  /**
+   * @brief parse without consulting the memo table (SPEG_MEMOIZE)
+   * 
+   */
+  bool Evaluate(Core::ContextInterface* context) const;
+
+  /**
+   * @brief the jump table of the alternatives
+   * 
+   */
+  const Analysis::Dispatch& Choices() const {
+    _choice.Analyze(Operands);
+    return _choice.Table();
+  }
+
+  /**
+   * @brief whether the results can be memoized, see Analysis::Stateful()
+   * 
+   */
+  bool CanMemoize() const {
+    return _memoizable.Of(this);
+  }
 };
 
 /**
@@ -1140,6 +3387,7 @@ class NotValidator : public Core::UnaryValidator {
   explicit NotValidator(Core::StringValidator* op)
         : Core::UnaryValidator(op) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_NOT; }
 };
 
 /**
@@ -1152,6 +3400,7 @@ class LookAheadValidator : public Core::UnaryValidator {
   explicit LookAheadValidator(StringValidator* op)
                 : UnaryValidator(op) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_LOOKAHEAD; }
 };
 
 /**
@@ -1164,19 +3413,36 @@ class LookBackValidator : public Core::UnaryValidator {
   explicit LookBackValidator(Core::StringValidator* op)
         : Core::UnaryValidator(op) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_LOOKBACK; }
 };
 
 /**
  * @brief Used in searches ... skips successive character till 
- * the input rule matches
+ * the input rule matches, if the rule starts with a literal it jumps 
+ * directly between the occurances of that literal 
  * 
  */
 class UntilValidator : public Core::UnaryValidator {
+  const Utils::Literal _prefix;
+  const Utils::Literal _leading;
+
  public:
   explicit UntilValidator(Core::StringValidator* op)
-        : UnaryValidator(op) {}
+        : UnaryValidator(op)
+        , _prefix(Analysis::Prefix(op))
+        , _leading(Analysis::Prefix(op, false)) {}
+
+  /**
+   * @brief jump to the next occurance of the literal the rule starts 
+   * with, if any
+   * 
+   * @param context the parsing context
+   * @return false if the rule cannot match anywhere after the cursor
+   */
+  DLL_PUBLIC bool Seek(Core::ContextInterface* context) const;
 
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_UNTIL; }
 };
 /**
  * @brief Repeat the input rule for a number of times .. and validate
@@ -1186,26 +3452,59 @@ class UntilValidator : public Core::UnaryValidator {
 class RepeatValidator : public Core::UnaryValidator {
   unsigned int _maxIter;
   unsigned int _minIter;
+  // the operand as character classes, the whole run is consumed at once
+  bool _span;
+  Utils::CharClass _sensitive;
+  Utils::CharClass _folded;
+
+  DLL_PUBLIC void _Classify();
+
  public:
   explicit RepeatValidator(Core::StringValidator* op)
     : Core::UnaryValidator(op)
     , _maxIter(-1)
-    , _minIter(0)
-  {}
+    , _minIter(0) {
+    _Classify();
+  }
 
   RepeatValidator(Core::StringValidator* op, int max)
     : Core::UnaryValidator(op)
     , _maxIter(max)
-    , _minIter(0)
-  {}
+    , _minIter(0) {
+    _Classify();
+  }
 
   RepeatValidator(Core::StringValidator* op, int min, int max)
     : Core::UnaryValidator(op)
     , _maxIter(max)
-    , _minIter(min)
-  {}
+    , _minIter(min) {
+    _Classify();
+  }
 
   virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_REPEAT; }
+
+  /**
+   * @brief whether the operand is a character class the repetition 
+   * consumes as a single run, not under SPEG_IGNORESPACES or 
+   * SPEG_MATCHUNNAMED where every iteration has to be visible
+   * 
+   */
+  template<typename __CONTEXT>
+  bool Spans(__CONTEXT* context) const {
+    return _span && !context->Flags().IsFlagSet(SPEG_IGNORESPACES)
+          && !context->Flags().IsFlagSet(SPEG_MATCHUNNAMED);
+  }
+
+  unsigned int MinIterations() const {
+    return _minIter;
+  }
+
+  unsigned int MaxIterations() const {
+    return _maxIter;
+  }
 };
 
 /**
@@ -1226,6 +3525,11 @@ class ExtractValidator : public Core::UnaryValidator {
 
 
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_EXTRACT; }
+
+  const char* Key() const {
+    return _key;
+  }
 };
 
 /**
@@ -1256,7 +3560,15 @@ public:
 
 
 	virtual bool Check(Core::ContextInterface* context) const;
+	virtual Core::ValidatorType Type() const { return Core::VT_CALLBACK; }
+
+	CALLBACKFUNCTION Function() const {
+		return _func;
+	}
 
+	void* CallBackContext() const {
+		return _cbcontext;
+	}
 };
 
 
@@ -1267,6 +3579,7 @@ public:
 class RefValidator : public Core::NormalValidator {
   Core::StringValidator* _validator;
   const Core::Rule* _rule;
+  mutable Analysis::Memoizable _memoizable;
  public:
   RefValidator() : _rule(NULL), _validator(NULL) {}
   explicit RefValidator(const Core::Rule& rule) 
@@ -1274,7 +3587,55 @@ class RefValidator : public Core::NormalValidator {
       , _validator(NULL) {}
 
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_REF; }
+
+  /**
+   * @brief parse without consulting the memo table (SPEG_MEMOIZE)
+   * 
+   */
+  bool Evaluate(Core::ContextInterface* context) const;
   DLL_PUBLIC void Set(const Core::Rule& rule);
+
+  /**
+   * @brief the validator this reference currently points to
+   * 
+   * @return Core::StringValidator* NULL if not resolved yet
+   */
+  DLL_PUBLIC Core::StringValidator* Target() const;
+
+  /**
+   * @brief whether the results can be memoized, see Analysis::Stateful()
+   * 
+   */
+  bool CanMemoize() const {
+    return _memoizable.Of(this);
+  }
+};
+
+/**
+ * @brief memoize the operand result at every position regardless of
+ * SPEG_MEMOIZE flag, so only the selected rules pay the memoization cost
+ * 
+ */
+class MemoValidator : public Core::UnaryValidator {
+  mutable Analysis::Memoizable _memoizable;
+
+ public:
+  explicit MemoValidator(Core::StringValidator* op) : UnaryValidator(op) {}
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_MEMO; }
+  bool Evaluate(Core::ContextInterface* context) const {
+    return Operand->Check(context);
+  }
+
+  /**
+   * @brief whether the results can be memoized, see Analysis::Stateful()
+   * 
+   */
+  bool CanMemoize() const {
+    return _memoizable.Of(this);
+  }
 };
 }  // namespace Manipulators
 
@@ -1294,6 +3655,14 @@ class CaseModifier : public Core::NormalValidator {
  public:
   explicit CaseModifier(bool cs) : _caseSensitive(cs) {}
   virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_CASE; }
+
+  /**
+   * @brief the value SPEG_CASEINSENSITIVE flag is set to
+   */
+  bool Value() const {
+    return _caseSensitive;
+  }
 };
 
 /**
@@ -1313,81 +3682,368 @@ class SetFlagModifier : public Core::NormalValidator {
     : _flag(flag)
     , _value("1") {}
 
-  virtual bool Check(Core::ContextInterface* context) const;
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_SETVAR; }
+
+  const char* Flag() const {
+    return _flag;
+  }
+
+  const char* Value() const {
+    return _value;
+  }
+};
+
+/**
+ * @brief Delete (unset) context variable
+ * 
+ */
+class DelFlagModifier : public Core::NormalValidator {
+  const char* _flag;
+
+ public:
+  explicit DelFlagModifier(const char* flag)
+    : _flag(flag) {}
+
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_DELVAR; }
+
+  const char* Flag() const {
+    return _flag;
+  }
+};
+
+/**
+ * @brief checks if context variable equals value
+ * 
+ */
+class IfValidator : public Core::NormalValidator {
+  const char* _flag;
+  const char* _value;
+
+ public:
+  IfValidator(const char* flag, const char* val)
+    : _flag(flag)
+    , _value(val)
+  {}
+
+  explicit IfValidator(const char* flag)
+    : _flag(flag)
+    , _value("1")
+  {}
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_IF; }
+
+  const char* Flag() const {
+    return _flag;
+  }
+
+  const char* Value() const {
+    return _value;
+  }
+};
+
+/**
+ * @brief checks if named match is already matched
+ * 
+ */
+class IfMatchedValidator : public Core::NormalValidator {
+  const char* _key;
+  const unsigned long _min;
+  const unsigned long _max;
+
+
+ public:
+  IfMatchedValidator(const char* key
+      , const unsigned long min
+      , const unsigned long max)
+    : _key(key)
+    , _min(min)
+    , _max(max)
+  {}
+
+  IfMatchedValidator(const char* key, const unsigned long max)
+    : _key(key)
+    , _min(1)
+    , _max(max)
+  {}
+
+  explicit IfMatchedValidator(const char* key)
+    : _key(key)
+    , _min(1)
+    , _max(-1)
+  {}
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_IFMATCHED; }
+
+  const char* Key() const {
+    return _key;
+  }
+
+  unsigned long Min() const {
+    return _min;
+  }
+
+  unsigned long Max() const {
+    return _max;
+  }
+};
+
+}  // namespace StateKeepers
+
+/**
+ * @brief the execution engines that run a parsing tree after lowering
+ * it into a different representation
+ * 
+ */
+namespace Engine {
+/**
+ * @brief a single instruction of a compiled program, the opcode is the 
+ * kind of the validator it is lowered from
+ * 
+ */
+struct Instruction {
+  /**
+   * @brief the operation
+   * 
+   */
+  Core::ValidatorType Op;
+  /**
+   * @brief first operand instruction index or offset in characters or 
+   * operands pool, the characters are followed by their lower case
+   * 
+   */
+  unsigned int First;
+  /**
+   * @brief second operand instruction index or count of characters or
+   * operands
+   * 
+   */
+  unsigned int Second;
+  /**
+   * @brief character, lower bound, minimum count, whether a choice 
+   * opens cut scopes, whether a phrase is ASCII, the offset of the 
+   * operands of a sequence with its phrases fused or the case sensitive 
+   * skip of a search (index + 1, 0 if none)
+   * 
+   */
+  SChar Low;
+  /**
+   * @brief upper bound, maximum count, the lower case character, the 
+   * offset of an ASCII phrase in the text pool, the count of the fused 
+   * operands of a sequence (0 if none is fused), the case insensitive 
+   * skip of a search or whether a choice, a reference or a memo reads or 
+   * writes variables or matches and is never memoized
+   * 
+   */
+  SChar High;
+  /**
+   * @brief key, flag name or the validator to be called as is
+   * 
+   */
+  const void* Data;
+  /**
+   * @brief the flag value or the jump table of a choice
+   * 
+   */
+  const void* Extra;
+};
+
+/**
+ * @brief a parsing tree lowered into a flat array of instructions, it is 
+ * executed by a single switch based dispatcher instead of walking the 
+ * tree through virtual calls .. the characters and the ASCII phrases are
+ * matched in place by the instruction that calls them and the adjacent 
+ * phrases of a sequence are compared at once, it produces the same 
+ * results of the tree it is compiled from. Under SPEG_ITERATIVE the 
+ * operands are not called recursively, the instructions waiting for them
+ * are kept on a stack in the heap so the depth of the text is not bounded
+ * by the thread stack
+ * 
+ */
+class ProgramValidator : public Core::NormalValidator {
+  typedef map<const Core::StringValidator*, unsigned int> EMITTED;
+
+  vector<Instruction> _code;
+  vector<SChar> _pool;
+  // the ASCII phrases, compared by Context::Skip()
+  string _text;
+  // the characters the operands of the searches cannot start with, in 
+  // either case mode
+  vector<Utils::CharClass> _skips;
+  vector<unsigned int> _operands;
+  unsigned int _entry;
+  Core::StringValidator* const _root;
+
+  /**
+   * @brief an instruction being executed by _Iterate, with what it needs
+   * to be resumed once its operand returns
+   * 
+   */
+  struct Frame {
+    unsigned int Pc;
+    unsigned int Phase;
+    Core::Position Start;
+    Core::Position Saved;
+    unsigned long Count;
+    unsigned int Candidates;
+    unsigned int Cut;
+    unsigned long Flags;
+    size_t Mark;
+    bool Matched;
+    bool Memo;
+  };
+
+  unsigned int _Emit(const Core::StringValidator* validator
+        , EMITTED* emitted);
+  vector<unsigned int> _Fuse(const vector<unsigned int>& pcs);
+  template<typename __CONTEXT>
+  const unsigned int* _SeqOperands(const Instruction& ins, __CONTEXT* context
+        , unsigned int* count) const;
+  template<typename __CONTEXT>
+  bool _Seek(const Instruction& ins, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Call(unsigned int pc, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Seq(const Instruction& ins, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Or(const Instruction& ins, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Repeat(const Instruction& ins, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Ref(const Instruction& ins, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Memoized(unsigned int pc, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Exec(unsigned int pc, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  bool _Iterate(unsigned int pc, __CONTEXT* context) const;
+  template<typename __CONTEXT>
+  unsigned int _Resume(Frame* frame, bool* result
+        , __CONTEXT* context) const;
+
+ public:
+ /**
+  * @brief Compile the tree into new program
+  * 
+  * @param root the root of the parsing tree
+  */
+  DLL_PUBLIC explicit ProgramValidator(Core::StringValidator* root);
+
+  virtual bool Check(Core::ContextInterface* context) const;
+  template<typename __CONTEXT>
+  bool Match(__CONTEXT* context) const;
+  virtual Core::ValidatorType Type() const { return Core::VT_PROGRAM; }
+  virtual void Dispose();
+
+  /**
+   * @brief the tree this program is compiled from
+   * 
+   * @return Core::StringValidator* 
+   */
+  Core::StringValidator* Root() const {
+    return _root;
+  }
+
+  /**
+   * @brief number of instructions in the program
+   * 
+   * @return size_t 
+   */
+  size_t Size() const {
+    return _code.size();
+  }
 };
 
 /**
- * @brief Delete (unset) context variable
+ * @brief parses a regular tree (no references, variables, case modifiers,
+ * callbacks, lookbacks or greedy choices) through a deterministic 
+ * automaton that is built lazily while parsing, so the text is read once
+ * without backtracking .. a state is the set of the parsing paths that 
+ * are still alive in their order of precedence, so the ordered choices 
+ * and predicates match exactly as the tree does. The tree is parsed as is
+ * under SPEG_IGNORESPACES, SPEG_MATCHNAMED and SPEG_MATCHUNNAMED, and for
+ * good once the states exceed the limit
  * 
  */
-class DelFlagModifier : public Core::NormalValidator {
-  const char* _flag;
+class AutomatonValidator : public Core::NormalValidator {
+  Core::StringValidator* const _root;
+  Automaton* _sensitive;
+  Automaton* _folded;
 
  public:
-  explicit DelFlagModifier(const char* flag)
-    : _flag(flag) {}
-
+ /**
+  * @brief build the automaton of the tree, no state is built yet
+  * 
+  * @param root the root of the regular tree, see Regular()
+  * @param limit the maximum number of states of each case mode
+  */
+  DLL_PUBLIC explicit AutomatonValidator(Core::StringValidator* root
+        , size_t limit = SPEG_DFA_STATES);
 
   virtual bool Check(Core::ContextInterface* context) const;
-};
+  virtual Core::ValidatorType Type() const { return Core::VT_AUTOMATON; }
+  virtual void Dispose();
 
-/**
- * @brief checks if context variable equals value
- * 
- */
-class IfValidator : public Core::NormalValidator {
-  const char* _flag;
-  const char* _value;
+  /**
+   * @brief the tree the automaton is built from
+   * 
+   * @return Core::StringValidator* 
+   */
+  Core::StringValidator* Root() const {
+    return _root;
+  }
 
- public:
-  IfValidator(const char* flag, const char* val)
-    : _flag(flag)
-    , _value(val)
-  {}
+  /**
+   * @brief number of states built so far
+   * 
+   * @param folded the case insensitive automaton
+   * @return size_t 
+   */
+  DLL_PUBLIC size_t States(bool folded) const;
 
-  explicit IfValidator(const char* flag)
-    : _flag(flag)
-    , _value("1")
-  {}
+  /**
+   * @brief whether the states exceeded the limit, so the tree is parsed 
+   * instead
+   * 
+   * @param folded the case insensitive automaton
+   * @return true if the automaton is no longer used
+   */
+  DLL_PUBLIC bool Overflowed(bool folded) const;
 
-  virtual bool Check(Core::ContextInterface* context) const;
+  /**
+   * @brief whether the tree can be parsed by an automaton
+   * 
+   * @param root the root of the tree
+   * @return true if regular
+   */
+  DLL_PUBLIC static bool Regular(const Core::StringValidator* root);
 };
 
 /**
- * @brief checks if named match is already matched
+ * @brief write the parsing tree as C++ source, one function per node that
+ * calls the functions of its operands directly, phrases are unrolled, 
+ * tries become state machines and character classes are tested inline or
+ * through tables .. the source includes Stringozzi.h and defines in the 
+ * namespace @p name :
+ *  - Check(context): parse at the context position
+ *  - Test(str, flags): parse the text from its beginning
+ *  - Validator: runs the generated functions, so the generated parser can
+ *    be wrapped in a Rule and used as any other rule
+ * the generated parser matches exactly as the tree does
  * 
+ * @param root the root of the parsing tree, all placeholders injected
+ * @param name the namespace of the generated code
+ * @param source receives the source
+ * @return false if the tree has callbacks, custom validators or 
+ * unresolved references, which have no source form
  */
-class IfMatchedValidator : public Core::NormalValidator {
-  const char* _key;
-  const unsigned long _min;
-  const unsigned long _max;
-
-
- public:
-  IfMatchedValidator(const char* key
-      , const unsigned long min
-      , const unsigned long max)
-    : _key(key)
-    , _min(min)
-    , _max(max)
-  {}
-
-  IfMatchedValidator(const char* key, const unsigned long max)
-    : _key(key)
-    , _min(1)
-    , _max(max)
-  {}
-
-  explicit IfMatchedValidator(const char* key)
-    : _key(key)
-    , _min(1)
-    , _max(-1)
-  {}
-
-  virtual bool Check(Core::ContextInterface* context) const;
-};
-
-}  // namespace StateKeepers
+DLL_PUBLIC bool Generate(const Core::StringValidator* root
+      , const char* name, string* source);
+}  // namespace Engine
 
 
 namespace Core {
@@ -1435,6 +4091,15 @@ class Rule {
     return _strValid->Check(context);
   }
 
+  /**
+   * @brief Compile the rule into a flat program that runs faster than 
+   * walking the parsing tree, the rule should be complete (i.e. all
+   * placeholders are injected) before compiling it
+   * 
+   * @return Rule the compiled rule
+   */
+  DLL_PUBLIC Rule Compile() const;
+
   virtual ~Rule() {
     _strValid->Release();
   }
@@ -1684,7 +4349,8 @@ DLL_PUBLIC Rule OneOrMore(const Rule& rule);
  */
 template<typename __CHARTYPE>
 Rule Between(const __CHARTYPE min, const __CHARTYPE max) {
-  return new Primitives::BetweenValidator<__CHARTYPE>(min, max);
+  return Primitives::Fuse(
+        new Primitives::BetweenValidator<__CHARTYPE>(min, max));
 }
 
 /**
@@ -1696,7 +4362,7 @@ Rule Between(const __CHARTYPE min, const __CHARTYPE max) {
  */
 template<typename __CHARTYPE>
 Rule Between(const __CHARTYPE* range) {
-  return new Primitives::BetweenValidator<__CHARTYPE>(range);
+  return Primitives::Fuse(new Primitives::BetweenValidator<__CHARTYPE>(range));
 }
 
 /**
@@ -1709,7 +4375,7 @@ Rule Between(const __CHARTYPE* range) {
 template<typename __CHARTYPE>
 Rule In(const __CHARTYPE* set) {
   ADJUST_NULL_STR(set);
-  return new Primitives::InValidator<__CHARTYPE>(set);
+  return Primitives::Fuse(new Primitives::InValidator<__CHARTYPE>(set));
 }
 
 
@@ -1726,6 +4392,71 @@ Rule Is(const __CHARTYPE* phrase) {
   return new Primitives::ExactValidator<__CHARTYPE>(phrase);
 }
 
+/**
+ * @brief One of phrases, the first one matched wins 
+ * (like Is(phrases[0]) | Is(phrases[1]) | ...)
+ * 
+ * @tparam __CHARTYPE 
+ * @param phrases array of phrases
+ * @param count number of phrases
+ * @return Rule 
+ */
+template<typename __CHARTYPE>
+Rule Literals(const __CHARTYPE* const* phrases, size_t count) {
+  vector<vector<SChar> > decoded(count);
+  for (size_t i = 0; i < count; i++) {
+    if (phrases[i])
+      Utils::Decode(phrases[i], decoded[i]);
+  }
+  return new Primitives::TrieValidator(decoded
+        , vector<unsigned int>(count, 0));
+}
+
+/**
+ * @brief One of phrases, the first one matched wins 
+ * 
+ * @tparam __CHARTYPE 
+ * @param phrases 
+ * @return Rule 
+ */
+template<typename __CHARTYPE>
+Rule Literals(const vector<basic_string<__CHARTYPE> >& phrases) {
+  vector<vector<SChar> > decoded(phrases.size());
+  for (size_t i = 0; i < phrases.size(); i++)
+    Utils::Decode(phrases[i].c_str(), decoded[i]);
+  return new Primitives::TrieValidator(decoded
+        , vector<unsigned int>(phrases.size(), 0));
+}
+
+/**
+ * @brief merge a choice (Or) of phrases into a single trie, the rule is 
+ * returned as is if it is not a choice of phrases
+ * 
+ * @param choice 
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Literals(const Rule& choice);
+
+/**
+ * @brief a character of the Unicode general category, i.e. "Lu" or 
+ * "Uppercase_Letter", "L" for all the letters, "Nd" for the decimal 
+ * digits .. the names are matched loosely (case, spaces, '-' and '_' are
+ * ignored) and an unknown name matches nothing
+ * 
+ * @param name the short or the long name of the category
+ * @return Rule 
+ */
+DLL_PUBLIC Rule Category(const char* name);
+
+/**
+ * @brief a character of the Unicode script, i.e. "Arabic" or "Arab" .. 
+ * the names are matched loosely and an unknown name matches nothing
+ * 
+ * @param name the name or the four letters code of the script
+ * @return Rule 
+ */
+DLL_PUBLIC Rule Script(const char* name);
+
 /**
  * @brief Peek next rule
  * 
@@ -1742,6 +4473,90 @@ DLL_PUBLIC Rule LookAhead(const Rule& rule);
  */
 DLL_PUBLIC Rule LookBack(const Rule& rule);
 
+/**
+ * @brief Compile the rule into flat program 
+ * 
+ * @param rule 
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Compile(const Rule& rule);
+
+/**
+ * @brief write the rule as C++ source of a specialized parser, see 
+ * Engine::Generate()
+ * 
+ * @param rule the rule, all placeholders injected
+ * @param name the namespace of the generated code
+ * @param source receives the source
+ * @return false if the rule has no source form
+ */
+DLL_PUBLIC bool Generate(const Rule& rule, const char* name
+      , string* source);
+
+/**
+ * @brief Memoize the rule results (packrat parsing) 
+ * 
+ * @param rule 
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Memoize(const Rule& rule);
+
+/**
+ * @brief a cut point, once it is passed the innermost enclosing choice 
+ * (| or ||) does not try its remaining alternatives, i.e. 
+ * (Is("INVITE ") > Commit() > Invite) | Other fails instead of trying 
+ * Other when Invite fails. outside any choice the memoized outcomes 
+ * before the cursor are dropped (SPEG_MEMOIZE). repetitions never give 
+ * back what they matched, so they need no possessive form
+ * 
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC const Rule Commit();
+
+/**
+ * @brief rewrite the rule into an equivalent but cheaper one, i.e. 
+ * !!a into LookAhead(a), nested repetitions into a single one, chains of
+ * characters into a phrase and choices of phrases into a trie, identical
+ * subtrees are shared as by Share(). The rule should be complete (i.e. all placeholders are injected), referenced 
+ * rules are not rewritten
+ * 
+ * @param rule the rule to be optimized
+ * @param flags the flags the rule is matched with, nothing is rewritten
+ * under SPEG_MATCHUNNAMED and characters are not merged into phrases 
+ * under SPEG_IGNORESPACES
+ * @param report if not NULL, receives a line for every rewrite
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Optimize(const Rule& rule, unsigned long flags = 0
+      , vector<string>* report = NULL);
+
+/**
+ * @brief parse the regular subtrees of the rule (see 
+ * Engine::AutomatonValidator) through lazily built automata, the largest 
+ * such subtrees that have choices, sequences or repetitions are replaced 
+ * and the rest of the rule is kept. Searching a rule that is a single 
+ * automaton runs the search through the automaton as well, so both Test 
+ * and Search take linear time. The rule matches exactly as before
+ * 
+ * @param rule the rule, all placeholders injected
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Determinize(const Rule& rule);
+
+/**
+ * @brief merge the structurally identical subtrees of the rule into one 
+ * shared node (hash-consing), i.e. every Digit() of a grammar becomes the
+ * same node. The rule matches exactly as before, Optimize() does the 
+ * same while rewriting
+ * 
+ * @param rule the rule to be shared
+ * @return DLL_PUBLIC 
+ */
+DLL_PUBLIC Rule Share(const Rule& rule);
+
+// the builtin rules below are built once, on first use, and every call
+// returns the same shared nodes
+
 /**
  * @brief Any
  * 
@@ -1826,6 +4641,13 @@ DLL_PUBLIC const Rule EndOfLine();
  */
 DLL_PUBLIC const Rule WhiteSpace();
 
+/**
+ * @brief the characters of the Unicode White_Space property, SPACE, TAB,
+ * NEWLINE and the Unicode spaces and line separators
+ * 
+ */
+DLL_PUBLIC const Rule UnicodeWhiteSpace();
+
 /**
  * @brief One or more Whitespaces 
  * 
@@ -2083,7 +4905,18 @@ DLL_PUBLIC Rule IfMatched(const char* key
 template <typename __CHARTYPE>
 class Stringozzi {
   typedef basic_string<__CHARTYPE> STRING;
+  typedef Utils::Text<__CHARTYPE> TEXT;
   Core::Rule _rule;
+  Core::Rule _search;
+
+  static Utils::Status _Status(const Core::Context<__CHARTYPE>& context
+        , bool result) {
+    if (context.Invalid())
+      return Utils::ST_INVALID;
+    if (context.Exceeded())
+      return Utils::ST_EXCEEDED;
+    return result ? Utils::ST_MATCHED : Utils::ST_FAILED;
+  }
 
  public:
  /**
@@ -2091,21 +4924,40 @@ class Stringozzi {
   * 
   * @param rule the rule to be checked
   */
-  explicit Stringozzi(const Core::Rule& rule) : _rule(rule) {}
+  explicit Stringozzi(const Core::Rule& rule)
+    : _rule(rule)
+    , _search(Operators::Until(rule)) {}
 
  /**
  * @brief direct testing the string versus the rule ..
  *  no search conducted 
  * 
- * @param str the string to be validated 
+ * @param str the string to be validated, null terminated or of known 
+ *            length (Utils::Bounded, std::basic_string, string view)
  * @param flags parsing flags
  * @return true sucess
  * @return false otherwise
  */
-  bool Test(const __CHARTYPE* str, unsigned long flags = 0UL) {
-    RETURN_FALSE_IF_NULL(str);
+  bool Test(const TEXT& str, unsigned long flags = 0UL) {
+    RETURN_FALSE_IF_NULL(str.Begin);
     Core::Context<__CHARTYPE> context(str, flags);
-    return _rule.Check(&context);
+    return !context.Invalid() && _rule.Check(&context);
+  }
+
+ /**
+ * @brief direct testing the string versus the rule within limits
+ * 
+ * @param str the string to be validated 
+ * @param limits the steps and the deadline of the call
+ * @param flags parsing flags
+ * @return Utils::Status ST_EXCEEDED if the limits stopped the parsing
+ */
+  Utils::Status Test(const TEXT& str, const Utils::Limits& limits
+        , unsigned long flags = 0UL) {
+    RETURN_IF_NULL(str.Begin, Utils::ST_FAILED);
+    Core::Context<__CHARTYPE> context(str, flags, Utils::Budget(limits));
+    bool result = !context.Invalid() && _rule.Check(&context);
+    return _Status(context, result);
   }
 
 /**
@@ -2116,11 +4968,10 @@ class Stringozzi {
  * @return true in case of success
  * @return false otherwise
  */
-  bool FastMatch(const __CHARTYPE* str, unsigned long flags = 0UL) {
-    RETURN_FALSE_IF_NULL(str);
-    Utils::Matches<__CHARTYPE> _matches;
-    Core::Context<__CHARTYPE> context(str, flags, &_matches);
-    return _rule.Check(&context);
+  bool FastMatch(const TEXT& str, unsigned long flags = 0UL) {
+    RETURN_FALSE_IF_NULL(str.Begin);
+    Core::Context<__CHARTYPE> context(str, flags);
+    return !context.Invalid() && _rule.Check(&context);
   }
 
   /**
@@ -2131,11 +4982,26 @@ class Stringozzi {
    * @return true if found
    * @return false otherwise
    */
-  bool Search(const __CHARTYPE* str, unsigned long flags = 0) {
-    RETURN_FALSE_IF_NULL(str);
+  bool Search(const TEXT& str, unsigned long flags = 0) {
+    RETURN_FALSE_IF_NULL(str.Begin);
     Core::Context<__CHARTYPE> context(str, flags);
-    Core::Rule rule = Operators::Until(_rule);
-    return rule.Check(&context);
+    return !context.Invalid() && _search.Check(&context);
+  }
+
+  /**
+   * @brief Search the text for the specified rule within limits
+   * 
+   * @param str string to be found
+   * @param limits the steps and the deadline of the call
+   * @param flags parsing flags
+   * @return Utils::Status ST_EXCEEDED if the limits stopped the parsing
+   */
+  Utils::Status Search(const TEXT& str, const Utils::Limits& limits
+        , unsigned long flags = 0) {
+    RETURN_IF_NULL(str.Begin, Utils::ST_FAILED);
+    Core::Context<__CHARTYPE> context(str, flags, Utils::Budget(limits));
+    bool result = !context.Invalid() && _search.Check(&context);
+    return _Status(context, result);
   }
 
 
@@ -2147,13 +5013,11 @@ class Stringozzi {
    * @param flags parsing flags
    * @return const __CHARTYPE* pointer to the first occurance
    */
-  const __CHARTYPE* SearchAndGetPtr(const __CHARTYPE* str
+  const __CHARTYPE* SearchAndGetPtr(const TEXT& str
           , unsigned long flags = 0) {
-    RETURN_IF_NULL(str, NULL);
-    Utils::Matches<__CHARTYPE> matches;
+    RETURN_IF_NULL(str.Begin, NULL);
     Core::Context<__CHARTYPE> context(str, flags);
-    Core::Rule rule = Operators::Until(_rule);
-    if (rule.Check(&context))
+    if (!context.Invalid() && _search.Check(&context))
       return static_cast<const __CHARTYPE*>(context.GetPosition());
     else
       return NULL;
@@ -2168,14 +5032,12 @@ class Stringozzi {
  * @param flags parsing flags
  * @return size_t 
  */
-  size_t SearchAndGetIndex(const __CHARTYPE* str
+  size_t SearchAndGetIndex(const TEXT& str
             , unsigned long flags = 0) {
-    RETURN_IF_NULL(str, -1);
-    Utils::Matches<__CHARTYPE> _matches;
-    const Core::Context<__CHARTYPE> context(str, flags, &_matches);
-    Core::Rule rule = Operators::Until(_rule);
-    if (rule.Check(&context))
-      return static_cast<const __CHARTYPE*>(context->GetPosition()) - str;
+    RETURN_IF_NULL(str.Begin, -1);
+    Core::Context<__CHARTYPE> context(str, flags);
+    if (!context.Invalid() && _search.Check(&context))
+      return static_cast<const __CHARTYPE*>(context.GetPosition()) - str.Begin;
     else
       return -1;
   }
@@ -2189,20 +5051,49 @@ class Stringozzi {
  * @return true if success
  * @return false otherwise
  */
-  bool Match(const __CHARTYPE* str
+  bool Match(const TEXT& str
           , Utils::Matches<__CHARTYPE>& matches
           , unsigned long flags = 0) {
-    RETURN_FALSE_IF_NULL(str);
+    RETURN_FALSE_IF_NULL(str.Begin);
     flags = flags | SPEG_MATCHNAMED | SPEG_MATCHUNNAMED;
     const __CHARTYPE* ptr = SearchAndGetPtr(str, flags);
 
     RETURN_FALSE_IF_NULL(ptr);
-    Core::Context<__CHARTYPE> context(ptr, flags);
+    Core::Context<__CHARTYPE> context(str.From(ptr), flags);
     bool ret =  _rule.Check(&context);
     matches = context.Matches();
     return ret;
   }
 
+/**
+ * @brief search text for the rule within limits, if found .. it returns 
+ * all matches  
+ * 
+ * @param str string to be matched
+ * @param matches matches table object to be filled
+ * @param limits the steps and the deadline of the call
+ * @param flags parsing flags
+ * @return Utils::Status ST_EXCEEDED if the limits stopped the parsing
+ */
+  Utils::Status Match(const TEXT& str
+          , Utils::Matches<__CHARTYPE>& matches
+          , const Utils::Limits& limits
+          , unsigned long flags = 0) {
+    RETURN_IF_NULL(str.Begin, Utils::ST_FAILED);
+    flags = flags | SPEG_MATCHNAMED | SPEG_MATCHUNNAMED;
+    Core::Context<__CHARTYPE> search(str, flags, Utils::Budget(limits));
+    if (search.Invalid() || !_search.Check(&search))
+      return _Status(search, false);
+
+    Core::Context<__CHARTYPE> context(
+          str.From(static_cast<const __CHARTYPE*>(search.GetPosition()))
+          , flags, search.Remaining());
+    bool ret = _rule.Check(&context);
+    if (!context.Exceeded())
+      matches = context.Matches();
+    return _Status(context, ret);
+  }
+
 
 /**
  * @brief Search the text and replace the matched token with 
@@ -2214,29 +5105,58 @@ class Stringozzi {
  * @param count number of replacements
  * @return STRING the new string after replace
  */
-  STRING Replace(const __CHARTYPE* str, const __CHARTYPE* rep
+  STRING Replace(const TEXT& str, const __CHARTYPE* rep
     , unsigned long flags = 0
     , unsigned int count = 1 ) {
-    RETURN_IF_NULL(str, STRING());
-    RETURN_IF_NULL(rep, STRING());
+    STRING strobj;
+    Replace(str, rep, &strobj, Utils::Limits(), flags, count);
+    return strobj;
+  }
 
-    Core::Context<__CHARTYPE> context(str, flags);
-    Core::Position last_start = str;
-    Core::Rule rule = Operators::Until(_rule);
+/**
+ * @brief Search the text within limits and replace the matched token 
+ * with the specified string
+ * 
+ * @param str string to be checked
+ * @param rep replacement string
+ * @param out the new string after replace, it is not set if the limits 
+ *            stopped the parsing
+ * @param limits the steps and the deadline of the call
+ * @param flags parsing flags
+ * @param count number of replacements
+ * @return Utils::Status ST_EXCEEDED if the limits stopped the parsing
+ */
+  Utils::Status Replace(const TEXT& str, const __CHARTYPE* rep
+    , STRING* out
+    , const Utils::Limits& limits
+    , unsigned long flags = 0
+    , unsigned int count = 1 ) {
+    RETURN_IF_NULL(str.Begin, Utils::ST_FAILED);
+    RETURN_IF_NULL(rep, Utils::ST_FAILED);
+
+    Core::Context<__CHARTYPE> context(str, flags, Utils::Budget(limits));
+    if (context.Invalid())
+      return Utils::ST_INVALID;
+    const __CHARTYPE* last_start = str.Begin;
     STRING strobj;
 
-    for (unsigned int i = 0; i < count && rule.Check(&context); i++) {
+    unsigned int i = 0;
+    for (; i < count && _search.Check(&context); i++) {
       Core::Position start = context.GetPosition();
       _rule.Check(&context);
+      if (context.Exceeded())
+        break;
       Core::Position end = context.GetPosition();
-      strobj.append(static_cast<const __CHARTYPE*>(last_start)
-            , static_cast<const __CHARTYPE*>(start)
-            - static_cast<const __CHARTYPE*>(last_start));
+      strobj.append(last_start
+            , static_cast<const __CHARTYPE*>(start) - last_start);
       strobj.append(rep);
       last_start = static_cast<const __CHARTYPE*>(end);
     }
-    strobj.append(static_cast<const __CHARTYPE*>(last_start));
-    return strobj;
+    if (context.Exceeded())
+      return Utils::ST_EXCEEDED;
+    strobj.append(last_start, str.Length(last_start));
+    *out = strobj;
+    return i ? Utils::ST_MATCHED : Utils::ST_FAILED;
   }
 
 /**
@@ -2256,8 +5176,9 @@ class Stringozzi {
   RETURN_VOID_IF_NULL(str);
   RETURN_VOID_IF_NULL(rep);
   STRING ret = Replace(str, rep, flags, count);
-  memcpy(str, ret.c_str(), size* sizeof(__CHARTYPE));
-  str[size] = 0;
+  size_t length = MINIMUM(static_cast<size_t>(size), ret.length());
+  memcpy(str, ret.c_str(), length * sizeof(__CHARTYPE));
+  str[length] = 0;
 
   }
 
@@ -2272,35 +5193,65 @@ class Stringozzi {
  * @return true 
  * @return false 
  */
-  bool Split(__CHARTYPE* str, vector<STRING>& vector
+  bool Split(const TEXT& str, vector<STRING>& vector
     , unsigned long flags = 0
     , bool dropEmpty = true
     , unsigned int count = 1) {
-    RETURN_FALSE_IF_NULL(str);
+    RETURN_FALSE_IF_NULL(str.Begin);
+    Split(str, vector, Utils::Limits(), flags, dropEmpty, count);
+    return true;
+  }
 
-    Core::Context<__CHARTYPE> context(str, flags);
-    Core::Position last_start = str;
-    Core::Rule rule = Operators::Until(_rule);
+/**
+ * @brief Split the string within limits base on separator specified in 
+ * the rule  
+ * 
+ * @param str string to be splitted
+ * @param parts string array of parts, nothing is added if the limits 
+ *              stopped the parsing
+ * @param limits the steps and the deadline of the call
+ * @param flags parsing flags
+ * @param dropEmpty drop empty occurances
+ * @param count number of splitting operations (splits +1)
+ * @return Utils::Status ST_EXCEEDED if the limits stopped the parsing
+ */
+  Utils::Status Split(const TEXT& str, vector<STRING>& parts
+    , const Utils::Limits& limits
+    , unsigned long flags = 0
+    , bool dropEmpty = true
+    , unsigned int count = 1) {
+    RETURN_IF_NULL(str.Begin, Utils::ST_FAILED);
+
+    Core::Context<__CHARTYPE> context(str, flags, Utils::Budget(limits));
+    if (context.Invalid())
+      return Utils::ST_INVALID;
+    const __CHARTYPE* last_start = str.Begin;
     STRING result;
-    for (int i = 0; i < count && rule.Check(context); i++) {
+    vector<STRING> found;
+    unsigned int i = 0;
+    for (; i < count && _search.Check(&context); i++) {
       Core::Position start = context.GetPosition();
-      _rule.Check(context);
+      _rule.Check(&context);
+      if (context.Exceeded())
+        break;
       Core::Position end = context.GetPosition();
-      result.assign(static_cast<const __CHARTYPE*>(last_start)
-            , static_cast<const __CHARTYPE*>(start)
-            - static_cast<const __CHARTYPE*>(last_start));
+      result.assign(last_start
+            , static_cast<const __CHARTYPE*>(start) - last_start);
       if (!result.empty() || !dropEmpty)
-        vector.push_back(result);
-      last_start = end;
+        found.push_back(result);
+      last_start = static_cast<const __CHARTYPE*>(end);
     }
-    result.assign(static_cast<const __CHARTYPE*>(last_start));
-    vector.push_back(result);
-    return true;
+    if (context.Exceeded())
+      return Utils::ST_EXCEEDED;
+    result.assign(last_start, str.Length(last_start));
+    found.push_back(result);
+    parts.insert(parts.end(), found.begin(), found.end());
+    return i ? Utils::ST_MATCHED : Utils::ST_FAILED;
   }
 
-  vector<STRING> Split(__CHARTYPE* str) {
-    vector<string> vec;
-    RETURN_IF_NULL(str, vec);
+  vector<STRING> Split(const TEXT& str) {
+    vector<STRING> vec;
+    RETURN_IF_NULL(str.Begin, vec);
     Split(str, vec);
     return vec;
   }
@@ -2346,105 +5297,185 @@ namespace Operators {
  */
 namespace Actions {
   /**
-   * @brief Proxy to Stringozzi.Test
+   * @brief Proxy to Stringozzi.Test, the text may be a null terminated
+   * string, a Utils::Text, a std::basic_string or a string view
    * 
-   * @tparam __CHARTYPE 
+   * @tparam __TEXT 
    * @param rule 
    * @param text 
    * @param flags 
    * @return true 
    * @return false 
    */
-template<typename __CHARTYPE>
-bool Test(const Core::Rule& rule, const __CHARTYPE* text
+template<typename __TEXT>
+bool Test(const Core::Rule& rule, const __TEXT& text
             , unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(rule).Test(text, flags);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Test(text, flags);
+}
+
+/**
+ * @brief Proxy to Stringozzi.Test within limits
+ * 
+ * @tparam __TEXT 
+ * @param rule 
+ * @param text 
+ * @param limits 
+ * @param flags 
+ * @return Utils::Status 
+ */
+template<typename __TEXT>
+Utils::Status Test(const Core::Rule& rule, const __TEXT& text
+            , const Utils::Limits& limits, unsigned long flags = 0) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Test(text, limits, flags);
 }
 
 /**
  * @brief Proxy to Stringozzi.FastMatch
  * 
- * @tparam __CHARTYPE 
+ * @tparam __TEXT 
  * @param rule 
  * @param str 
  * @param flags 
  * @return true 
  * @return false 
  */
-template<typename __CHARTYPE>
-bool FastMatch(const Core::Rule& rule, const __CHARTYPE* str
+template<typename __TEXT>
+bool FastMatch(const Core::Rule& rule, const __TEXT& str
             , unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(rule).FastMatch(str, flags);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).FastMatch(str, flags);
 }
 
 /**
  * @brief Proxy to Stringozzi.Search
  * 
- * @tparam __CHARTYPE 
+ * @tparam __TEXT 
  * @param rule 
  * @param str 
  * @param flags 
  * @return true 
  * @return false 
  */
-template<typename __CHARTYPE>
-bool Search(const Core::Rule& rule, const __CHARTYPE* str
+template<typename __TEXT>
+bool Search(const Core::Rule& rule, const __TEXT& str
             , unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(rule).Search(str, flags);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Search(str, flags);
+}
+
+/**
+ * @brief Proxy to Stringozzi.Search within limits
+ * 
+ * @tparam __TEXT 
+ * @param rule 
+ * @param str 
+ * @param limits 
+ * @param flags 
+ * @return Utils::Status 
+ */
+template<typename __TEXT>
+Utils::Status Search(const Core::Rule& rule, const __TEXT& str
+            , const Utils::Limits& limits, unsigned long flags = 0) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Search(str, limits, flags);
 }
 
 
 /**
  * @brief Proxy to StringozziA::SearchAndGetPtr
  * 
- * @tparam __CHARTYPE 
+ * @tparam __TEXT 
  * @param _rule 
  * @param str 
  * @param flags 
- * @return const __CHARTYPE* 
- */
-template<typename __CHARTYPE>
-const __CHARTYPE* SearchAndGetPtr(const Core::Rule& _rule
-            , const __CHARTYPE* str, unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(_rule).SearchAndGetPtr(str, flags);
+ * @return const CHAR* 
+ */
+template<typename __TEXT>
+const typename Utils::TextTraits<__TEXT>::Char* SearchAndGetPtr(
+            const Core::Rule& _rule
+            , const __TEXT& str, unsigned long flags = 0) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).SearchAndGetPtr(str, flags);
 }
 
 /**
  * @brief Proxy to Stringozzi:: SearchAndGetIndex
  * 
- * @tparam __CHARTYPE 
+ * @tparam __TEXT 
  * @param _rule 
  * @param str 
  * @param flags 
  * @return size_t 
  */
-template<typename __CHARTYPE>
+template<typename __TEXT>
 size_t SearchAndGetIndex(const Core::Rule& _rule
-            , const __CHARTYPE* str, unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(_rule).SearchAndGetIndex(str, flags);
+            , const __TEXT& str, unsigned long flags = 0) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).SearchAndGetIndex(str, flags);
 }
 
-template<typename __CHARTYPE>
-bool Match(const Core::Rule& rule, const __CHARTYPE* str
-            , Utils::Matches<__CHARTYPE>& matches
+template<typename __TEXT>
+bool Match(const Core::Rule& rule, const __TEXT& str
+            , Utils::Matches<typename Utils::TextTraits<__TEXT>::Char>& matches
             , unsigned long flags = 0) {
-  return Stringozzi<__CHARTYPE>(rule).Match(str, matches, flags);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Match(str, matches, flags);
 }
 
-template<typename __CHARTYPE>
-basic_string<__CHARTYPE> Replace(const Core::Rule& _rule
-            , __CHARTYPE* str, const __CHARTYPE* rep, unsigned long flags = 0
+template<typename __TEXT>
+Utils::Status Match(const Core::Rule& rule, const __TEXT& str
+            , Utils::Matches<typename Utils::TextTraits<__TEXT>::Char>& matches
+            , const Utils::Limits& limits
+            , unsigned long flags = 0) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(rule).Match(str, matches, limits, flags);
+}
+
+template<typename __TEXT>
+basic_string<typename Utils::TextTraits<__TEXT>::Char> Replace(
+            const Core::Rule& _rule
+            , const __TEXT& str
+            , const typename Utils::TextTraits<__TEXT>::Char* rep
+            , unsigned long flags = 0
   , unsigned int count = 1) {
-  return Stringozzi<__CHARTYPE>(_rule).Replace(str, rep, flags, count);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).Replace(str, rep, flags, count);
 }
 
-template<typename __CHARTYPE>
-bool Split(const Core::Rule& _rule, __CHARTYPE* str
-  , vector<basic_string<__CHARTYPE> >& vec
+template<typename __TEXT>
+Utils::Status Replace(const Core::Rule& _rule
+            , const __TEXT& str
+            , const typename Utils::TextTraits<__TEXT>::Char* rep
+            , basic_string<typename Utils::TextTraits<__TEXT>::Char>* out
+            , const Utils::Limits& limits, unsigned long flags = 0
+  , unsigned int count = 1) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).Replace(str, rep, out, limits
+        , flags, count);
+}
+
+template<typename __TEXT>
+bool Split(const Core::Rule& _rule, const __TEXT& str
+  , vector<basic_string<typename Utils::TextTraits<__TEXT>::Char> >& vec
+  , unsigned long flags = 0
+  , bool dropEmpty = true
+  , unsigned int count = 1) {
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).Split(str, vec, flags, dropEmpty, count);
+}
+
+template<typename __TEXT>
+Utils::Status Split(const Core::Rule& _rule, const __TEXT& str
+  , vector<basic_string<typename Utils::TextTraits<__TEXT>::Char> >& vec
+  , const Utils::Limits& limits
   , unsigned long flags = 0
   , bool dropEmpty = true
   , unsigned int count = 1) {
-  return Stringozzi<__CHARTYPE>(_rule).Split(str, vec, flags, dropEmpty, count);
+  typedef typename Utils::TextTraits<__TEXT>::Char CHAR;
+  return Stringozzi<CHAR>(_rule).Split(str, vec, limits, flags
+        , dropEmpty, count);
 }
 
 }  // namespace Actions
@@ -0,0 +1,1179 @@
+// generated by tools/UnicodeProperties.pl from Unicode 14.0.0, do not edit
+#ifndef SRC_STRINGOZZI_PROPERTIES_H_
+#define SRC_STRINGOZZI_PROPERTIES_H_
+
+namespace SPEG {
+namespace Utils {
+
+// a property value, the Count deltas of PropertyDeltas from First
+struct Property {
+  const char* Name;
+  const char* Alias;
+  unsigned int First;
+  unsigned int Count;
+};
+
+// the boundaries of the ranges, each one is the delta from the previous
+// one and they alternate between the first character of a range and the
+// character after it .. a delta of 0xFFFF adds up with the next one
+static const unsigned short PropertyDeltas[] = {
+  65, 26, 101, 23, 1, 7, 33, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 3, 2,
+  1, 1, 1, 2, 1, 3, 2, 4, 1, 2, 1, 3,
+  3, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1,
+  2, 1, 1, 2, 1, 3, 1, 1, 1, 2, 3, 1,
+  7, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 2, 1, 1, 3, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 7, 2, 1, 2,
+  2, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1,
+  289, 1, 1, 1, 3, 1, 8, 1, 6, 1, 1, 3,
+  1, 1, 1, 2, 1, 17, 1, 9, 35, 1, 2, 3,
+  3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  5, 1, 2, 1, 1, 2, 2, 51, 48, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 38, 2889, 38, 1, 1, 5, 1, 722, 86,
+  2202, 43, 2, 3, 320, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  9, 8, 8, 6, 10, 8, 8, 8, 8, 6, 11, 1,
+  1, 1, 1, 1, 1, 1, 8, 8, 72, 4, 12, 4,
+  12, 4, 12, 5, 11, 4, 262, 1, 4, 1, 3, 3,
+  2, 3, 2, 1, 3, 5, 6, 1, 1, 1, 1, 1,
+  1, 4, 2, 4, 10, 2, 5, 1, 61, 1, 2684, 48,
+  48, 1, 1, 3, 2, 1, 1, 1, 1, 1, 1, 4,
+  1, 1, 2, 1, 8, 3, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1,
+  4, 1, 31053, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  19, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 135, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 10, 1, 1, 1,
+  1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1,
+  1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 5, 1, 5, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1,
+  6, 1, 5, 1, 1, 1, 28, 1, 22315, 26, 1221, 40,
+  136, 36, 156, 11, 1, 15, 1, 7, 1, 2, 1770, 51,
+  3053, 32, 21888, 32, 26016, 26, 26, 26, 26, 26, 26, 1,
+  1, 2, 2, 1, 2, 2, 2, 4, 1, 8, 26, 26,
+  26, 2, 1, 4, 2, 8, 1, 7, 27, 2, 1, 4,
+  1, 5, 1, 1, 3, 7, 27, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 30, 25, 33, 25, 33, 25,
+  33, 25, 33, 25, 33, 1, 4405, 34, 97, 26, 58, 1,
+  41, 24, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1,
+  2, 1, 3, 2, 4, 1, 2, 1, 3, 3, 2, 1,
+  2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1,
+  2, 1, 3, 1, 1, 1, 2, 2, 2, 3, 6, 1,
+  2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 2, 2, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 7, 2, 1, 2, 2, 1, 1,
+  4, 1, 1, 1, 1, 1, 1, 1, 1, 69, 1, 27,
+  193, 1, 1, 1, 3, 1, 3, 3, 18, 1, 27, 35,
+  1, 2, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 5, 1, 1, 2, 1, 2, 2, 51, 48,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 48, 41, 2887, 43, 2, 3,
+  760, 6, 2178, 9, 119, 44, 63, 13, 1, 34, 102, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 9, 8, 6, 10, 8, 8, 8,
+  8, 6, 10, 8, 8, 8, 8, 14, 2, 8, 8, 8,
+  8, 8, 8, 5, 1, 2, 6, 1, 3, 3, 1, 2,
+  8, 4, 2, 2, 8, 8, 10, 3, 1, 2, 274, 1,
+  3, 2, 3, 1, 27, 1, 4, 1, 4, 1, 2, 2,
+  8, 4, 4, 1, 53, 1, 2731, 48, 1, 1, 3, 2,
+  1, 1, 1, 1, 1, 1, 4, 1, 1, 2, 1, 6,
+  5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 2, 7, 1, 1, 1, 4, 1, 12, 38,
+  1, 1, 5, 1, 30995, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 19, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 135, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8,
+  1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 4, 1, 1, 1, 2, 1, 1, 3, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 5, 1, 5, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  4, 1, 1, 1, 6, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 28, 1, 3, 1, 821, 43, 5, 9, 7, 80,
+  20288, 7, 12, 5, 1065, 26, 1229, 40, 136, 36, 155, 11,
+  1, 15, 1, 7, 1, 2, 1795, 51, 3021, 32, 21888, 32,
+  26010, 26, 26, 7, 1, 18, 26, 26, 26, 4, 1, 1,
+  1, 7, 1, 11, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 25,
+  1, 6, 26, 25, 1, 6, 26, 25, 1, 6, 26, 25,
+  1, 6, 26, 25, 1, 6, 1, 1, 1844, 10, 1, 20,
+  2563, 34, 453, 1, 2, 1, 2, 1, 38, 1, 7573, 8,
+  8, 8, 8, 8, 12, 1, 15, 1, 47, 1, 688, 18,
+  4, 12, 14, 5, 7, 1, 1, 1, 133, 1, 5, 1,
+  478, 1, 230, 1, 164, 2, 269, 2, 4, 1, 31, 1,
+  9, 1, 3, 1, 160, 1, 167, 1, 1236, 1, 127, 1,
+  565, 1, 1754, 1, 107, 1, 611, 1, 464, 6, 174, 63,
+  13, 1, 34, 37, 689, 1, 13, 1, 16, 13, 3039, 2,
+  241, 1, 191, 1, 469, 1, 43, 5, 5, 1, 97, 2,
+  93, 3, 28438, 1, 1250, 6, 270, 1, 114, 1, 28, 2,
+  121, 9, 80, 1, 23, 1, 105, 3, 3, 2, 469, 1,
+  22, 1, 137, 1, 108, 1, 21, 2, 103, 4, 9, 1,
+  21510, 1, 45, 2, 2016, 6, 1, 42, 1, 9, 25477, 4,
+  1103, 13, 64, 2, 1, 1, 16396, 4, 1, 7, 1, 2,
+  12600, 7, 2061, 1, 170, 1, 15, 1, 256, 1, 4, 4,
+  208, 1, 827, 27, 4, 4, 45, 32, 1, 10, 35, 2,
+  1, 99, 1, 1, 24, 2, 10, 3, 2, 1, 16, 1,
+  1, 30, 29, 89, 11, 1, 24, 33, 21, 22, 42, 25,
+  7, 11, 5, 24, 1, 6, 17, 41, 59, 54, 3, 1,
+  18, 1, 7, 10, 16, 15, 4, 8, 2, 2, 2, 22,
+  1, 7, 1, 1, 3, 4, 3, 1, 16, 1, 13, 2,
+  1, 3, 14, 2, 10, 1, 8, 6, 4, 2, 2, 22,
+  1, 7, 1, 2, 1, 2, 1, 2, 31, 4, 1, 1,
+  19, 3, 16, 9, 1, 3, 1, 22, 1, 7, 1, 2,
+  1, 5, 3, 1, 18, 1, 15, 2, 23, 1, 11, 8,
+  2, 2, 2, 22, 1, 7, 1, 2, 1, 5, 3, 1,
+  30, 2, 1, 3, 15, 1, 17, 1, 1, 6, 3, 3,
+  1, 4, 3, 2, 1, 1, 1, 2, 3, 2, 3, 3,
+  3, 12, 22, 1, 52, 8, 1, 3, 1, 23, 1, 16,
+  3, 1, 26, 3, 2, 1, 2, 2, 30, 1, 4, 8,
+  1, 3, 1, 23, 1, 10, 1, 5, 3, 1, 31, 2,
+  1, 2, 15, 2, 17, 9, 1, 3, 1, 41, 2, 1,
+  16, 1, 5, 3, 8, 3, 24, 6, 5, 18, 3, 24,
+  1, 9, 1, 1, 2, 7, 58, 48, 1, 2, 12, 6,
+  59, 2, 1, 1, 1, 5, 1, 24, 1, 1, 1, 10,
+  1, 2, 9, 1, 2, 5, 23, 4, 32, 1, 63, 8,
+  1, 36, 27, 5, 115, 43, 20, 1, 16, 6, 4, 4,
+  3, 1, 3, 2, 7, 3, 4, 13, 12, 1, 113, 329,
+  1, 4, 2, 7, 1, 1, 1, 4, 2, 41, 1, 4,
+  2, 33, 1, 4, 2, 7, 1, 1, 1, 4, 2, 15,
+  1, 57, 1, 4, 2, 67, 37, 16, 113, 620, 2, 17,
+  1, 26, 5, 75, 6, 8, 7, 18, 13, 19, 14, 18,
+  14, 13, 1, 3, 15, 52, 40, 1, 67, 35, 1, 53,
+  7, 5, 2, 34, 1, 1, 5, 70, 10, 31, 49, 30,
+  2, 5, 11, 44, 4, 26, 54, 23, 9, 53, 176, 47,
+  17, 8, 54, 30, 13, 2, 10, 44, 26, 36, 41, 3,
+  10, 30, 113, 4, 1, 6, 1, 2, 3, 1, 1082, 4,
+  3063, 56, 24, 23, 9, 7, 1, 7, 1, 7, 1, 7,
+  1, 7, 1, 7, 1, 7, 1, 7, 551, 1, 53, 1,
+  4, 86, 8, 1, 1, 90, 4, 1, 5, 43, 1, 94,
+  17, 32, 48, 16, 512, 6592, 64, 21013, 1, 1143, 67, 40,
+  8, 268, 4, 16, 10, 2, 66, 1, 49, 70, 169, 1,
+  103, 1, 3, 7, 1, 3, 1, 4, 1, 23, 29, 52,
+  14, 50, 62, 6, 3, 1, 1, 2, 11, 28, 10, 23,
+  25, 29, 7, 47, 45, 5, 2, 9, 10, 5, 1, 41,
+  23, 3, 1, 8, 20, 16, 1, 6, 3, 1, 3, 50,
+  1, 1, 3, 2, 2, 5, 2, 1, 1, 1, 24, 2,
+  3, 11, 7, 1, 14, 6, 2, 6, 2, 6, 9, 7,
+  1, 7, 145, 35, 29, 11172, 12, 23, 4, 49, 8452, 366,
+  2, 106, 67, 1, 1, 10, 1, 13, 1, 5, 1, 1,
+  1, 2, 1, 2, 1, 108, 33, 363, 18, 64, 2, 54,
+  40, 12, 116, 5, 1, 135, 105, 10, 1, 45, 2, 31,
+  3, 6, 2, 6, 2, 6, 2, 3, 35, 12, 1, 26,
+  1, 19, 1, 2, 1, 15, 2, 14, 34, 123, 389, 29,
+  3, 49, 47, 32, 13, 20, 1, 8, 6, 38, 10, 30,
+  2, 36, 4, 8, 128, 78, 98, 40, 8, 52, 156, 311,
+  9, 22, 10, 8, 152, 6, 2, 1, 1, 44, 1, 2,
+  3, 1, 2, 23, 10, 23, 9, 31, 65, 19, 1, 2,
+  10, 22, 10, 26, 70, 56, 6, 2, 64, 1, 15, 4,
+  1, 3, 1, 29, 42, 29, 3, 29, 35, 8, 1, 28,
+  27, 54, 10, 22, 10, 19, 13, 18, 110, 73, 183, 36,
+  348, 42, 6, 2, 78, 29, 10, 1, 8, 22, 42, 18,
+  46, 21, 27, 23, 12, 53, 57, 2, 2, 1, 13, 45,
+  32, 25, 26, 36, 29, 1, 2, 1, 8, 35, 3, 1,
+  12, 48, 14, 4, 21, 1, 1, 1, 35, 18, 1, 25,
+  84, 7, 1, 1, 1, 4, 1, 15, 1, 10, 7, 47,
+  38, 8, 2, 2, 2, 22, 1, 7, 1, 2, 1, 5,
+  3, 1, 18, 1, 12, 5, 158, 53, 18, 4, 20, 3,
+  30, 48, 20, 2, 1, 1, 184, 47, 41, 4, 36, 48,
+  20, 1, 59, 43, 13, 1, 71, 27, 37, 7, 185, 44,
+  211, 8, 2, 1, 2, 8, 1, 2, 1, 24, 15, 1,
+  1, 1, 94, 8, 2, 39, 16, 1, 1, 1, 28, 1,
+  10, 40, 7, 1, 21, 1, 11, 46, 19, 1, 18, 73,
+  263, 9, 1, 37, 17, 1, 49, 30, 112, 7, 1, 2,
+  1, 38, 21, 1, 25, 6, 1, 2, 1, 32, 14, 1,
+  327, 19, 189, 1, 79, 922, 230, 196, 2636, 97, 15, 1071,
+  4049, 583, 8633, 569, 7, 31, 17, 79, 17, 30, 18, 48,
+  51, 21, 5, 19, 880, 75, 5, 1, 175, 6136, 8, 1238,
+  42, 9, 8951, 291, 45, 3, 17, 4, 8, 396, 2308, 107,
+  5, 13, 3, 9, 7, 10, 8816, 1, 501, 45, 33, 1,
+  321, 30, 18, 44, 1268, 7, 1, 4, 1, 2, 1, 15,
+  1, 197, 1339, 4, 1, 27, 1, 2, 1, 1, 2, 1,
+  1, 10, 1, 4, 1, 1, 1, 1, 6, 1, 4, 1,
+  1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+  2, 4, 1, 7, 1, 4, 1, 4, 1, 1, 1, 10,
+  1, 17, 5, 3, 1, 5, 1, 17, 4420, 42720, 32, 4153,
+  7, 222, 2, 5762, 14, 7473, 3103, 542, 1506, 4939, 768, 112,
+  275, 5, 265, 45, 1, 1, 1, 2, 1, 2, 1, 1,
+  72, 11, 48, 21, 16, 1, 101, 7, 2, 6, 2, 2,
+  1, 4, 35, 1, 30, 27, 91, 11, 58, 9, 9, 1,
+  24, 4, 1, 9, 1, 3, 1, 5, 43, 3, 60, 8,
+  42, 24, 1, 32, 55, 1, 1, 1, 4, 8, 4, 1,
+  3, 7, 10, 2, 29, 1, 58, 1, 4, 4, 8, 1,
+  20, 2, 26, 1, 2, 2, 57, 1, 4, 2, 4, 2,
+  2, 3, 3, 1, 30, 2, 3, 1, 11, 2, 57, 1,
+  4, 5, 1, 2, 4, 1, 20, 2, 22, 6, 1, 1,
+  58, 1, 2, 1, 1, 4, 8, 1, 7, 2, 11, 2,
+  30, 1, 61, 1, 12, 1, 50, 1, 3, 1, 55, 1,
+  1, 3, 5, 3, 1, 4, 7, 2, 11, 2, 29, 1,
+  58, 1, 2, 1, 6, 1, 5, 2, 20, 2, 28, 2,
+  57, 2, 4, 4, 8, 1, 20, 2, 29, 1, 72, 1,
+  7, 3, 1, 1, 90, 1, 2, 7, 12, 8, 98, 1,
+  2, 9, 11, 6, 74, 2, 27, 1, 1, 1, 1, 1,
+  55, 14, 1, 5, 1, 2, 5, 11, 1, 36, 9, 1,
+  102, 4, 1, 6, 1, 2, 2, 2, 25, 2, 4, 3,
+  16, 4, 13, 1, 2, 2, 6, 1, 15, 1, 703, 3,
+  946, 3, 29, 2, 30, 2, 30, 2, 64, 2, 1, 7,
+  8, 1, 2, 11, 9, 1, 45, 3, 1, 1, 117, 2,
+  34, 1, 118, 3, 4, 2, 9, 1, 6, 3, 219, 2,
+  2, 1, 58, 1, 1, 7, 1, 1, 1, 1, 2, 8,
+  6, 10, 2, 1, 48, 14, 1, 16, 49, 4, 48, 1,
+  1, 5, 1, 1, 5, 1, 40, 9, 12, 2, 32, 4,
+  2, 2, 1, 3, 56, 1, 1, 2, 3, 1, 1, 3,
+  58, 8, 2, 2, 152, 3, 1, 13, 1, 7, 4, 1,
+  6, 1, 3, 2, 198, 64, 720, 13, 4, 1, 3, 12,
+  3070, 3, 141, 1, 96, 32, 554, 4, 107, 2, 30164, 1,
+  4, 10, 32, 2, 80, 2, 272, 1, 3, 1, 4, 1,
+  25, 2, 5, 1, 151, 2, 26, 18, 13, 1, 38, 8,
+  25, 11, 46, 3, 48, 1, 2, 4, 2, 2, 39, 1,
+  67, 6, 2, 2, 2, 2, 12, 1, 8, 1, 47, 1,
+  51, 1, 1, 3, 2, 2, 5, 2, 1, 1, 42, 2,
+  8, 1, 238, 1, 2, 1, 4, 1, 20272, 1, 737, 16,
+  16, 16, 973, 1, 226, 1, 149, 5, 1670, 3, 1, 2,
+  5, 4, 40, 3, 4, 1, 165, 2, 573, 4, 387, 2,
+  153, 11, 49, 4, 123, 1, 54, 15, 41, 1, 2, 2,
+  10, 3, 49, 4, 2, 2, 7, 1, 61, 3, 36, 5,
+  1, 8, 62, 1, 12, 2, 52, 9, 10, 4, 2, 1,
+  95, 3, 2, 1, 1, 2, 6, 1, 160, 1, 3, 8,
+  21, 2, 57, 2, 3, 1, 37, 7, 3, 5, 195, 8,
+  2, 3, 1, 1, 23, 1, 84, 6, 1, 1, 4, 2,
+  1, 2, 238, 4, 6, 2, 1, 2, 27, 2, 85, 8,
+  2, 1, 1, 2, 106, 1, 1, 1, 2, 6, 1, 1,
+  101, 3, 2, 4, 1, 5, 259, 9, 1, 2, 256, 2,
+  1, 1, 4, 1, 144, 4, 2, 2, 4, 1, 32, 10,
+  40, 6, 2, 4, 8, 1, 9, 6, 2, 3, 46, 13,
+  1, 2, 406, 7, 1, 6, 1, 1, 82, 22, 2, 7,
+  1, 2, 1, 2, 122, 6, 3, 1, 1, 2, 1, 7,
+  1, 1, 72, 2, 3, 1, 1, 1, 347, 2, 19451, 5,
+  59, 7, 1048, 1, 63, 4, 81, 1, 19640, 2, 4705, 46,
+  2, 23, 544, 3, 17, 8, 2, 7, 30, 4, 148, 3,
+  1979, 55, 4, 50, 8, 1, 14, 1, 22, 5, 1, 15,
+  1360, 7, 1, 17, 2, 7, 1, 2, 1, 5, 261, 7,
+  375, 1, 61, 4, 1504, 7, 109, 7, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6081, 240, 2307, 1,
+  55, 1, 2, 3, 8, 4, 1, 2, 50, 2, 58, 3,
+  6, 2, 2, 2, 10, 1, 43, 1, 58, 3, 66, 1,
+  58, 3, 8, 1, 1, 2, 53, 2, 58, 1, 1, 1,
+  6, 2, 2, 2, 10, 1, 102, 2, 1, 2, 3, 3,
+  1, 3, 10, 1, 41, 3, 61, 4, 61, 2, 58, 1,
+  1, 5, 2, 2, 1, 2, 9, 2, 43, 2, 58, 3,
+  5, 3, 1, 3, 10, 1, 42, 2, 75, 3, 6, 8,
+  18, 2, 330, 2, 63, 1, 171, 2, 4, 1, 6, 1,
+  2, 2, 25, 2, 10, 3, 2, 7, 21, 2, 2, 6,
+  2, 1, 10, 3, 1656, 1, 30, 1, 129, 1, 7, 8,
+  1, 2, 346, 4, 2, 3, 4, 2, 1, 6, 224, 2,
+  58, 1, 1, 1, 9, 1, 1, 2, 8, 6, 145, 1,
+  48, 1, 5, 1, 1, 5, 1, 2, 61, 1, 30, 1,
+  4, 2, 2, 1, 60, 1, 2, 3, 1, 1, 3, 2,
+  48, 8, 8, 2, 171, 1, 21, 1, 4918, 2, 30707, 2,
+  2, 1, 88, 2, 50, 16, 142, 2, 47, 1, 48, 2,
+  4, 2, 2, 3, 110, 2, 2, 2, 24, 1, 45, 1,
+  1, 1, 109, 1, 2, 2, 5, 1, 237, 2, 1, 2,
+  1, 2, 1, 1, 25619, 1, 1, 1, 127, 1, 45, 3,
+  4, 2, 115, 1, 24, 2, 59, 1, 48, 3, 9, 2,
+  13, 1, 93, 3, 3, 2, 1, 1, 170, 3, 31, 2,
+  58, 2, 1, 4, 2, 2, 2, 3, 9, 1, 10, 2,
+  209, 3, 8, 2, 3, 1, 106, 3, 6, 1, 1, 4,
+  2, 1, 237, 3, 6, 4, 2, 1, 113, 3, 8, 2,
+  1, 1, 109, 1, 1, 2, 6, 1, 105, 2, 4, 1,
+  261, 3, 9, 1, 247, 6, 1, 2, 4, 1, 2, 1,
+  1, 1, 142, 3, 8, 4, 4, 1, 84, 1, 29, 2,
+  62, 1, 407, 1, 14, 1, 106, 1, 7, 1, 2, 1,
+  213, 5, 4, 2, 1, 1, 350, 2, 20570, 55, 104, 2,
+  24947, 2, 6, 6, 1160, 2, 5684, 1, 1566, 4, 1, 3,
+  34187, 3, 48, 10, 1574, 10, 134, 10, 198, 10, 412, 10,
+  118, 10, 118, 10, 118, 10, 118, 10, 118, 10, 118, 10,
+  118, 10, 118, 10, 118, 10, 96, 10, 118, 10, 70, 10,
+  278, 10, 70, 10, 1862, 10, 38, 10, 300, 10, 128, 10,
+  166, 10, 6, 10, 182, 10, 86, 10, 134, 10, 6, 10,
+  35270, 10, 678, 10, 38, 10, 198, 10, 22, 10, 86, 10,
+  406, 10, 21270, 10, 1414, 10, 2182, 10, 812, 10, 128, 10,
+  60, 10, 144, 10, 278, 10, 342, 10, 118, 10, 374, 10,
+  102, 10, 102, 10, 422, 10, 102, 10, 758, 10, 246, 10,
+  70, 10, 19638, 10, 86, 10, 134, 10, 27764, 50, 2368, 10,
+  422, 10, 1622, 10, 4758, 10, 5870, 3, 2671, 35, 2, 4,
+  3710, 1, 25, 9, 14, 3, 30379, 10, 23120, 53, 460, 1,
+  8, 1, 134, 5, 8234, 111, 178, 2, 5, 1, 2, 3,
+  2357, 6, 376, 6, 120, 3, 133, 7, 217, 7, 17, 9,
+  433, 10, 1077, 20, 1139, 10, 480, 1, 1685, 1, 3, 6,
+  6, 10, 198, 16, 41, 1, 726, 60, 78, 22, 630, 30,
+  1385, 1, 1172, 4, 138, 10, 30, 8, 1, 15, 32, 10,
+  39, 15, 30064, 6, 22737, 45, 65, 4, 17, 2, 341, 27,
+  36, 4, 1332, 8, 25, 7, 39, 9, 75, 5, 22, 6,
+  160, 2, 2, 16, 2, 46, 64, 9, 52, 2, 30, 3,
+  75, 5, 104, 8, 24, 8, 41, 7, 330, 6, 352, 31,
+  158, 10, 42, 4, 112, 7, 134, 20, 379, 20, 1349, 2,
+  430, 9, 871, 19, 851, 21, 19334, 7, 798, 23, 25673, 20,
+  108, 25, 5454, 9, 929, 59, 1, 3, 1, 4, 76, 45,
+  1, 15, 962, 13, 95, 1, 8159, 2, 19, 1, 56798, 2,
+  24, 3, 239, 1, 45, 1, 1372, 1, 51, 1, 3649, 1,
+  1029, 1, 2057, 6, 3585, 1, 2, 1, 31, 2, 4, 1,
+  28, 1, 446, 1, 19, 1, 111, 1, 52624, 2, 37, 1,
+  10, 1, 169, 1, 3999, 1, 40, 1, 50, 1, 31, 1,
+  3774, 1, 1, 1, 1886, 1, 2430, 1, 3, 1, 38, 1,
+  55, 1, 15, 1, 634, 1, 1, 1, 30, 1, 1086, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  80, 1, 32, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  404, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 64, 1,
+  1, 1, 33, 1, 1061, 1, 1, 1, 1, 1, 1, 1,
+  25, 1, 18, 1, 1, 1, 1, 1, 1, 1, 428, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1,
+  1, 1, 1, 1, 2, 1, 52513, 1, 215, 1, 29, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 3, 1, 17, 1, 1, 1, 1, 1, 170, 1,
+  50, 1, 31, 1, 3, 1, 2, 1, 41, 1, 51, 1,
+  31, 1, 3773, 1, 1, 1, 1886, 1, 2473, 1, 55, 1,
+  15, 1, 634, 1, 1, 1, 30, 1, 1086, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 80, 1,
+  32, 1, 1, 1, 1, 1, 1, 1, 1, 1, 404, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 64, 1, 1, 1,
+  33, 1, 1061, 1, 1, 1, 1, 1, 1, 1, 44, 1,
+  1, 1, 1, 1, 1, 1, 428, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1,
+  2, 2, 52510, 1, 217, 1, 29, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1,
+  17, 1, 1, 1, 1, 1, 170, 1, 51, 1, 31, 1,
+  2, 1, 2, 1, 171, 1, 8044, 1, 2, 2, 2, 1,
+  25, 1, 3528, 1, 1, 1, 4, 1, 2, 1, 15, 1,
+  3, 1, 187, 1, 8029, 1, 3, 1, 28, 1, 3528, 1,
+  1, 1, 4, 1, 2, 1, 15, 1, 3, 1, 33, 3,
+  1, 3, 2, 1, 1, 1, 1, 2, 10, 2, 3, 2,
+  27, 1, 68, 1, 5, 1, 14, 2, 7, 1, 702, 1,
+  8, 1, 466, 6, 41, 1, 54, 1, 2, 1, 2, 1,
+  44, 2, 20, 2, 1, 2, 13, 1, 1, 3, 74, 4,
+  102, 1, 43, 14, 233, 3, 54, 15, 31, 1, 261, 2,
+  10, 1, 140, 1, 120, 1, 121, 1, 390, 1, 12, 1,
+  367, 1, 90, 1, 10, 2, 168, 15, 1, 1, 112, 1,
+  74, 5, 4, 2, 111, 6, 171, 1, 612, 9, 773, 1,
+  124, 3, 71, 2, 157, 3, 1, 3, 37, 6, 1, 4,
+  313, 2, 216, 2, 128, 7, 1, 6, 172, 7, 28, 2,
+  125, 4, 59, 5, 62, 2, 64, 8, 11, 1, 834, 2,
+  8, 8, 8, 9, 2, 4, 2, 3, 3, 11, 1, 1,
+  1, 10, 3226, 4, 1, 2, 112, 1, 143, 2, 4, 3,
+  2, 1, 2, 9, 1, 2, 1, 1, 2, 2, 10, 5,
+  1, 10, 2, 4, 1, 1, 1, 13, 2, 3, 428, 3,
+  57, 1, 189, 1, 29698, 2, 269, 3, 99, 1, 10, 1,
+  115, 6, 380, 4, 86, 2, 40, 3, 1, 1, 49, 2,
+  47, 1, 97, 13, 16, 2, 124, 4, 126, 2, 16, 2,
+  249, 1, 21028, 7, 2, 1, 22, 1, 20, 2, 2, 4,
+  3, 3, 1, 4, 7, 3, 6, 1, 1, 2, 149, 3,
+  1, 3, 2, 1, 1, 1, 1, 2, 10, 2, 3, 2,
+  27, 1, 36, 1, 2, 2, 410, 3, 668, 1, 48, 1,
+  414, 1, 743, 1, 199, 1, 31, 1, 272, 9, 38, 1,
+  112, 7, 66, 7, 89, 4, 952, 5, 44, 4, 189, 7,
+  109, 2, 1, 4, 126, 4, 48, 2, 79, 4, 4, 1,
+  13, 1, 1, 3, 88, 6, 107, 1, 417, 5, 10, 2,
+  1, 1, 104, 1, 250, 23, 105, 3, 28, 13, 76, 1,
+  130, 3, 252, 1, 264, 3, 155, 1, 92, 8, 83, 3,
+  1, 5, 414, 5, 42, 2, 645, 2, 262, 1, 1136, 5,
+  2940, 2, 14971, 2, 133, 1, 65, 5, 8, 1, 850, 4,
+  327, 1, 19644, 1, 7655, 5, 3794, 2, 43, 1, 16, 3,
+  61, 1, 1, 1, 45, 1, 4, 1, 37, 1, 31, 1,
+  766, 1, 527, 3, 6715, 1, 13, 1, 39, 3, 13, 3,
+  139, 1, 39, 5, 6, 1, 68, 5, 5, 2, 4, 1,
+  2, 1, 2, 1, 7, 1, 31, 2, 2, 1, 1, 1,
+  31, 268, 32, 2, 90, 1, 30, 25, 40, 6, 469, 1,
+  9, 1, 54, 8, 111, 1, 336, 5, 2, 31, 10, 16,
+  256, 131, 22, 63, 4, 32, 2, 258, 48, 21, 2, 6,
+  53212, 1, 824, 1, 1, 3, 164, 1, 16, 3, 61, 1,
+  1, 1, 131, 1, 6, 4, 54996, 1, 25, 1, 31, 1,
+  25, 1, 31, 1, 25, 1, 31, 1, 25, 1, 31, 1,
+  25, 1, 5932, 2, 36, 1, 125, 4, 1257, 1, 123, 1,
+  498, 2, 498, 2, 7, 1, 245, 1, 263, 1, 581, 1,
+  2459, 1, 2244, 33, 34679, 1, 21955, 1, 108, 1, 154, 1,
+  219, 2, 3, 2, 8182, 4, 49950, 1, 2480, 1, 94, 1,
+  1, 1, 71, 1, 6, 1, 4, 1, 3, 1, 521, 4,
+  12, 14, 5, 7, 1, 1, 1, 17, 117, 1, 14, 2,
+  1282, 1, 5940, 1, 1, 3, 11, 3, 13, 3, 13, 3,
+  13, 2, 4252, 2, 30307, 23, 9, 2, 103, 2, 976, 1,
+  14, 2, 20550, 17, 891, 1, 1, 1, 162, 1, 62487, 5,
+  166, 1, 2, 1, 4, 1, 1, 1, 977, 1, 266, 2,
+  127, 2, 206, 1, 10, 1, 19, 2, 247, 1, 515, 1,
+  373, 1, 130, 6, 1, 1, 132, 1, 207, 1, 41, 1,
+  391, 3, 15, 1, 1, 3, 2, 6, 20, 1, 1, 1,
+  1, 1, 133, 8, 1, 6, 1, 2, 5, 4, 197, 2,
+  752, 10, 723, 1, 722, 1, 157, 34, 353, 10, 9, 9,
+  1411, 2, 1, 4, 1, 2, 10, 1, 1, 2, 6, 6,
+  1, 1, 1, 1, 1, 1, 4, 1, 11, 2, 14, 1,
+  1, 2, 1, 1, 58, 2, 9, 5, 2, 4, 1, 2,
+  1, 2, 1, 7, 1, 31, 2, 2, 1, 1, 1, 31,
+  268, 8, 4, 20, 2, 7, 2, 81, 1, 30, 25, 40,
+  6, 69, 25, 11, 81, 78, 22, 183, 1, 9, 1, 54,
+  8, 111, 1, 248, 44, 44, 64, 256, 512, 48, 21, 2,
+  6, 39, 2, 32, 1, 105, 229, 6, 357, 2, 46, 26,
+  1, 89, 12, 214, 26, 12, 8, 1, 13, 2, 12, 1,
+  21, 2, 6, 2, 336, 2, 4, 10, 32, 36, 28, 31,
+  11, 30, 8, 1, 15, 32, 10, 39, 15, 320, 6592, 64,
+  22160, 55, 865, 4, 10, 2, 1, 1, 573, 3, 21190, 16,
+  127, 1, 45, 3, 484, 1, 3, 1, 4, 2, 13, 2,
+  313, 9, 57, 17, 2, 3, 1, 13, 3, 1, 47, 45,
+  1658, 2, 591, 1, 3190, 1, 2197, 8, 4, 17, 19274, 4,
+  5, 1, 20822, 1, 4787, 116, 60, 246, 10, 39, 2, 60,
+  5, 3, 22, 2, 7, 30, 4, 61, 21, 66, 3, 1,
+  186, 87, 1193, 512, 55, 4, 50, 8, 1, 14, 1, 2,
+  1736, 1, 2908, 1, 129, 1, 721, 44, 4, 100, 12, 15,
+  2, 15, 1, 15, 1, 37, 23, 161, 56, 29, 13, 44,
+  4, 9, 7, 2, 14, 6, 154, 251, 5, 728, 5, 16,
+  3, 13, 3, 116, 12, 89, 7, 12, 4, 1, 15, 12,
+  4, 56, 8, 10, 6, 40, 8, 30, 2, 2, 78, 340,
+  12, 14, 2, 5, 3, 5, 3, 7, 9, 29, 3, 11,
+  5, 6, 10, 10, 6, 8, 8, 7, 9, 147, 1, 55,
+  32, 1, 127, 1, 5599, 1, 2431, 11, 36, 1, 47, 1,
+  4000, 1, 8232, 1, 8233, 1, 0, 32, 95, 33, 173, 1,
+  1362, 6, 22, 1, 192, 1, 49, 1, 384, 2, 80, 1,
+  3883, 1, 2044, 5, 26, 5, 49, 5, 1, 10, 56975, 1,
+  249, 3, 4289, 1, 15, 1, 9058, 9, 34919, 4, 5327, 8,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  11922, 1, 30, 96, 55296, 2048, 57344, 6400, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1806, 65534,
+  2, 65534, 888, 2, 6, 4, 7, 1, 1, 1, 20, 1,
+  397, 1, 38, 2, 50, 2, 3, 1, 55, 8, 27, 4,
+  6, 11, 270, 1, 60, 2, 101, 14, 59, 2, 49, 2,
+  15, 1, 28, 2, 1, 1, 11, 5, 31, 1, 2, 6,
+  236, 1, 8, 2, 2, 2, 22, 1, 7, 1, 1, 3,
+  4, 2, 9, 2, 2, 2, 4, 8, 1, 4, 2, 1,
+  5, 2, 25, 2, 3, 1, 6, 4, 2, 2, 22, 1,
+  7, 1, 2, 1, 2, 1, 2, 2, 1, 1, 5, 4,
+  2, 2, 3, 3, 1, 7, 4, 1, 1, 7, 17, 10,
+  3, 1, 9, 1, 3, 1, 22, 1, 7, 1, 2, 1,
+  5, 2, 10, 1, 3, 1, 3, 2, 1, 15, 4, 2,
+  12, 7, 7, 1, 3, 1, 8, 2, 2, 2, 22, 1,
+  7, 1, 2, 1, 5, 2, 9, 2, 2, 2, 3, 7,
+  3, 4, 2, 1, 5, 2, 18, 10, 2, 1, 6, 3,
+  3, 1, 4, 3, 2, 1, 1, 1, 2, 3, 2, 3,
+  3, 3, 12, 4, 5, 3, 3, 1, 4, 2, 1, 6,
+  1, 14, 21, 5, 13, 1, 3, 1, 23, 1, 16, 2,
+  9, 1, 3, 1, 4, 7, 2, 1, 3, 2, 1, 2,
+  4, 2, 10, 7, 22, 1, 3, 1, 23, 1, 10, 1,
+  5, 2, 9, 1, 3, 1, 4, 7, 2, 6, 2, 1,
+  4, 2, 10, 1, 2, 13, 13, 1, 3, 1, 51, 1,
+  3, 1, 6, 4, 16, 2, 26, 1, 3, 1, 18, 3,
+  24, 1, 9, 1, 1, 2, 7, 3, 1, 4, 6, 1,
+  1, 1, 8, 6, 10, 2, 3, 12, 58, 4, 29, 37,
+  2, 1, 1, 1, 5, 1, 24, 1, 1, 1, 23, 2,
+  5, 1, 1, 1, 6, 2, 10, 2, 4, 32, 72, 1,
+  36, 4, 39, 1, 36, 1, 15, 1, 13, 37, 198, 1,
+  1, 5, 1, 2, 377, 1, 4, 2, 7, 1, 1, 1,
+  4, 2, 41, 1, 4, 2, 33, 1, 4, 2, 7, 1,
+  1, 1, 4, 2, 15, 1, 57, 1, 4, 2, 67, 2,
+  32, 3, 26, 6, 86, 2, 6, 2, 669, 3, 89, 7,
+  22, 9, 24, 9, 20, 12, 13, 1, 3, 1, 2, 12,
+  94, 2, 10, 6, 10, 6, 26, 6, 89, 7, 43, 5,
+  70, 10, 31, 1, 12, 4, 12, 4, 1, 3, 42, 2,
+  5, 11, 44, 4, 26, 6, 11, 3, 62, 2, 65, 1,
+  29, 2, 11, 6, 10, 6, 14, 2, 31, 49, 77, 3,
+  47, 1, 116, 8, 60, 3, 15, 3, 60, 7, 43, 2,
+  11, 8, 43, 5, 534, 2, 6, 2, 38, 2, 6, 2,
+  8, 1, 1, 1, 1, 1, 1, 1, 31, 2, 53, 1,
+  15, 1, 14, 2, 6, 1, 19, 2, 3, 1, 9, 1,
+  101, 1, 12, 2, 27, 1, 13, 3, 33, 15, 33, 15,
+  140, 4, 663, 25, 11, 21, 1812, 2, 32, 1, 349, 5,
+  45, 1, 1, 5, 1, 2, 56, 7, 2, 14, 24, 9,
+  7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1,
+  7, 1, 7, 1, 126, 34, 26, 1, 89, 12, 214, 26,
+  12, 4, 64, 1, 86, 2, 103, 5, 43, 1, 94, 1,
+  84, 12, 47, 1, 29293, 3, 55, 9, 348, 20, 184, 8,
+  203, 5, 2, 1, 1, 1, 5, 24, 59, 3, 10, 6,
+  56, 8, 70, 8, 12, 6, 116, 11, 30, 3, 78, 1,
+  11, 4, 33, 1, 55, 9, 14, 2, 10, 2, 103, 24,
+  28, 10, 6, 2, 6, 2, 6, 9, 7, 1, 7, 1,
+  60, 4, 126, 2, 10, 6, 11172, 12, 23, 4, 49, 4,
+  8814, 2, 106, 38, 7, 12, 5, 5, 26, 1, 5, 1,
+  1, 1, 2, 1, 2, 1, 125, 16, 445, 2, 54, 7,
+  1, 32, 42, 6, 51, 1, 19, 1, 4, 4, 5, 1,
+  135, 2, 1, 1, 190, 3, 6, 2, 6, 2, 6, 2,
+  3, 3, 7, 1, 7, 10, 5, 2, 12, 1, 26, 1,
+  19, 1, 2, 1, 15, 2, 14, 34, 123, 5, 3, 4,
+  45, 3, 88, 1, 13, 3, 1, 47, 46, 130, 29, 3,
+  49, 15, 28, 4, 36, 9, 30, 5, 43, 5, 30, 1,
+  37, 4, 14, 42, 158, 2, 10, 6, 36, 4, 36, 4,
+  40, 8, 52, 11, 12, 1, 15, 1, 7, 1, 2, 1,
+  11, 1, 15, 1, 7, 1, 2, 67, 311, 9, 22, 10,
+  8, 24, 6, 1, 42, 1, 9, 69, 6, 2, 1, 1,
+  44, 1, 2, 3, 1, 2, 23, 1, 72, 8, 9, 48,
+  19, 1, 2, 5, 33, 3, 27, 5, 1, 64, 56, 4,
+  20, 2, 50, 1, 2, 5, 8, 1, 3, 1, 29, 2,
+  3, 4, 10, 7, 9, 7, 64, 32, 39, 4, 12, 9,
+  54, 3, 29, 2, 27, 5, 26, 7, 4, 12, 7, 80,
+  73, 55, 51, 13, 51, 7, 46, 8, 10, 294, 31, 1,
+  42, 1, 3, 2, 2, 78, 40, 8, 42, 22, 26, 38,
+  28, 20, 23, 9, 78, 4, 36, 9, 68, 10, 1, 2,
+  25, 7, 10, 6, 53, 1, 18, 8, 39, 9, 96, 1,
+  20, 11, 18, 1, 44, 65, 7, 1, 1, 1, 4, 1,
+  15, 1, 11, 6, 59, 5, 10, 6, 4, 1, 8, 2,
+  2, 2, 22, 1, 7, 1, 2, 1, 5, 1, 10, 2,
+  2, 2, 3, 2, 1, 6, 1, 5, 7, 2, 7, 3,
+  5, 139, 92, 1, 5, 30, 72, 8, 10, 166, 54, 2,
+  38, 34, 69, 11, 10, 6, 13, 19, 58, 6, 10, 54,
+  27, 2, 15, 4, 23, 185, 60, 100, 83, 12, 8, 2,
+  1, 2, 8, 1, 2, 1, 30, 1, 2, 2, 12, 9,
+  10, 70, 8, 2, 46, 2, 11, 27, 72, 8, 83, 13,
+  73, 263, 9, 1, 45, 1, 14, 10, 29, 3, 32, 2,
+  22, 1, 14, 73, 7, 1, 2, 1, 44, 3, 1, 1,
+  2, 1, 9, 8, 10, 6, 6, 1, 2, 1, 37, 1,
+  2, 1, 6, 7, 10, 310, 25, 183, 1, 15, 50, 13,
+  923, 102, 111, 1, 5, 11, 196, 2636, 99, 13, 1071, 1,
+  9, 4039, 583, 8633, 569, 7, 31, 1, 10, 4, 81, 1,
+  10, 6, 30, 2, 6, 10, 70, 10, 10, 1, 7, 1,
+  21, 5, 19, 688, 91, 101, 75, 4, 57, 7, 17, 64,
+  5, 11, 2, 14, 6136, 8, 1238, 42, 9, 8935, 4, 1,
+  7, 1, 2, 1, 291, 45, 3, 17, 4, 8, 396, 2308,
+  107, 5, 13, 3, 9, 7, 10, 2, 8, 4700, 46, 2,
+  23, 9, 116, 60, 246, 10, 39, 2, 194, 21, 70, 154,
+  20, 12, 87, 9, 25, 135, 85, 1, 71, 1, 2, 2,
+  1, 2, 2, 2, 4, 1, 12, 1, 1, 1, 7, 1,
+  65, 1, 4, 2, 8, 1, 7, 1, 28, 1, 4, 1,
+  5, 1, 1, 3, 7, 1, 340, 2, 292, 2, 702, 15,
+  5, 1, 15, 1104, 31, 225, 7, 1, 17, 2, 7, 1,
+  2, 1, 5, 213, 45, 3, 14, 2, 10, 4, 2, 320,
+  31, 17, 58, 5, 1, 1248, 7, 1, 4, 1, 2, 1,
+  15, 1, 197, 2, 16, 41, 76, 4, 10, 4, 2, 785,
+  68, 76, 61, 194, 4, 1, 27, 1, 2, 1, 1, 2,
+  1, 1, 10, 1, 4, 1, 1, 1, 1, 6, 1, 4,
+  1, 1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 2, 4, 1, 7, 1, 4, 1, 4, 1, 1, 1,
+  10, 1, 17, 5, 3, 1, 5, 1, 17, 52, 2, 270,
+  44, 4, 100, 12, 15, 2, 15, 1, 15, 1, 37, 10,
+  174, 56, 29, 13, 44, 4, 9, 7, 2, 14, 6, 154,
+  984, 5, 16, 3, 13, 3, 116, 12, 89, 7, 12, 4,
+  1, 15, 12, 4, 56, 8, 10, 6, 40, 8, 30, 2,
+  2, 78, 340, 12, 14, 2, 5, 3, 5, 3, 7, 9,
+  29, 3, 11, 5, 6, 10, 10, 6, 8, 8, 7, 9,
+  147, 1, 55, 37, 10, 1030, 42720, 32, 4153, 7, 222, 2,
+  5762, 14, 7473, 3103, 542, 1506, 4939, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 60608, 1, 30, 96, 128, 240, 65040,
+  65534, 2, 65534, 2, 65535, 59649, 76, 4, 10, 4, 2, 65535,
+  5889, 27, 2, 15, 4, 23, 65535, 17409, 583, 1536, 5, 1,
+  6, 1, 14, 1, 3, 1, 32, 1, 10, 11, 26, 1,
+  108, 1, 34, 80, 48, 240, 31, 1, 2, 6, 74, 1,
+  29, 62032, 115, 16, 363, 2, 80, 2, 54, 7, 1, 32,
+  16, 112, 5, 1, 135, 3939, 31, 57217, 4, 1, 27, 1,
+  2, 1, 1, 2, 1, 1, 10, 1, 4, 1, 1, 1,
+  1, 6, 1, 4, 1, 1, 1, 1, 1, 1, 3, 1,
+  2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 2, 1, 1, 2, 4, 1, 7, 1, 4, 1,
+  4, 1, 1, 1, 10, 1, 17, 5, 3, 1, 5, 1,
+  17, 52, 2, 1329, 38, 2, 50, 2, 3, 62851, 5, 65535,
+  2817, 54, 3, 7, 6912, 77, 3, 47, 42656, 88, 49416, 569,
+  65535, 27345, 30, 2, 6, 7104, 52, 8, 4, 2432, 4, 1,
+  8, 2, 2, 2, 22, 1, 7, 1, 1, 3, 4, 2,
+  9, 2, 2, 2, 4, 8, 1, 4, 2, 1, 5, 2,
+  25, 65535, 7169, 9, 1, 45, 1, 14, 10, 29, 746, 2,
+  11801, 43, 112, 32, 65535, 4097, 78, 4, 36, 9, 1, 10240,
+  256, 6656, 28, 2, 2, 5952, 20, 5120, 640, 560, 70, 65535,
+  443, 16, 65535, 673, 49, 65535, 1329, 52, 11, 1, 65535, 4353,
+  53, 1, 18, 43520, 55, 9, 14, 2, 10, 2, 4, 5024,
+  86, 2, 6, 38770, 80, 65535, 4017, 28, 0, 65, 26, 6,
+  26, 47, 1, 15, 1, 5, 23, 1, 31, 1, 449, 39,
+  5, 5, 2, 20, 116, 1, 9, 1, 6, 1, 1, 1,
+  637, 1, 6, 1, 14, 1, 3, 1, 32, 1, 156, 1,
+  516, 1, 129, 2, 1241, 1, 405, 4, 290, 1, 1519, 3,
+  71, 2, 203, 2, 1, 1, 1229, 1, 13, 1, 7, 4,
+  1, 6, 1, 3, 2, 1, 773, 12, 2, 87, 1, 11,
+  3, 11, 1, 15, 17, 33, 63, 38, 1, 3, 2, 6,
+  1, 27, 1, 17, 41, 3, 4, 663, 25, 11, 21, 928,
+  256, 628, 2, 32, 1, 105, 512, 94, 402, 12, 4, 5,
+  1, 1, 1, 25, 15, 8, 4, 4, 91, 2, 3, 1,
+  90, 2, 147, 16, 32, 36, 60, 64, 31, 81, 47, 1,
+  88, 168, 6592, 64, 22784, 34, 102, 3, 165, 10, 244, 1,
+  160, 1, 395, 1, 14, 2, 20946, 2, 208, 10, 22, 35,
+  1, 19, 1, 4, 147, 1, 1, 32, 26, 6, 26, 11,
+  10, 1, 45, 2, 64, 7, 1, 7, 10, 5, 258, 3,
+  4, 45, 3, 9, 80, 13, 51, 45, 228, 27, 47524, 4,
+  4780, 116, 60, 246, 10, 39, 2, 62, 3, 17, 8, 2,
+  7, 30, 4, 61, 245, 20, 12, 87, 9, 25, 135, 85,
+  1, 71, 1, 2, 2, 1, 2, 2, 2, 4, 1, 12,
+  1, 1, 1, 7, 1, 65, 1, 4, 2, 8, 1, 7,
+  1, 28, 1, 4, 1, 5, 1, 1, 3, 7, 1, 340,
+  2, 292, 2, 50, 5233, 68, 76, 61, 706, 44, 4, 100,
+  12, 15, 2, 15, 1, 15, 1, 37, 10, 174, 56, 26,
+  1, 2, 13, 44, 4, 9, 7, 2, 14, 6, 154, 984,
+  5, 16, 3, 13, 3, 116, 12, 89, 7, 12, 4, 1,
+  15, 12, 4, 56, 8, 10, 6, 40, 8, 30, 2, 2,
+  78, 340, 12, 14, 2, 5, 3, 5, 3, 7, 9, 29,
+  3, 11, 5, 6, 10, 10, 6, 8, 8, 7, 9, 147,
+  1, 55, 37, 10, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 1043, 1, 30, 96, 994, 14, 10384, 116,
+  5, 7, 65535, 8193, 922, 102, 111, 1, 5, 11, 196, 65535,
+  2049, 6, 2, 1, 1, 44, 1, 2, 3, 1, 2, 1,
+  65535, 12177, 99, 1024, 133, 2, 169, 5968, 9, 162, 1, 76,
+  1, 4199, 32, 30784, 96, 22414, 2, 65535, 1025, 80, 2304, 81,
+  4, 15, 2, 26, 40800, 32, 65535, 6401, 7, 2, 1, 2,
+  8, 1, 2, 1, 30, 1, 2, 2, 12, 9, 10, 65535,
+  6145, 60, 65535, 48129, 107, 5, 13, 3, 9, 7, 10, 2,
+  4, 65535, 12289, 1071, 1, 9, 65535, 1281, 40, 65535, 4065, 23,
+  4608, 73, 1, 4, 2, 7, 1, 1, 1, 4, 2, 41,
+  1, 4, 2, 33, 1, 4, 2, 7, 1, 1, 1, 4,
+  2, 15, 1, 57, 1, 4, 2, 67, 2, 32, 3, 26,
+  6630, 23, 9, 7, 1, 7, 1, 7, 1, 7, 1, 7,
+  1, 7, 1, 7, 1, 7, 32034, 6, 2, 6, 2, 6,
+  9, 7, 1, 7, 65535, 15538, 7, 1, 4, 1, 2, 1,
+  15, 4256, 38, 1, 1, 5, 1, 2, 43, 1, 4, 2960,
+  43, 2, 3, 4160, 38, 1, 1, 5, 1, 11264, 96, 65535,
+  45985, 7, 1, 17, 2, 7, 1, 2, 1, 5, 65535, 817,
+  27, 65535, 4865, 4, 1, 8, 2, 2, 2, 22, 1, 7,
+  1, 2, 1, 5, 2, 9, 2, 2, 2, 3, 2, 1,
+  6, 1, 5, 7, 2, 7, 3, 5, 880, 4, 1, 3,
+  2, 4, 1, 1, 4, 1, 1, 1, 1, 3, 1, 1,
+  1, 20, 1, 63, 14, 16, 6438, 5, 50, 5, 4, 5,
+  84, 1, 320, 22, 2, 6, 2, 38, 2, 6, 2, 8,
+  1, 1, 1, 1, 1, 1, 1, 31, 2, 53, 1, 15,
+  1, 14, 2, 6, 1, 19, 2, 3, 1, 9, 295, 1,
+  35390, 1, 21978, 79, 17, 1, 53343, 70, 2689, 3, 1, 9,
+  1, 3, 1, 22, 1, 7, 1, 2, 1, 5, 2, 10,
+  1, 3, 1, 3, 2, 1, 15, 4, 2, 12, 7, 7,
+  65535, 7521, 6, 1, 2, 1, 37, 1, 2, 1, 6, 7,
+  10, 2561, 3, 1, 6, 4, 2, 2, 22, 1, 7, 1,
+  2, 1, 2, 1, 2, 2, 1, 1, 5, 4, 2, 2,
+  3, 3, 1, 7, 4, 1, 1, 7, 17, 11904, 26, 1,
+  89, 12, 214, 47, 1, 1, 1, 25, 9, 14, 4, 964,
+  6592, 64, 20992, 22784, 366, 2, 106, 29960, 2, 12, 2, 36878,
+  42720, 32, 4153, 7, 222, 2, 5762, 14, 7473, 3103, 542, 1506,
+  4939, 4352, 256, 7726, 2, 257, 94, 113, 31, 65, 31, 30433,
+  29, 643, 11172, 12, 23, 4, 49, 10148, 31, 3, 6, 2,
+  6, 2, 6, 2, 3, 65535, 3329, 40, 8, 10, 5920, 21,
+  65535, 2273, 19, 1, 2, 5, 5, 1425, 55, 8, 27, 4,
+  6, 62760, 26, 1, 5, 1, 1, 1, 2, 1, 2, 1,
+  10, 12353, 86, 6, 3, 65535, 32610, 287, 48, 3, 16557, 1,
+  65535, 2113, 22, 1, 9, 768, 112, 277, 2, 452, 11, 26,
+  1, 736, 4, 4443, 31, 513, 3, 1, 13, 1, 7, 4,
+  1, 6, 1, 3, 2, 198, 64, 524, 2, 194, 33, 3897,
+  4, 107, 2, 52581, 16, 16, 14, 975, 1, 226, 1, 4186,
+  1, 48068, 46, 2, 23, 544, 3, 17, 8, 2, 7, 30,
+  4, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 12126, 240, 65535, 2913, 19, 5, 8, 65535, 2881, 22, 2,
+  8, 43392, 78, 2, 10, 4, 2, 65535, 4225, 67, 10, 1,
+  3200, 13, 1, 3, 1, 23, 1, 10, 1, 5, 2, 9,
+  1, 3, 1, 4, 7, 2, 6, 2, 1, 4, 2, 10,
+  1, 2, 12449, 90, 2, 3, 240, 16, 208, 47, 1, 88,
+  52238, 10, 1, 45, 45138, 4, 1, 7, 1, 2, 1, 1,
+  287, 3, 65, 4, 43264, 46, 1, 1, 65535, 2561, 4, 1,
+  2, 5, 8, 1, 3, 1, 29, 2, 3, 4, 10, 7,
+  9, 65535, 28645, 1, 6939, 470, 6016, 94, 2, 10, 6, 10,
+  486, 32, 65535, 4609, 18, 1, 44, 65535, 4785, 59, 5, 10,
+  3713, 2, 1, 1, 1, 5, 1, 24, 1, 1, 1, 23,
+  2, 5, 1, 1, 1, 6, 2, 10, 2, 4, 65, 26,
+  6, 26, 47, 1, 15, 1, 5, 23, 1, 31, 1, 449,
+  39, 5, 6683, 38, 6, 49, 5, 4, 5, 13, 1, 70,
+  65, 256, 369, 1, 13, 1, 16, 13, 141, 2, 6, 1,
+  27, 1, 17, 41, 2775, 32, 31394, 102, 3, 64, 5, 2,
+  1, 1, 1, 5, 24, 14, 816, 43, 1, 9, 1, 4,
+  20374, 7, 1050, 26, 6, 26, 2085, 6, 1, 42, 1, 9,
+  55109, 31, 7168, 56, 3, 15, 3, 3, 6400, 31, 1, 12,
+  4, 12, 4, 1, 3, 12, 65535, 1537, 311, 9, 22, 10,
+  8, 65535, 1, 12, 1, 26, 1, 19, 1, 2, 1, 15,
+  2, 14, 34, 123, 42192, 48, 31408, 1, 65535, 641, 29, 65535,
+  2337, 26, 5, 1, 65535, 4433, 39, 65535, 7905, 25, 3328, 13,
+  1, 3, 1, 51, 1, 3, 1, 6, 4, 16, 2, 26,
+  2112, 28, 2, 1, 65535, 2753, 39, 4, 12, 65535, 7281, 32,
+  2, 22, 1, 14, 65535, 7425, 7, 1, 2, 1, 44, 3,
+  1, 1, 2, 1, 9, 8, 10, 65535, 28225, 91, 43744, 23,
+  201, 46, 2, 10, 65535, 59393, 197, 2, 16, 65535, 2465, 24,
+  4, 20, 2, 46, 65535, 2433, 32, 65535, 28417, 75, 4, 57,
+  7, 17, 65535, 5633, 69, 11, 10, 6144, 2, 2, 1, 1,
+  20, 6, 89, 7, 43, 64949, 13, 65535, 27201, 31, 1, 10,
+  4, 2, 65535, 4737, 7, 1, 1, 1, 4, 1, 15, 1,
+  11, 4096, 160, 39232, 31, 97, 32, 65535, 2177, 31, 8, 9,
+  65535, 6561, 8, 2, 46, 2, 11, 6528, 44, 4, 26, 6,
+  11, 3, 2, 65535, 5121, 92, 1, 5, 1984, 59, 2, 3,
+  65535, 28642, 1, 16782, 396, 65535, 57601, 45, 3, 14, 2, 10,
+  4, 2, 5760, 29, 7248, 48, 65535, 3201, 51, 13, 51, 7,
+  6, 65535, 769, 36, 9, 3, 65535, 2689, 32, 65535, 849, 43,
+  65535, 929, 36, 4, 14, 65535, 3841, 40, 65535, 2657, 32, 65535,
+  3073, 73, 65535, 3953, 26, 2817, 3, 1, 8, 2, 2, 2,
+  22, 1, 7, 1, 2, 1, 5, 2, 9, 2, 2, 2,
+  3, 7, 3, 4, 2, 1, 5, 2, 18, 65535, 1201, 36,
+  4, 36, 65535, 1153, 30, 2, 10, 65535, 27393, 70, 10, 10,
+  1, 7, 1, 21, 5, 19, 65535, 2145, 32, 65535, 6849, 57,
+  43072, 56, 65535, 2305, 28, 3, 1, 65535, 2945, 18, 7, 4,
+  12, 7, 43312, 36, 11, 1, 5792, 75, 3, 11, 2048, 46,
+  2, 15, 43136, 70, 8, 12, 65535, 4481, 96, 65535, 1105, 48,
+  65535, 5505, 54, 2, 38, 65535, 55297, 652, 15, 5, 1, 15,
+  3457, 3, 1, 18, 3, 24, 1, 9, 1, 1, 2, 7,
+  3, 1, 4, 6, 1, 1, 1, 8, 6, 10, 2, 3,
+  65535, 1005, 20, 65535, 3889, 42, 65535, 4305, 25, 7, 10, 65535,
+  6737, 83, 7040, 64, 256, 8, 43008, 45, 1792, 14, 1, 60,
+  2, 3, 272, 11, 5888, 22, 9, 1, 5984, 13, 1, 3,
+  1, 2, 6480, 30, 2, 5, 6688, 63, 1, 29, 2, 11,
+  6, 10, 6, 14, 43648, 67, 24, 5, 65535, 5761, 58, 6,
+  10, 2946, 2, 1, 6, 3, 3, 1, 4, 3, 2, 1,
+  1, 1, 2, 3, 2, 3, 3, 3, 12, 4, 5, 3,
+  3, 1, 4, 2, 1, 6, 1, 14, 21, 65535, 5062, 50,
+  13, 1, 65535, 27249, 79, 1, 10, 65535, 28641, 1, 31, 6136,
+  8, 768, 512, 9, 3072, 13, 1, 3, 1, 23, 1, 16,
+  2, 9, 1, 3, 1, 4, 7, 2, 1, 3, 2, 1,
+  2, 4, 2, 10, 7, 9, 1920, 50, 3585, 58, 5, 28,
+  3840, 72, 1, 36, 4, 39, 1, 36, 1, 15, 1, 7,
+  4, 2, 11568, 56, 7, 2, 14, 1, 65535, 5249, 72, 8,
+  10, 65535, 58001, 31, 65535, 897, 30, 1, 1, 888, 2, 6,
+  4, 7, 1, 1, 1, 20, 1, 397, 1, 38, 2, 50,
+  2, 3, 1, 55, 8, 27, 4, 6, 11, 270, 1, 60,
+  2, 101, 14, 59, 2, 49, 2, 15, 1, 28, 2, 1,
+  1, 11, 5, 31, 1, 2, 6, 236, 1, 8, 2, 2,
+  2, 22, 1, 7, 1, 1, 3, 4, 2, 9, 2, 2,
+  2, 4, 8, 1, 4, 2, 1, 5, 2, 25, 2, 3,
+  1, 6, 4, 2, 2, 22, 1, 7, 1, 2, 1, 2,
+  1, 2, 2, 1, 1, 5, 4, 2, 2, 3, 3, 1,
+  7, 4, 1, 1, 7, 17, 10, 3, 1, 9, 1, 3,
+  1, 22, 1, 7, 1, 2, 1, 5, 2, 10, 1, 3,
+  1, 3, 2, 1, 15, 4, 2, 12, 7, 7, 1, 3,
+  1, 8, 2, 2, 2, 22, 1, 7, 1, 2, 1, 5,
+  2, 9, 2, 2, 2, 3, 7, 3, 4, 2, 1, 5,
+  2, 18, 10, 2, 1, 6, 3, 3, 1, 4, 3, 2,
+  1, 1, 1, 2, 3, 2, 3, 3, 3, 12, 4, 5,
+  3, 3, 1, 4, 2, 1, 6, 1, 14, 21, 5, 13,
+  1, 3, 1, 23, 1, 16, 2, 9, 1, 3, 1, 4,
+  7, 2, 1, 3, 2, 1, 2, 4, 2, 10, 7, 22,
+  1, 3, 1, 23, 1, 10, 1, 5, 2, 9, 1, 3,
+  1, 4, 7, 2, 6, 2, 1, 4, 2, 10, 1, 2,
+  13, 13, 1, 3, 1, 51, 1, 3, 1, 6, 4, 16,
+  2, 26, 1, 3, 1, 18, 3, 24, 1, 9, 1, 1,
+  2, 7, 3, 1, 4, 6, 1, 1, 1, 8, 6, 10,
+  2, 3, 12, 58, 4, 29, 37, 2, 1, 1, 1, 5,
+  1, 24, 1, 1, 1, 23, 2, 5, 1, 1, 1, 6,
+  2, 10, 2, 4, 32, 72, 1, 36, 4, 39, 1, 36,
+  1, 15, 1, 13, 37, 198, 1, 1, 5, 1, 2, 377,
+  1, 4, 2, 7, 1, 1, 1, 4, 2, 41, 1, 4,
+  2, 33, 1, 4, 2, 7, 1, 1, 1, 4, 2, 15,
+  1, 57, 1, 4, 2, 67, 2, 32, 3, 26, 6, 86,
+  2, 6, 2, 669, 3, 89, 7, 22, 9, 24, 9, 20,
+  12, 13, 1, 3, 1, 2, 12, 94, 2, 10, 6, 10,
+  6, 26, 6, 89, 7, 43, 5, 70, 10, 31, 1, 12,
+  4, 12, 4, 1, 3, 42, 2, 5, 11, 44, 4, 26,
+  6, 11, 3, 62, 2, 65, 1, 29, 2, 11, 6, 10,
+  6, 14, 2, 31, 49, 77, 3, 47, 1, 116, 8, 60,
+  3, 15, 3, 60, 7, 43, 2, 11, 8, 43, 5, 534,
+  2, 6, 2, 38, 2, 6, 2, 8, 1, 1, 1, 1,
+  1, 1, 1, 31, 2, 53, 1, 15, 1, 14, 2, 6,
+  1, 19, 2, 3, 1, 9, 1, 101, 1, 12, 2, 27,
+  1, 13, 3, 33, 15, 33, 15, 140, 4, 663, 25, 11,
+  21, 1812, 2, 32, 1, 349, 5, 45, 1, 1, 5, 1,
+  2, 56, 7, 2, 14, 24, 9, 7, 1, 7, 1, 7,
+  1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 126,
+  34, 26, 1, 89, 12, 214, 26, 12, 4, 64, 1, 86,
+  2, 103, 5, 43, 1, 94, 1, 84, 12, 47, 1, 29293,
+  3, 55, 9, 348, 20, 184, 8, 203, 5, 2, 1, 1,
+  1, 5, 24, 59, 3, 10, 6, 56, 8, 70, 8, 12,
+  6, 116, 11, 30, 3, 78, 1, 11, 4, 33, 1, 55,
+  9, 14, 2, 10, 2, 103, 24, 28, 10, 6, 2, 6,
+  2, 6, 9, 7, 1, 7, 1, 60, 4, 126, 2, 10,
+  6, 11172, 12, 23, 4, 49, 8452, 366, 2, 106, 38, 7,
+  12, 5, 5, 26, 1, 5, 1, 1, 1, 2, 1, 2,
+  1, 125, 16, 445, 2, 54, 7, 1, 32, 42, 6, 51,
+  1, 19, 1, 4, 4, 5, 1, 135, 2, 1, 1, 190,
+  3, 6, 2, 6, 2, 6, 2, 3, 3, 7, 1, 7,
+  10, 5, 2, 12, 1, 26, 1, 19, 1, 2, 1, 15,
+  2, 14, 34, 123, 5, 3, 4, 45, 3, 88, 1, 13,
+  3, 1, 47, 46, 130, 29, 3, 49, 15, 28, 4, 36,
+  9, 30, 5, 43, 5, 30, 1, 37, 4, 14, 42, 158,
+  2, 10, 6, 36, 4, 36, 4, 40, 8, 52, 11, 12,
+  1, 15, 1, 7, 1, 2, 1, 11, 1, 15, 1, 7,
+  1, 2, 67, 311, 9, 22, 10, 8, 24, 6, 1, 42,
+  1, 9, 69, 6, 2, 1, 1, 44, 1, 2, 3, 1,
+  2, 23, 1, 72, 8, 9, 48, 19, 1, 2, 5, 33,
+  3, 27, 5, 1, 64, 56, 4, 20, 2, 50, 1, 2,
+  5, 8, 1, 3, 1, 29, 2, 3, 4, 10, 7, 9,
+  7, 64, 32, 39, 4, 12, 9, 54, 3, 29, 2, 27,
+  5, 26, 7, 4, 12, 7, 80, 73, 55, 51, 13, 51,
+  7, 46, 8, 10, 294, 31, 1, 42, 1, 3, 2, 2,
+  78, 40, 8, 42, 22, 26, 38, 28, 20, 23, 9, 78,
+  4, 36, 9, 68, 10, 1, 2, 25, 7, 10, 6, 53,
+  1, 18, 8, 39, 9, 96, 1, 20, 11, 18, 1, 44,
+  65, 7, 1, 1, 1, 4, 1, 15, 1, 11, 6, 59,
+  5, 10, 6, 4, 1, 8, 2, 2, 2, 22, 1, 7,
+  1, 2, 1, 5, 1, 10, 2, 2, 2, 3, 2, 1,
+  6, 1, 5, 7, 2, 7, 3, 5, 139, 92, 1, 5,
+  30, 72, 8, 10, 166, 54, 2, 38, 34, 69, 11, 10,
+  6, 13, 19, 58, 6, 10, 54, 27, 2, 15, 4, 23,
+  185, 60, 100, 83, 12, 8, 2, 1, 2, 8, 1, 2,
+  1, 30, 1, 2, 2, 12, 9, 10, 70, 8, 2, 46,
+  2, 11, 27, 72, 8, 83, 13, 73, 263, 9, 1, 45,
+  1, 14, 10, 29, 3, 32, 2, 22, 1, 14, 73, 7,
+  1, 2, 1, 44, 3, 1, 1, 2, 1, 9, 8, 10,
+  6, 6, 1, 2, 1, 37, 1, 2, 1, 6, 7, 10,
+  310, 25, 183, 1, 15, 50, 13, 923, 102, 111, 1, 5,
+  11, 196, 2636, 99, 13, 1071, 1, 9, 4039, 583, 8633, 569,
+  7, 31, 1, 10, 4, 81, 1, 10, 6, 30, 2, 6,
+  10, 70, 10, 10, 1, 7, 1, 21, 5, 19, 688, 91,
+  101, 75, 4, 57, 7, 17, 64, 5, 11, 2, 14, 6136,
+  8, 1238, 42, 9, 8935, 4, 1, 7, 1, 2, 1, 291,
+  45, 3, 17, 4, 8, 396, 2308, 107, 5, 13, 3, 9,
+  7, 10, 2, 8, 4700, 46, 2, 23, 9, 116, 60, 246,
+  10, 39, 2, 194, 21, 70, 154, 20, 12, 87, 9, 25,
+  135, 85, 1, 71, 1, 2, 2, 1, 2, 2, 2, 4,
+  1, 12, 1, 1, 1, 7, 1, 65, 1, 4, 2, 8,
+  1, 7, 1, 28, 1, 4, 1, 5, 1, 1, 3, 7,
+  1, 340, 2, 292, 2, 702, 15, 5, 1, 15, 1104, 31,
+  225, 7, 1, 17, 2, 7, 1, 2, 1, 5, 213, 45,
+  3, 14, 2, 10, 4, 2, 320, 31, 17, 58, 5, 1,
+  1248, 7, 1, 4, 1, 2, 1, 15, 1, 197, 2, 16,
+  41, 76, 4, 10, 4, 2, 785, 68, 76, 61, 194, 4,
+  1, 27, 1, 2, 1, 1, 2, 1, 1, 10, 1, 4,
+  1, 1, 1, 1, 6, 1, 4, 1, 1, 1, 1, 1,
+  1, 3, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 2, 1, 1, 2, 4, 1, 7,
+  1, 4, 1, 4, 1, 1, 1, 10, 1, 17, 5, 3,
+  1, 5, 1, 17, 52, 2, 270, 44, 4, 100, 12, 15,
+  2, 15, 1, 15, 1, 37, 10, 174, 56, 29, 13, 44,
+  4, 9, 7, 2, 14, 6, 154, 984, 5, 16, 3, 13,
+  3, 116, 12, 89, 7, 12, 4, 1, 15, 12, 4, 56,
+  8, 10, 6, 40, 8, 30, 2, 2, 78, 340, 12, 14,
+  2, 5, 3, 5, 3, 7, 9, 29, 3, 11, 5, 6,
+  10, 10, 6, 8, 8, 7, 9, 147, 1, 55, 37, 10,
+  1030, 42720, 32, 4153, 7, 222, 2, 5762, 14, 7473, 3103, 542,
+  1506, 4939, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  60608, 1, 30, 96, 128, 240, 65535, 65535, 65042, 42240, 300, 65535,
+  1393, 11, 1, 15, 1, 7, 1, 2, 1, 11, 1, 15,
+  1, 7, 1, 2, 65535, 58049, 58, 5, 1, 65535, 6305, 83,
+  12, 1, 65535, 3713, 42, 1, 3, 2, 2, 40960, 1165, 3,
+  55, 65535, 6657, 72, 9, 5, 18, 1, 100, 1, 26, 1,
+  5599, 1, 2431, 11, 29, 2, 5, 1, 47, 1, 4000, 1
+};
+
+// the general categories of two letters
+static const Property Categories[] = {
+  {"Lu", "Uppercase_Letter", 0, 1292},
+  {"Ll", "Lowercase_Letter", 1292, 1314},
+  {"Lt", "Titlecase_Letter", 2606, 20},
+  {"Lm", "Modifier_Letter", 2626, 138},
+  {"Lo", "Other_Letter", 2764, 1002},
+  {"Mn", "Nonspacing_Mark", 3766, 684},
+  {"Mc", "Spacing_Mark", 4450, 354},
+  {"Me", "Enclosing_Mark", 4804, 10},
+  {"Nd", "Decimal_Number", 4814, 124},
+  {"Nl", "Letter_Number", 4938, 24},
+  {"No", "Other_Number", 4962, 142},
+  {"Pc", "Connector_Punctuation", 5104, 12},
+  {"Pd", "Dash_Punctuation", 5116, 38},
+  {"Ps", "Open_Punctuation", 5154, 158},
+  {"Pe", "Close_Punctuation", 5312, 152},
+  {"Pi", "Initial_Punctuation", 5464, 22},
+  {"Pf", "Final_Punctuation", 5486, 20},
+  {"Po", "Other_Punctuation", 5506, 370},
+  {"Sm", "Math_Symbol", 5876, 128},
+  {"Sc", "Currency_Symbol", 6004, 42},
+  {"Sk", "Modifier_Symbol", 6046, 62},
+  {"So", "Other_Symbol", 6108, 372},
+  {"Zs", "Space_Separator", 6480, 14},
+  {"Zl", "Line_Separator", 6494, 2},
+  {"Zp", "Paragraph_Separator", 6496, 2},
+  {"Cc", "Control", 6498, 4},
+  {"Cf", "Format", 6502, 54},
+  {"Cs", "Surrogate", 6556, 2},
+  {"Co", "Private_Use", 6558, 20},
+  {"Cn", "Unassigned", 6578, 1406}
+};
+
+// the scripts, sorted by name
+static const Property Scripts[] = {
+  {"Adlam", "Adlm", 7984, 7},
+  {"Ahom", "Ahom", 7991, 7},
+  {"Anatolian_Hieroglyphs", "Hluw", 7998, 3},
+  {"Arabic", "Arab", 8001, 114},
+  {"Armenian", "Armn", 8115, 8},
+  {"Avestan", "Avst", 8123, 5},
+  {"Balinese", "Bali", 8128, 4},
+  {"Bamum", "Bamu", 8132, 4},
+  {"Bassa_Vah", "Bass", 8136, 5},
+  {"Batak", "Batk", 8141, 4},
+  {"Bengali", "Beng", 8145, 28},
+  {"Bhaiksuki", "Bhks", 8173, 9},
+  {"Bopomofo", "Bopo", 8182, 6},
+  {"Brahmi", "Brah", 8188, 7},
+  {"Braille", "Brai", 8195, 2},
+  {"Buginese", "Bugi", 8197, 4},
+  {"Buhid", "Buhd", 8201, 2},
+  {"Canadian_Aboriginal", "Cans", 8203, 7},
+  {"Carian", "Cari", 8210, 3},
+  {"Caucasian_Albanian", "Aghb", 8213, 5},
+  {"Chakma", "Cakm", 8218, 5},
+  {"Cham", "Cham", 8223, 8},
+  {"Cherokee", "Cher", 8231, 6},
+  {"Chorasmian", "Chrs", 8237, 3},
+  {"Common", "Zyyy", 8240, 360},
+  {"Coptic", "Copt", 8600, 6},
+  {"Cuneiform", "Xsux", 8606, 9},
+  {"Cypriot", "Cprt", 8615, 13},
+  {"Cypro_Minoan", "Cpmn", 8628, 3},
+  {"Cyrillic", "Cyrl", 8631, 16},
+  {"Deseret", "Dsrt", 8647, 3},
+  {"Devanagari", "Deva", 8650, 8},
+  {"Dives_Akuru", "Diak", 8658, 17},
+  {"Dogra", "Dogr", 8675, 3},
+  {"Duployan", "Dupl", 8678, 11},
+  {"Egyptian_Hieroglyphs", "Egyp", 8689, 5},
+  {"Elbasan", "Elba", 8694, 3},
+  {"Elymaic", "Elym", 8697, 3},
+  {"Ethiopic", "Ethi", 8700, 73},
+  {"Georgian", "Geor", 8773, 20},
+  {"Glagolitic", "Glag", 8793, 13},
+  {"Gothic", "Goth", 8806, 3},
+  {"Grantha", "Gran", 8809, 31},
+  {"Greek", "Grek", 8840, 72},
+  {"Gujarati", "Gujr", 8912, 28},
+  {"Gunjala_Gondi", "Gong", 8940, 13},
+  {"Gurmukhi", "Guru", 8953, 32},
+  {"Han", "Hani", 8985, 40},
+  {"Hangul", "Hang", 9025, 28},
+  {"Hanifi_Rohingya", "Rohg", 9053, 5},
+  {"Hanunoo", "Hano", 9058, 2},
+  {"Hatran", "Hatr", 9060, 7},
+  {"Hebrew", "Hebr", 9067, 18},
+  {"Hiragana", "Hira", 9085, 11},
+  {"Imperial_Aramaic", "Armi", 9096, 5},
+  {"Inherited", "Zinh", 9101, 70},
+  {"Inscriptional_Pahlavi", "Phli", 9171, 5},
+  {"Inscriptional_Parthian", "Prti", 9176, 5},
+  {"Javanese", "Java", 9181, 6},
+  {"Kaithi", "Kthi", 9187, 5},
+  {"Kannada", "Knda", 9192, 26},
+  {"Katakana", "Kana", 9218, 26},
+  {"Kayah_Li", "Kali", 9244, 4},
+  {"Kharoshthi", "Khar", 9248, 17},
+  {"Khitan_Small_Script", "Kits", 9265, 5},
+  {"Khmer", "Khmr", 9270, 8},
+  {"Khojki", "Khoj", 9278, 5},
+  {"Khudawadi", "Sind", 9283, 5},
+  {"Lao", "Laoo", 9288, 22},
+  {"Latin", "Latn", 9310, 76},
+  {"Lepcha", "Lepc", 9386, 6},
+  {"Limbu", "Limb", 9392, 10},
+  {"Linear_A", "Lina", 9402, 7},
+  {"Linear_B", "Linb", 9409, 15},
+  {"Lisu", "Lisu", 9424, 4},
+  {"Lycian", "Lyci", 9428, 3},
+  {"Lydian", "Lydi", 9431, 5},
+  {"Mahajani", "Mahj", 9436, 3},
+  {"Makasar", "Maka", 9439, 3},
+  {"Malayalam", "Mlym", 9442, 14},
+  {"Mandaic", "Mand", 9456, 4},
+  {"Manichaean", "Mani", 9460, 5},
+  {"Marchen", "Marc", 9465, 7},
+  {"Masaram_Gondi", "Gonm", 9472, 15},
+  {"Medefaidrin", "Medf", 9487, 3},
+  {"Meetei_Mayek", "Mtei", 9490, 6},
+  {"Mende_Kikakui", "Mend", 9496, 5},
+  {"Meroitic_Cursive", "Merc", 9501, 7},
+  {"Meroitic_Hieroglyphs", "Mero", 9508, 3},
+  {"Miao", "Plrd", 9511, 7},
+  {"Modi", "Modi", 9518, 5},
+  {"Mongolian", "Mong", 9523, 12},
+  {"Mro", "Mroo", 9535, 7},
+  {"Multani", "Mult", 9542, 11},
+  {"Myanmar", "Mymr", 9553, 6},
+  {"Nabataean", "Nbat", 9559, 5},
+  {"Nandinagari", "Nand", 9564, 7},
+  {"New_Tai_Lue", "Talu", 9571, 8},
+  {"Newa", "Newa", 9579, 5},
+  {"Nko", "Nkoo", 9584, 4},
+  {"Nushu", "Nshu", 9588, 5},
+  {"Nyiakeng_Puachue_Hmong", "Hmnp", 9593, 9},
+  {"Ogham", "Ogam", 9602, 2},
+  {"Ol_Chiki", "Olck", 9604, 2},
+  {"Old_Hungarian", "Hung", 9606, 7},
+  {"Old_Italic", "Ital", 9613, 5},
+  {"Old_North_Arabian", "Narb", 9618, 3},
+  {"Old_Permic", "Perm", 9621, 3},
+  {"Old_Persian", "Xpeo", 9624, 5},
+  {"Old_Sogdian", "Sogo", 9629, 3},
+  {"Old_South_Arabian", "Sarb", 9632, 3},
+  {"Old_Turkic", "Orkh", 9635, 3},
+  {"Old_Uyghur", "Ougr", 9638, 3},
+  {"Oriya", "Orya", 9641, 28},
+  {"Osage", "Osge", 9669, 5},
+  {"Osmanya", "Osma", 9674, 5},
+  {"Pahawh_Hmong", "Hmng", 9679, 11},
+  {"Palmyrene", "Palm", 9690, 3},
+  {"Pau_Cin_Hau", "Pauc", 9693, 3},
+  {"Phags_Pa", "Phag", 9696, 2},
+  {"Phoenician", "Phnx", 9698, 5},
+  {"Psalter_Pahlavi", "Phlp", 9703, 7},
+  {"Rejang", "Rjng", 9710, 4},
+  {"Runic", "Runr", 9714, 4},
+  {"Samaritan", "Samr", 9718, 4},
+  {"Saurashtra", "Saur", 9722, 4},
+  {"Sharada", "Shrd", 9726, 3},
+  {"Shavian", "Shaw", 9729, 3},
+  {"Siddham", "Sidd", 9732, 5},
+  {"SignWriting", "Sgnw", 9737, 7},
+  {"Sinhala", "Sinh", 9744, 27},
+  {"Sogdian", "Sogd", 9771, 3},
+  {"Sora_Sompeng", "Sora", 9774, 5},
+  {"Soyombo", "Soyo", 9779, 3},
+  {"Sundanese", "Sund", 9782, 4},
+  {"Syloti_Nagri", "Sylo", 9786, 2},
+  {"Syriac", "Syrc", 9788, 8},
+  {"Tagalog", "Tglg", 9796, 4},
+  {"Tagbanwa", "Tagb", 9800, 6},
+  {"Tai_Le", "Tale", 9806, 4},
+  {"Tai_Tham", "Lana", 9810, 10},
+  {"Tai_Viet", "Tavt", 9820, 4},
+  {"Takri", "Takr", 9824, 5},
+  {"Tamil", "Taml", 9829, 37},
+  {"Tangsa", "Tnsa", 9866, 5},
+  {"Tangut", "Tang", 9871, 9},
+  {"Telugu", "Telu", 9880, 26},
+  {"Thaana", "Thaa", 9906, 2},
+  {"Thai", "Thai", 9908, 4},
+  {"Tibetan", "Tibt", 9912, 14},
+  {"Tifinagh", "Tfng", 9926, 6},
+  {"Tirhuta", "Tirh", 9932, 5},
+  {"Toto", "Toto", 9937, 3},
+  {"Ugaritic", "Ugar", 9940, 5},
+  {"Unknown", "Zzzz", 9945, 1404},
+  {"Vai", "Vaii", 11349, 2},
+  {"Vithkuqi", "Vith", 11351, 17},
+  {"Wancho", "Wcho", 11368, 5},
+  {"Warang_Citi", "Wara", 11373, 5},
+  {"Yezidi", "Yezi", 11378, 7},
+  {"Yi", "Yiii", 11385, 4},
+  {"Zanabazar_Square", "Zanb", 11389, 3}
+};
+
+static const Property WhiteSpaceProperty =
+  {"White_Space", "WSpace", 11392, 20};
+
+}  // namespace Utils
+}  // namespace SPEG
+
+#endif  // SRC_STRINGOZZI_PROPERTIES_H_
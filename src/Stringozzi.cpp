@@ -34,9 +34,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define BUILDING_DLL
 
 #include "Stringozzi.h"
+#include "Stringozzi.Properties.h"
+#include <algorithm>
+#include <set>
+#include <stdio.h>
+#include <time.h>
 #ifdef _MSC_VER
 #include <Windows.h>
 #endif
+#ifdef SPEG_SIMD
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
@@ -50,16 +58,44 @@ DLL_PUBLIC void Decrement<char>(const char **p) {
   } while (((**p) & 0xC0) == 0x80);
 }
 
-DLL_PUBLIC unsigned long CharToLower(unsigned long in) {
-  if (in >= 'A' && in <= 'Z')
-    return in - 'A' + 'a';
-  return in;
+DLL_PUBLIC vector<SChar> Fold(const vector<SChar>& chars) {
+  vector<SChar> folded(chars.size());
+  for (size_t i = 0; i < chars.size(); i++)
+    folded[i] = CharToLower(chars[i]);
+  return folded;
+}
+
+// the length of the sequence from its lead byte
+static unsigned long LeadLength(const char* ptr) {
+  if ((*ptr & 0xE0) == 0xC0) {
+    return 2;
+  } else if ((*ptr & 0xF0) == 0xE0) {
+    return 3;
+  } else if ((*ptr & 0xF8) == 0xF0) {
+    return 4;
+  }
+
+  return 1;
+}
+
+// the length of a sequence cut by the terminator ends there, the bytes 
+// after the terminator are not part of the text
+static unsigned long CutLength(const char* ptr, unsigned long length) {
+  for (unsigned long i = 1; i < length; i++) {
+    if (!ptr[i])
+      return i;
+  }
+  return length;
 }
 
 DLL_PUBLIC unsigned long UTF8ToUTF32(const char *ptr) {
   unsigned long out = 0;
   if ((*ptr & 0x80) == 0) {
     return *ptr;
+  }
+  unsigned long length = LeadLength(ptr);
+  if (CutLength(ptr, length) < length) {
+    return 0xFFFD;
   } else if ((*ptr & 0xE0) == 0xC0) {
     out = ((*ptr) & 0x1F) << 6;
     ptr++;
@@ -85,16 +121,486 @@ DLL_PUBLIC unsigned long UTF8ToUTF32(const char *ptr) {
 }
 
 DLL_PUBLIC unsigned long UTF8ToUTF32Length(const char *ptr) {
-  unsigned long out = 0;
-  if ((*ptr & 0xE0) == 0xC0) {
-    return 2;
-  } else if ((*ptr & 0xF0) == 0xE0) {
-    return 3;
-  } else if ((*ptr & 0xF8) == 0xF0) {
-    return 4;
+  return CutLength(ptr, LeadLength(ptr));
+}
+
+DLL_PUBLIC void UTF32ToUTF8(SChar chr, string& out) {
+  if (chr < 0x80) {
+    out += static_cast<char>(chr);
+  } else if (chr < 0x800) {
+    out += static_cast<char>(0xC0 | (chr >> 6));
+    out += static_cast<char>(0x80 | (chr & 0x3F));
+  } else if (chr < 0x10000) {
+    out += static_cast<char>(0xE0 | (chr >> 12));
+    out += static_cast<char>(0x80 | ((chr >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (chr & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (chr >> 18));
+    out += static_cast<char>(0x80 | ((chr >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((chr >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (chr & 0x3F));
   }
+}
 
-  return 1;
+static void Normalize(vector<CharClass::RANGE>* ranges) {
+  sort(ranges->begin(), ranges->end());
+  vector<CharClass::RANGE> merged;
+  for (size_t i = 0; i < ranges->size(); i++) {
+    const CharClass::RANGE& range = (*ranges)[i];
+    if (!merged.empty() && merged.back().second != (SChar)-1
+        && range.first <= merged.back().second + 1) {
+      if (range.second > merged.back().second)
+        merged.back().second = range.second;
+    } else {
+      merged.push_back(range);
+    }
+  }
+  ranges->swap(merged);
+}
+
+// the ranges above 255 that are not in the input ranges
+static vector<CharClass::RANGE> Complement(
+        const vector<CharClass::RANGE>& ranges) {
+  vector<CharClass::RANGE> out;
+  SChar next = 256;
+  bool open = true;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    if (ranges[i].first > next)
+      out.push_back(make_pair(next, ranges[i].first - 1));
+    if (ranges[i].second == (SChar)-1) {
+      open = false;
+      break;
+    }
+    next = ranges[i].second + 1;
+  }
+  if (open)
+    out.push_back(make_pair(next, (SChar)-1));
+  return out;
+}
+
+DLL_PUBLIC void CharClass::AddRange(SChar min, SChar max) {
+  for (SChar chr = min; chr <= max && chr < 256; chr++)
+    Bits[chr >> 3] |= static_cast<unsigned char>(1 << (chr & 7));
+  if (max > 255) {
+    Ranges.push_back(make_pair(MAXIMUM(min, (SChar)256), max));
+    Normalize(&Ranges);
+  }
+  _Index();
+}
+
+DLL_PUBLIC void CharClass::Remove(SChar chr) {
+  CharClass other;
+  other.Add(chr);
+  Subtract(other);
+}
+
+DLL_PUBLIC void CharClass::Unite(const CharClass& other) {
+  for (size_t i = 0; i < sizeof(Bits); i++)
+    Bits[i] |= other.Bits[i];
+  Ranges.insert(Ranges.end(), other.Ranges.begin(), other.Ranges.end());
+  Normalize(&Ranges);
+  _Index();
+}
+
+static vector<CharClass::RANGE> Overlap(
+        const vector<CharClass::RANGE>& first
+        , const vector<CharClass::RANGE>& second) {
+  vector<CharClass::RANGE> out;
+  size_t i = 0;
+  size_t j = 0;
+  while (i < first.size() && j < second.size()) {
+    SChar low = MAXIMUM(first[i].first, second[j].first);
+    SChar high = MINIMUM(first[i].second, second[j].second);
+    if (low <= high)
+      out.push_back(make_pair(low, high));
+    if (first[i].second < second[j].second)
+      i++;
+    else
+      j++;
+  }
+  return out;
+}
+
+DLL_PUBLIC void CharClass::Intersect(const CharClass& other) {
+  for (size_t i = 0; i < sizeof(Bits); i++)
+    Bits[i] &= other.Bits[i];
+  Ranges = Overlap(Ranges, other.Ranges);
+  _Index();
+}
+
+DLL_PUBLIC void CharClass::Subtract(const CharClass& other) {
+  for (size_t i = 0; i < sizeof(Bits); i++)
+    Bits[i] &= static_cast<unsigned char>(~other.Bits[i]);
+  Ranges = Overlap(Ranges, Complement(other.Ranges));
+  _Index();
+}
+
+// adds the character without normalizing the ranges
+static void Put(CharClass* set, SChar chr) {
+  if (chr < 256)
+    set->Bits[chr >> 3] |= static_cast<unsigned char>(1 << (chr & 7));
+  else
+    set->Ranges.push_back(make_pair(chr, chr));
+}
+
+DLL_PUBLIC void Unfold(CharClass* set, SChar min, SChar max) {
+  CharClass folded;
+  if (min <= max)
+    folded.AddRange(min, max);
+  // the characters folded into the range and the characters of the 
+  // range folded out of it
+  CharClass into;
+  CharClass out;
+  const unsigned char* blocks = FoldingBlocks();
+  for (SChar block = 0; block < SPEG_FOLDING_LIMIT >> SPEG_FOLDING_SHIFT;
+        block++) {
+    if (!blocks[block])
+      continue;
+    for (SChar offset = 0; offset < (1 << SPEG_FOLDING_SHIFT); offset++) {
+      SChar chr = (block << SPEG_FOLDING_SHIFT) | offset;
+      SChar lower = FoldCase(chr);
+      if (lower >= min && lower <= max)
+        Put(&into, chr);
+      else if (chr >= min && chr <= max)
+        Put(&out, chr);
+    }
+  }
+  Normalize(&into.Ranges);
+  Normalize(&out.Ranges);
+  folded.Subtract(out);
+  folded.Unite(into);
+  set->Unite(folded);
+}
+
+DLL_PUBLIC void Unfold(CharClass* set, const CharClass& chars) {
+  // the characters and their foldings, then every character folding into
+  // one of them
+  CharClass folded = chars;
+  const unsigned char* blocks = FoldingBlocks();
+  for (SChar block = 0; block < SPEG_FOLDING_LIMIT >> SPEG_FOLDING_SHIFT;
+        block++) {
+    if (!blocks[block])
+      continue;
+    for (SChar offset = 0; offset < (1 << SPEG_FOLDING_SHIFT); offset++) {
+      SChar chr = (block << SPEG_FOLDING_SHIFT) | offset;
+      SChar lower = FoldCase(chr);
+      if (lower != chr && chars.Contains(chr))
+        Put(&folded, lower);
+    }
+  }
+  Normalize(&folded.Ranges);
+  CharClass into;
+  for (SChar block = 0; block < SPEG_FOLDING_LIMIT >> SPEG_FOLDING_SHIFT;
+        block++) {
+    if (!blocks[block])
+      continue;
+    for (SChar offset = 0; offset < (1 << SPEG_FOLDING_SHIFT); offset++) {
+      SChar chr = (block << SPEG_FOLDING_SHIFT) | offset;
+      SChar lower = FoldCase(chr);
+      if (lower != chr && folded.Contains(lower))
+        Put(&into, chr);
+    }
+  }
+  Normalize(&into.Ranges);
+  folded.Unite(into);
+  set->Unite(folded);
+}
+
+// the characters of the property, decoded from its range deltas
+static CharClass Characters(const Property& property) {
+  CharClass set;
+  SChar chr = 0;
+  SChar first = 0;
+  bool inside = false;
+  for (unsigned int i = 0; i < property.Count; i++) {
+    unsigned short delta = PropertyDeltas[property.First + i];
+    chr += delta;
+    if (delta == 0xFFFF)
+      continue;
+    if (inside) {
+      for (SChar c = first; c < chr && c < 256; c++)
+        Put(&set, c);
+      if (chr > 256)
+        set.Ranges.push_back(make_pair(MAXIMUM(first, (SChar)256), chr - 1));
+    }
+    first = chr;
+    inside = !inside;
+  }
+  CharClass chars;
+  chars.Unite(set);
+  return chars;
+}
+
+void CharClass::_Index() {
+  memset(Rows, 0, sizeof(Rows));
+  // a null byte is the terminator or SPEG_NUL, never in the rows
+  for (SChar chr = 1; chr < 128; chr++) {
+    if (Contains(chr))
+      Rows[chr & 0x0F] |= static_cast<unsigned char>(1 << (chr >> 4));
+  }
+}
+
+#ifdef SPEG_SIMD
+// the kernels classify a block of bytes with two table lookups: the low 
+// nibble selects the row of the class, the high nibble the bit in the 
+// row, bytes above 127 have no bit and end the run. They return the
+// length of the run in [ptr, end): the bytes up to the first aligned
+// block and after the last one are checked one by one, so no load reads
+// outside the text
+typedef size_t (*SpanKernel)(const char* ptr, const char* end
+      , const unsigned char* rows);
+
+static inline bool InRows(const unsigned char* rows, unsigned char chr) {
+  return chr < 128 && (rows[chr & 0x0F] & (1 << (chr >> 4))) != 0;
+}
+
+__attribute__((target("ssse3")))
+static size_t SpanSSSE3(const char* ptr, const char* end
+      , const unsigned char* rows) {
+  const char* chr = ptr;
+  for (; chr < end && (reinterpret_cast<size_t>(chr) & 15); chr++) {
+    if (!InRows(rows, *chr))
+      return chr - ptr;
+  }
+  const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows));
+  const __m128i high = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128
+        , 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  for (; end - chr >= 16; chr += 16) {
+    __m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(chr));
+    __m128i row = _mm_shuffle_epi8(low, _mm_and_si128(bytes, nibble));
+    __m128i bit = _mm_shuffle_epi8(high
+          , _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+    unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+          _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128())));
+    if (mask)
+      return chr - ptr + __builtin_ctz(mask);
+  }
+  for (; chr < end && InRows(rows, *chr); chr++) {}
+  return chr - ptr;
+}
+
+__attribute__((target("avx2")))
+static size_t SpanAVX2(const char* ptr, const char* end
+      , const unsigned char* rows) {
+  const char* chr = ptr;
+  for (; chr < end && (reinterpret_cast<size_t>(chr) & 31); chr++) {
+    if (!InRows(rows, *chr))
+      return chr - ptr;
+  }
+  const __m256i low = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows)));
+  const __m256i high = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128
+        , 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128
+        , 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  for (; end - chr >= 32; chr += 32) {
+    __m256i bytes = _mm256_load_si256(reinterpret_cast<const __m256i*>(chr));
+    __m256i row = _mm256_shuffle_epi8(low, _mm256_and_si256(bytes, nibble));
+    __m256i bit = _mm256_shuffle_epi8(high
+          , _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+    unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(
+          _mm256_cmpeq_epi8(_mm256_and_si256(row, bit)
+          , _mm256_setzero_si256())));
+    if (mask)
+      return chr - ptr + __builtin_ctz(mask);
+  }
+  for (; chr < end && InRows(rows, *chr); chr++) {}
+  return chr - ptr;
+}
+
+static SpanKernel SelectSpanKernel() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return SpanAVX2;
+  if (__builtin_cpu_supports("ssse3"))
+    return SpanSSSE3;
+  return NULL;
+}
+
+// zero initialized until selected, spans before that use the plain loop
+static const SpanKernel spanKernel = SelectSpanKernel();
+
+// the run from ptr, at most max bytes, of a text of known end (NULL for
+// the terminator).. the end of a terminated text is looked up by chunks
+// growing with the run, so a short run doesn't read the whole text
+static size_t SpanKernelRun(const char* ptr, const char* end
+      , const unsigned char* rows, size_t max) {
+  if (end) {
+    if (static_cast<size_t>(end - ptr) > max)
+      end = ptr + max;
+    return spanKernel(ptr, end, rows);
+  }
+  size_t count = 0;
+  size_t chunk = 64;
+  while (count < max) {
+    size_t length = MINIMUM(chunk, max - count);
+    const char* nul = static_cast<const char*>(memchr(ptr + count, 0
+          , length));
+    if (nul)
+      length = nul - (ptr + count);
+    size_t run = spanKernel(ptr + count, ptr + count + length, rows);
+    count += run;
+    if (run < length || nul)
+      break;
+    if (chunk < 4096)
+      chunk *= 2;
+  }
+  return count;
+}
+#endif
+
+template<>
+DLL_PUBLIC size_t Span<char>(const char** ptr, const CharClass& set
+      , size_t max) {
+  size_t count = 0;
+#ifdef SPEG_SIMD
+  if (spanKernel) {
+    count = SpanKernelRun(*ptr, NULL, set.Rows, max);
+    *ptr += count;
+  }
+#endif
+  // characters above 127 are decoded one by one
+  for (; count < max && **ptr && set.Contains(GetChar(*ptr)); count++)
+    Increment(ptr);
+  return count;
+}
+
+template<>
+DLL_PUBLIC size_t Span<char>(const char** ptr, const char* end
+      , const CharClass& set, size_t max) {
+  if (!end)
+    return Span(ptr, set, max);
+  size_t count = 0;
+#ifdef SPEG_SIMD
+  if (spanKernel) {
+    count = SpanKernelRun(*ptr, end, set.Rows, max);
+    *ptr += count;
+  }
+#endif
+  for (; count < max && *ptr < end && set.Contains(GetChar(*ptr, end))
+        ; count++)
+    Increment(ptr, end);
+  return count;
+}
+
+template<>
+DLL_PUBLIC size_t SpanBytes<char>(const char** ptr, const char* end
+      , const CharClass& set, size_t max) {
+  size_t count = 0;
+#ifdef SPEG_SIMD
+  if (spanKernel) {
+    count = SpanKernelRun(*ptr, end, set.Rows, max);
+    *ptr += count;
+  }
+#endif
+  // the bytes above 127 are characters of their own
+  for (; count < max && set.Contains(GetByte(*ptr, end)); count++)
+    (*ptr)++;
+  return count;
+}
+
+#ifdef SPEG_SIMD
+// the first byte above 127 in [ptr, end), or end.. as the span kernels 
+// the bytes around the aligned blocks are checked one by one
+typedef const unsigned char* (*SkipKernel)(const unsigned char* ptr
+      , const unsigned char* end);
+
+__attribute__((target("sse2")))
+static const unsigned char* SkipASCIISSE2(const unsigned char* ptr
+      , const unsigned char* end) {
+  for (; ptr < end && (reinterpret_cast<size_t>(ptr) & 15); ptr++) {
+    if (*ptr >= 0x80)
+      return ptr;
+  }
+  for (; end - ptr >= 16; ptr += 16) {
+    unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+          _mm_load_si128(reinterpret_cast<const __m128i*>(ptr))));
+    if (mask)
+      return ptr + __builtin_ctz(mask);
+  }
+  for (; ptr < end && *ptr < 0x80; ptr++) {}
+  return ptr;
+}
+
+static SkipKernel SelectSkipKernel() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2"))
+    return SkipASCIISSE2;
+  return NULL;
+}
+
+static const SkipKernel skipKernel = SelectSkipKernel();
+#endif
+
+static const unsigned char* SkipASCII(const unsigned char* ptr
+      , const unsigned char* end) {
+#ifdef SPEG_SIMD
+  if (skipKernel)
+    return skipKernel(ptr, end);
+#endif
+  while (ptr < end && *ptr < 0x80)
+    ptr++;
+  return ptr;
+}
+
+// the length of the well formed sequence at ptr, 0 if it is not, the 
+// second byte bounds come from the table of well formed sequences of the
+// Unicode standard (chapter 3)
+static size_t SequenceLength(const unsigned char* ptr
+      , const unsigned char* end) {
+  unsigned char low = 0x80;
+  unsigned char high = 0xBF;
+  size_t length;
+  if (ptr[0] >= 0xC2 && ptr[0] <= 0xDF) {
+    length = 2;
+  } else if (ptr[0] >= 0xE0 && ptr[0] <= 0xEF) {
+    length = 3;
+    if (ptr[0] == 0xE0)
+      low = 0xA0;
+    else if (ptr[0] == 0xED)
+      high = 0x9F;
+  } else if (ptr[0] >= 0xF0 && ptr[0] <= 0xF4) {
+    length = 4;
+    if (ptr[0] == 0xF0)
+      low = 0x90;
+    else if (ptr[0] == 0xF4)
+      high = 0x8F;
+  } else {
+    return 0;
+  }
+  if (end && static_cast<size_t>(end - ptr) < length)
+    return 0;
+  // the terminator fails the checks before the bytes after it are read
+  if (ptr[1] < low || ptr[1] > high)
+    return 0;
+  for (size_t i = 2; i < length; i++) {
+    if ((ptr[i] & 0xC0) != 0x80)
+      return 0;
+  }
+  return length;
+}
+
+DLL_PUBLIC TextForm ValidateUTF8(const char* str, const char* end
+      , const char** invalid) {
+  const unsigned char* ptr = reinterpret_cast<const unsigned char*>(str);
+  // the whole text is read anyway, its end bounds the block loads
+  const unsigned char* stop = reinterpret_cast<const unsigned char*>(
+        end ? end : str + strlen(str));
+  TextForm form = TF_ASCII;
+  for (;;) {
+    ptr = SkipASCII(ptr, stop);
+    if (ptr >= stop)
+      return form;
+    size_t length = SequenceLength(ptr, stop);
+    if (!length) {
+      if (invalid)
+        *invalid = reinterpret_cast<const char*>(ptr);
+      return TF_INVALID;
+    }
+    form = TF_UTF8;
+    ptr += length;
+  }
 }
 
 #ifdef CX11_SUPPORTED
@@ -137,6 +643,32 @@ DLL_PUBLIC bool SafeIfZero(unsigned long* pnum) {
   return InterlockedCompareExchange(pnum, *pnum, 0) == 0;
 }
 
+DLL_PUBLIC void SafeLock(unsigned long* lock) {
+  while (InterlockedExchange(reinterpret_cast<volatile long*>(lock), 1)) {}
+}
+
+DLL_PUBLIC void SafeUnlock(unsigned long* lock) {
+  InterlockedExchange(reinterpret_cast<volatile long*>(lock), 0);
+}
+
+DLL_PUBLIC void SafeStore(volatile long* slot, long value) {
+  InterlockedExchange(slot, value);
+}
+
+DLL_PUBLIC long SafeLoad(volatile long* slot) {
+  return InterlockedCompareExchange(slot, 0, 0);
+}
+
+DLL_PUBLIC unsigned long Clock() {
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return static_cast<unsigned long>(
+        counter.QuadPart / frequency.QuadPart * 1000000
+        + counter.QuadPart % frequency.QuadPart * 1000000
+          / frequency.QuadPart);
+}
+
 #elif defined __GNUC__
 
 DLL_PUBLIC void SafeIncrement(unsigned long *num) {
@@ -151,6 +683,36 @@ DLL_PUBLIC bool SafeIfZero(unsigned long* pnum) {
   return __sync_bool_compare_and_swap (pnum, 0, *pnum);
 }
 
+DLL_PUBLIC void SafeLock(unsigned long* lock) {
+  while (__sync_lock_test_and_set(lock, 1)) {}
+}
+
+DLL_PUBLIC void SafeUnlock(unsigned long* lock) {
+  __sync_lock_release(lock);
+}
+
+DLL_PUBLIC void SafeStore(volatile long* slot, long value) {
+  __sync_synchronize();
+  *slot = value;
+}
+
+DLL_PUBLIC long SafeLoad(volatile long* slot) {
+#ifdef __ATOMIC_ACQUIRE
+  return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#else
+  long value = *slot;
+  __sync_synchronize();
+  return value;
+#endif
+}
+
+DLL_PUBLIC unsigned long Clock() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<unsigned long>(now.tv_sec) * 1000000UL
+        + static_cast<unsigned long>(now.tv_nsec / 1000);
+}
+
 #else
 
 DLL_PUBLIC void SafeIncrement(unsigned long *num) {
@@ -165,6 +727,28 @@ DLL_PUBLIC bool SafeIfZero(unsigned long* pnum) {
   return *pnum == 0;
 }
 
+DLL_PUBLIC void SafeLock(unsigned long* lock) {
+  *lock = 1;
+}
+
+DLL_PUBLIC void SafeUnlock(unsigned long* lock) {
+  *lock = 0;
+}
+
+DLL_PUBLIC void SafeStore(volatile long* slot, long value) {
+  *slot = value;
+}
+
+DLL_PUBLIC long SafeLoad(volatile long* slot) {
+  return *slot;
+}
+
+DLL_PUBLIC unsigned long Clock() {
+  // processor time is the only portable clock that does not go back
+  return static_cast<unsigned long>(
+        static_cast<double>(clock()) * 1000000 / CLOCKS_PER_SEC);
+}
+
 #endif
 
 }  // namespace Utils
@@ -182,6 +766,25 @@ DLL_PUBLIC void NormalValidator::Release() {
   }
 }
 
+/**
+ * @brief Check() the validator through its Match(), a Context<> is passed
+ * as it is so its functions are called directly instead of through the 
+ * interface
+ * 
+ */
+template<typename __VALIDATOR>
+static inline bool Direct(const __VALIDATOR* validator
+        , ContextInterface* context) {
+  switch (context->Kind()) {
+    case CK_CHAR:
+      return validator->Match(static_cast<ContextA*>(context));
+    case CK_WCHAR:
+      return validator->Match(static_cast<ContextW*>(context));
+    default:
+      return validator->Match(context);
+  }
+}
+
 void UnaryValidator::Dispose() {
   Operand->Release();
 }
@@ -190,15 +793,73 @@ void BinaryValidator::Dispose() {
   FirstOperand->Release();
   SecondOperand->Release();
 }
+
+void NaryValidator::_Merge(ValidatorType type
+        , const vector<StringValidator*>& validators) {
+  for (size_t i = 0; i < validators.size(); i++) {
+    // the written cuts of a node are known from its flag, so a long 
+    // chain is not walked again at every link
+    vector<StringValidator*> single(1, validators[i]);
+    bool committed = Analysis::Cuts(single, Analysis::CUTS_WRITTEN);
+    _committed = _committed || committed;
+    // in (a > Commit() > b | c) | d the cut spares d
+    if (validators[i]->Type() == type && (type == VT_SEQ || !committed)) {
+      const vector<StringValidator*>& merged =
+            static_cast<NaryValidator*>(validators[i])->GetOperands();
+      Operands.insert(Operands.end(), merged.begin(), merged.end());
+    } else {
+      Operands.push_back(validators[i]);
+    }
+  }
+  for (size_t i = 0; i < Operands.size(); i++)
+    Operands[i]->AddReference();
+}
+
+void NaryValidator::Dispose() {
+  for (size_t i = 0; i < Operands.size(); i++)
+    Operands[i]->Release();
+}
 }  // namespace Core
 
 namespace Manipulators {
+/**
+ * @brief parse the validator through the context memo table
+ * 
+ */
+template<typename __VALIDATOR>
+static bool Memoized(const __VALIDATOR* validator
+        , Core::ContextInterface* context) {
+  if (!validator->CanMemoize())
+    return validator->Evaluate(context);
+
+  bool result;
+  if (context->Recall(validator, &result))
+    return result;
+
+  Core::Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = validator->Evaluate(context);
+  context->Memorize(validator, start, flags, mark, result);
+  return result;
+}
+
 bool SeqValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool SeqValidator::Match(__CONTEXT* context) const {
   Core::Position start = context->GetPosition();
 
-  if (FirstOperand->Check(context)) {
-	  context->AdjustPosition();
-    if (SecondOperand->Check(context)) {
+  if (Operands[0]->Check(context)) {
+    size_t i = 1;
+    for (; i < Operands.size(); i++) {
+      context->AdjustPosition();
+      if (!Operands[i]->Check(context))
+        break;
+    }
+    if (i == Operands.size()) {
       context->AddMatch(start);
       return true;
     }
@@ -207,9 +868,26 @@ bool SeqValidator::Check(Core::ContextInterface* context) const {
   return false;
 }
 
+DLL_PUBLIC bool UntilValidator::Seek(Core::ContextInterface* context)
+        const {
+  // the literals are matched case sensitively and without skipping spaces
+  if (_prefix.Empty()
+      || context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE)
+      || context->Flags().IsFlagSet(SPEG_IGNORESPACES))
+    return true;
+
+  // the unnamed matches of the primitives after the leading one are
+  // recorded even if the rule fails, so only the leading one is skipped
+  if (context->Flags().IsFlagSet(SPEG_MATCHUNNAMED))
+    return context->Seek(_leading);
+  return context->Seek(_prefix);
+}
+
 bool UntilValidator::Check(Core::ContextInterface* context) const {
   Core::Position start = context->GetPosition();
   do {
+    if (!Seek(context))
+      break;
     Core::Position before = context->GetPosition();
     if (Operand->Check(context)) {
       context->SetPosition(before);
@@ -240,33 +918,57 @@ bool AndValidator::Check(Core::ContextInterface* context) const {
 }
 
 bool OrValidator::Check(Core::ContextInterface* context) const {
+  if (context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Memoized(this, context);
+  return Evaluate(context);
+}
+
+bool OrValidator::Evaluate(Core::ContextInterface* context) const {
   Core::Position start = context->GetPosition();
-  if (!FirstOperand->Check(context)) {
-    if (!SecondOperand->Check(context))
-      return false;
+  _choice.Analyze(Operands);
+  unsigned int candidates = _choice.Table().Candidates(context);
+  for (size_t i = 0; i < Operands.size(); i++) {
+    if (!Analysis::Dispatch::Tries(candidates, i))
+      continue;
+    unsigned int state = _choice.Cuts() ? context->BeginCut() : 0;
+    bool success = Operands[i]->Check(context);
+    bool cut = _choice.Cuts() && context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      break;
   }
-  context->AddMatch(start);
-  return true;
+  return false;
 }
 
 bool GreedyOrValidator::Check(Core::ContextInterface* context) const {
+  if (context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Memoized(this, context);
+  return Evaluate(context);
+}
+
+bool GreedyOrValidator::Evaluate(Core::ContextInterface* context) const {
   Core::Position start = context->GetPosition();
+  _choice.Analyze(Operands);
+  unsigned int candidates = _choice.Table().Candidates(context);
   bool success = false;
-  if (FirstOperand->Check(context)) {
-    success = true;
-  }
-
-  Core::Position first = context->GetPosition();
-
-  context->SetPosition(start);
-  if (SecondOperand->Check(context)) {
-    success = true;
+  Core::Position longest = start;
+  for (size_t i = 0; i < Operands.size(); i++) {
+    context->SetPosition(start);
+    if (!Analysis::Dispatch::Tries(candidates, i))
+      continue;
+    unsigned int state = _choice.Cuts() ? context->BeginCut() : 0;
+    if (Operands[i]->Check(context))
+      success = true;
+    longest = MAXIMUM(longest, context->GetPosition());
+    if (_choice.Cuts() && context->EndCut(state))
+      break;
   }
 
-  Core::Position second = context->GetPosition();
-
   if (success) {
-    context->SetPosition(MAXIMUM(first, second));
+    context->SetPosition(longest);
     context->AddMatch(start);
     return true;
   }
@@ -296,11 +998,10 @@ bool LookBackValidator::Check(Core::ContextInterface* context) const {
   Core::Position start = context->GetPosition();
   while (context->Backward()) {
     Core::Position newStart = context->GetPosition();
-    if (Operand->Check(context)) {
-      if (context->GetPosition() == start)
-        return true;
-      context->SetPosition(newStart);
-    }
+    if (Operand->Check(context) && context->GetPosition() == start)
+      return true;
+    // a failed operand may have skipped the spaces it began with
+    context->SetPosition(newStart);
   }
   context->SetPosition(start);
   return false;
@@ -327,109 +1028,3937 @@ bool CallBackValidator::Check(Core::ContextInterface* context) const {
 
 }  // namespace Manipulators
 
-namespace Primitives {
-bool BOTValidator::Check(Core::ContextInterface* context) const {
-  return context->BOT();
+namespace Primitives {
+bool BOTValidator::Check(Core::ContextInterface* context) const {
+  return context->BOT();
+}
+
+template<typename __CONTEXT>
+static inline bool MatchAny(__CONTEXT* context) {
+  Core::Position start = context->GetPosition();
+  if (context->Forward()) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+// the literals are given as they are and converted to lower case, Get()
+// returns the lower case character in case insensitive mode so it is
+// compared with the converted ones without converting them again
+
+template<typename __CONTEXT>
+static inline bool Folds(__CONTEXT* context) {
+  return context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);
+}
+
+template<typename __CONTEXT>
+static inline bool MatchChar(__CONTEXT* context, SChar chr, SChar folded) {
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+  if (context->Get() == (Folds(context) ? folded : chr)) {
+    context->Forward();
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template<typename __CONTEXT>
+static inline bool MatchSet(__CONTEXT* context, const SChar* set
+        , const SChar* folded, size_t size) {
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+  SChar chr = context->Get();
+  if (Folds(context))
+    set = folded;
+  for (size_t i = 0; i < size; i++) {
+    if (chr == set[i]) {
+      context->Forward();
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename __CONTEXT>
+static inline bool MatchRange(__CONTEXT* context, SChar min, SChar max
+        , SChar foldedMin, SChar foldedMax) {
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+  SChar chr = context->Get();
+  if (Folds(context)) {
+    min = foldedMin;
+    max = foldedMax;
+  }
+  if (chr >= min && chr <= max && context->Forward()) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template<typename __CONTEXT>
+static inline bool MatchClass(__CONTEXT* context
+        , const Utils::CharClass& sensitive
+        , const Utils::CharClass& folded) {
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+  const Utils::CharClass& set = Folds(context) ? folded : sensitive;
+  if (set.Contains(context->Get()) && context->Forward()) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template<typename __CONTEXT>
+static inline bool MatchPhrase(__CONTEXT* context, const SChar* phrase
+        , const SChar* folded, size_t size) {
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+  if (Folds(context))
+    phrase = folded;
+  for (size_t i = 0; i < size; i++) {
+    if (context->Get() != phrase[i]) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->Forward();
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template<typename __CONTEXT>
+static inline bool MatchInChain(__CONTEXT* context) {
+  Core::Position start = context->GetPosition();
+  SChar curr = context->Get();
+  if (context->Backward()) {
+    SChar prev = context->Get();
+    context->Forward();
+    if (prev == curr - 1 && context->Forward()) {
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool AnyValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool AnyValidator::Match(__CONTEXT* context) const {
+  return MatchAny(context);
+}
+
+bool CommitValidator::Check(Core::ContextInterface* context) const {
+  context->Commit();
+  return true;
+}
+
+bool CharValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool CharValidator::Match(__CONTEXT* context) const {
+  return MatchChar(context, _character, _folded);
+}
+
+bool CharSetValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool CharSetValidator::Match(__CONTEXT* context) const {
+  if (_set.empty())
+    return MatchSet(context, NULL, NULL, 0);
+  return MatchSet(context, &_set[0], &_folded[0], _set.size());
+}
+
+bool CharRangeValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool CharRangeValidator::Match(__CONTEXT* context) const {
+  return MatchRange(context, _min, _max, _foldedMin, _foldedMax);
+}
+
+DLL_PUBLIC PropertyValidator::PropertyValidator(const Utils::CharClass& chars)
+  : _sensitive(chars) {
+  // Cc holds the terminator, the end of text is not a character
+  _sensitive.Remove(0);
+  Utils::Unfold(&_folded, _sensitive);
+}
+
+bool PropertyValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool PropertyValidator::Match(__CONTEXT* context) const {
+  return MatchClass(context, _sensitive, _folded);
+}
+
+bool PhraseValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool PhraseValidator::Match(__CONTEXT* context) const {
+  if (_phrase.empty())
+    return MatchPhrase(context, NULL, NULL, 0);
+  return MatchPhrase(context, &_phrase[0], &_folded[0], _phrase.size());
+}
+
+bool InChainValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool InChainValidator::Match(__CONTEXT* context) const {
+  return MatchInChain(context);
+}
+
+DLL_PUBLIC TrieValidator::TrieValidator(
+        const vector<vector<SChar> >& phrases
+        , const vector<unsigned int>& depths)
+  : _phrases(phrases)
+  , _depths(depths) {
+  _Build(&_sensitive, false);
+  _Build(&_folded, true);
+}
+
+void TrieValidator::_Build(vector<Node>* trie, bool fold) {
+  unsigned int none = static_cast<unsigned int>(_phrases.size());
+  Node root;
+  root.Phrase = none;
+  root.Below = none;
+  trie->push_back(root);
+
+  for (unsigned int p = 0; p < _phrases.size(); p++) {
+    unsigned int node = 0;
+    for (size_t i = 0; i < _phrases[p].size(); i++) {
+      SChar chr = fold ? Utils::CharToLower(_phrases[p][i]) : _phrases[p][i];
+      if ((*trie)[node].Below > p)
+        (*trie)[node].Below = p;
+
+      unsigned int next = _Next(*trie, node, chr);
+      if (!next) {
+        next = static_cast<unsigned int>(trie->size());
+        Node child;
+        child.Phrase = none;
+        child.Below = none;
+        trie->push_back(child);
+
+        vector<pair<SChar, unsigned int> >& edges = (*trie)[node].Edges;
+        vector<pair<SChar, unsigned int> >::iterator it = edges.begin();
+        while (it != edges.end() && it->first < chr)
+          ++it;
+        edges.insert(it, make_pair(chr, next));
+      }
+      node = next;
+    }
+    // the earlier phrase wins over the later duplicate
+    if ((*trie)[node].Phrase > p)
+      (*trie)[node].Phrase = p;
+  }
+}
+
+unsigned int TrieValidator::_Next(const vector<Node>& trie
+        , unsigned int node
+        , SChar chr) {
+  const vector<pair<SChar, unsigned int> >& edges = trie[node].Edges;
+  size_t low = 0;
+  size_t high = edges.size();
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (edges[mid].first < chr)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  if (low < edges.size() && edges[low].first == chr)
+    return edges[low].second;
+  return 0;
+}
+
+bool TrieValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool TrieValidator::Match(__CONTEXT* context) const {
+  Core::Position entry = context->GetPosition();
+  context->AdjustPosition();
+  Core::Position start = context->GetPosition();
+
+  // Get() returns the lower case character in case insensitive mode
+  const vector<Node>& trie =
+        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE) ? _folded : _sensitive;
+  unsigned int best = trie[0].Phrase;
+  Core::Position end = start;
+  unsigned int node = 0;
+
+  // stop once no phrase below can precede the best one
+  while (trie[node].Below < best) {
+    node = _Next(trie, node, context->Get());
+    if (!node || !context->Forward())
+      break;
+    if (trie[node].Phrase < best) {
+      best = trie[node].Phrase;
+      end = context->GetPosition();
+    }
+  }
+
+  if (best == _phrases.size()) {
+    context->SetPosition(start);
+    return false;
+  }
+
+  context->SetPosition(end);
+  context->AddMatch(start);
+  for (unsigned int i = 0; i < _depths[best]; i++)
+    context->AddMatch(entry);
+  return true;
+}
+DLL_PUBLIC CharClassValidator::CharClassValidator(
+        const Utils::CharClass& sensitive
+        , const Utils::CharClass& folded
+        , Core::StringValidator* tree)
+  : _sensitive(sensitive)
+  , _folded(folded)
+  , _tree(tree) {
+  _tree->AddReference();
+}
+
+void CharClassValidator::Dispose() {
+  _tree->Release();
+}
+
+bool CharClassValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool CharClassValidator::Match(__CONTEXT* context) const {
+  Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return _tree->Check(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  const Utils::CharClass& set =
+        flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? _folded : _sensitive;
+  if (set.Contains(context->Get()))
+    return context->Forward();
+  return false;
+}
+
+DLL_PUBLIC bool Classify(const Core::StringValidator* validator
+        , Utils::CharClass* sensitive
+        , Utils::CharClass* folded) {
+  switch (validator->Type()) {
+    case Core::VT_CLASS: {
+      const CharClassValidator* fused =
+            static_cast<const CharClassValidator*>(validator);
+      *sensitive = fused->Sensitive();
+      *folded = fused->Folded();
+      return true;
+    }
+    case Core::VT_PROPERTY: {
+      const PropertyValidator* property =
+            static_cast<const PropertyValidator*>(validator);
+      *sensitive = property->Sensitive();
+      *folded = property->Folded();
+      return true;
+    }
+    case Core::VT_ANY:
+      sensitive->AddRange(1, (SChar)-1);
+      folded->AddRange(1, (SChar)-1);
+      return true;
+    case Core::VT_IS:
+    case Core::VT_IN: {
+      // Is('\0') and In() with '\0' match end of text without moving
+      vector<SChar> chars;
+      if (validator->Type() == Core::VT_IS)
+        chars.push_back(static_cast<const CharValidator*>(validator)
+              ->Character());
+      else
+        chars = static_cast<const CharSetValidator*>(validator)
+              ->Characters();
+
+      for (size_t i = 0; i < chars.size(); i++) {
+        if (!chars[i])
+          return false;
+        sensitive->Add(chars[i]);
+        folded->Add(chars[i]);
+        SChar lower = Utils::CharToLower(chars[i]);
+        Utils::Unfold(folded, lower, lower);
+      }
+      return true;
+    }
+    case Core::VT_BETWEEN: {
+      const CharRangeValidator* range =
+            static_cast<const CharRangeValidator*>(validator);
+      sensitive->AddRange(range->Min(), range->Max());
+      sensitive->Remove(0);
+      Utils::Unfold(folded, Utils::CharToLower(range->Min())
+            , Utils::CharToLower(range->Max()));
+      folded->Remove(0);
+      return true;
+    }
+    case Core::VT_OR: {
+      const Core::NaryValidator* choice =
+            static_cast<const Core::NaryValidator*>(validator);
+      if (!Classify(choice->GetOperand(0), sensitive, folded))
+        return false;
+      for (size_t i = 1; i < choice->Count(); i++) {
+        Utils::CharClass otherSensitive;
+        Utils::CharClass otherFolded;
+        if (!Classify(choice->GetOperand(i), &otherSensitive, &otherFolded))
+          return false;
+        sensitive->Unite(otherSensitive);
+        folded->Unite(otherFolded);
+      }
+      return true;
+    }
+    case Core::VT_AND: {
+      // a & b, a & !b and !a & b
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      const Core::StringValidator* first = binary->GetFirstOperand();
+      const Core::StringValidator* second = binary->GetSecondOperand();
+      bool subtract = false;
+      if (first->Type() == Core::VT_NOT) {
+        const Core::StringValidator* swap = first;
+        first = second;
+        second = swap;
+      }
+      if (second->Type() == Core::VT_NOT) {
+        second = static_cast<const Core::UnaryValidator*>(second)
+                    ->GetOperand();
+        subtract = true;
+      }
+
+      Utils::CharClass otherSensitive;
+      Utils::CharClass otherFolded;
+      if (first->Type() == Core::VT_NOT
+          || !Classify(first, sensitive, folded)
+          || !Classify(second, &otherSensitive, &otherFolded))
+        return false;
+      if (subtract) {
+        sensitive->Subtract(otherSensitive);
+        folded->Subtract(otherFolded);
+      } else {
+        sensitive->Intersect(otherSensitive);
+        folded->Intersect(otherFolded);
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+DLL_PUBLIC Core::StringValidator* Fuse(Core::StringValidator* tree) {
+  Utils::CharClass sensitive;
+  Utils::CharClass folded;
+  if (!Classify(tree, &sensitive, &folded))
+    return tree;
+  return new CharClassValidator(sensitive, folded, tree);
+}
+}  // namespace Primitives
+
+namespace StateKeepers {
+bool CaseModifier::Check(Core::ContextInterface* context) const {
+  context->Flags().SetFlag(SPEG_CASEINSENSITIVE, _caseSensitive);
+  return true;
+}
+
+bool SetFlagModifier::Check(Core::ContextInterface* context) const {
+  context->SetVar(_flag, _value);
+  return true;
+}
+
+bool DelFlagModifier::Check(Core::ContextInterface* context) const {
+  context->DelVar(_flag);
+  return true;
+}
+
+bool IfValidator::Check(Core::ContextInterface* context) const {
+  const char *val = NULL;
+  if (context->GetVar(_flag, &val)) {
+    return strcmp(_value, val) == 0;
+  }
+  return false;
+}
+
+bool IfMatchedValidator::Check(Core::ContextInterface* context) const {
+  unsigned int num = context->NumberOfMatches(_key);
+  return (num >= _min && num <= _max);
+}
+
+}  // namespace StateKeepers
+
+namespace Manipulators {
+DLL_PUBLIC void RepeatValidator::_Classify() {
+  _span = Primitives::Classify(Operand, &_sensitive, &_folded);
+}
+
+bool RepeatValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool RepeatValidator::Match(__CONTEXT* context) const {
+  Core::Position start = context->GetPosition();
+  if (Spans(context)) {
+    size_t count = context->Span(
+          context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE)
+          ? _folded : _sensitive, _maxIter);
+    if (count < _minIter) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < _maxIter; counter++) {
+    Core::Position startOp = context->GetPosition();
+    if (!Operand->Check(context)
+        || (context->GetPosition() == startOp && !context->Step())) {
+      if (counter >= _minIter) {
+        break;
+      } else {
+        context->SetPosition(start);
+        return false;
+      }
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+bool RefValidator::Check(Core::ContextInterface* context) const {
+  if (context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Memoized(this, context);
+  return Evaluate(context);
+}
+
+bool RefValidator::Evaluate(Core::ContextInterface* context) const {
+  Core::Position start = context->GetPosition();
+  if (!_validator) {
+    if (_rule->Get()->Check(context)) {
+      context->AddMatch(start);
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  if (_validator && _validator->Check(context)) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+bool MemoValidator::Check(Core::ContextInterface* context) const {
+  return Memoized(this, context);
+}
+
+DLL_PUBLIC void RefValidator::Set(const Core::Rule &rule) {
+  _validator = rule.Get();
+  _memoizable.Reset();
+}
+
+DLL_PUBLIC Core::StringValidator* RefValidator::Target() const {
+  if (_validator)
+    return _validator;
+  return _rule ? _rule->Get() : NULL;
+}
+
+}  // namespace Manipulators
+
+namespace Analysis {
+// the first sets computed so far and the case mode they are computed for
+struct ANALYZED {
+  map<const Core::StringValidator*, FirstSet> Sets;
+  bool Folded;
+};
+
+static void AddAll(FirstSet* set) {
+  memset(set->Chars, 0xFF, sizeof(set->Chars));
+  set->Beyond = true;
+}
+
+static void Unite(FirstSet* set, const FirstSet& other) {
+  for (size_t i = 0; i < sizeof(set->Chars); i++)
+    set->Chars[i] |= other.Chars[i];
+  set->Beyond = set->Beyond || other.Beyond;
+}
+
+static void Intersect(FirstSet* set, const FirstSet& other) {
+  for (size_t i = 0; i < sizeof(set->Chars); i++)
+    set->Chars[i] &= other.Chars[i];
+  set->Beyond = set->Beyond && other.Beyond;
+}
+
+// both the characters and their case variants if folded, since the case 
+// mode may be changed while parsing
+static void AddRange(FirstSet* set, SChar min, SChar max, bool folded) {
+  Utils::CharClass chars;
+  chars.AddRange(min, max);
+  if (folded)
+    Utils::Unfold(&chars, Utils::CharToLower(min), Utils::CharToLower(max));
+  for (SChar c = 0; c < 256; c++) {
+    if (chars.Contains(c))
+      set->Add(c);
+  }
+  if (!chars.Ranges.empty())
+    set->Beyond = true;
+}
+
+static void AddChar(FirstSet* set, SChar chr, bool folded) {
+  AddRange(set, chr, chr, folded);
+}
+
+static void AddClass(FirstSet* set, const Utils::CharClass& sensitive
+        , const Utils::CharClass& folded, bool both) {
+  for (size_t i = 0; i < sizeof(set->Chars); i++)
+    set->Chars[i] |= sensitive.Bits[i] | (both ? folded.Bits[i] : 0);
+  if (!sensitive.Ranges.empty() || (both && !folded.Ranges.empty()))
+    set->Beyond = true;
+}
+
+static FirstSet Universal(bool pure) {
+  FirstSet set;
+  AddAll(&set);
+  set.Nullable = true;
+  set.Pure = pure;
+  return set;
+}
+
+static FirstSet Empty(bool pure) {
+  FirstSet set;
+  set.Nullable = true;
+  set.Pure = pure;
+  return set;
+}
+
+static FirstSet Analyze(const Core::StringValidator* validator
+        , ANALYZED* analyzed) {
+  map<const Core::StringValidator*, FirstSet>::iterator it =
+        analyzed->Sets.find(validator);
+  if (it != analyzed->Sets.end())
+    return it->second;
+
+  // a validator that reaches itself is not resolved while analyzing
+  analyzed->Sets[validator] = Universal(false);
+
+  FirstSet set;
+  switch (validator->Type()) {
+    case Core::VT_IS:
+      AddChar(&set, static_cast<const Primitives::CharValidator*>(validator)
+                ->Character(), analyzed->Folded);
+      break;
+    case Core::VT_IN: {
+      const vector<SChar>& chars =
+            static_cast<const Primitives::CharSetValidator*>(validator)
+              ->Characters();
+      for (size_t i = 0; i < chars.size(); i++)
+        AddChar(&set, chars[i], analyzed->Folded);
+      break;
+    }
+    case Core::VT_BETWEEN: {
+      const Primitives::CharRangeValidator* range =
+            static_cast<const Primitives::CharRangeValidator*>(validator);
+      AddRange(&set, range->Min(), range->Max(), analyzed->Folded);
+      break;
+    }
+    case Core::VT_EXACT: {
+      const vector<SChar>& phrase =
+            static_cast<const Primitives::PhraseValidator*>(validator)
+              ->Phrase();
+      if (phrase.empty())
+        set.Nullable = true;
+      else
+        AddChar(&set, phrase[0], analyzed->Folded);
+      break;
+    }
+    case Core::VT_TRIE: {
+      const vector<vector<SChar> >& phrases =
+            static_cast<const Primitives::TrieValidator*>(validator)
+              ->Phrases();
+      for (size_t i = 0; i < phrases.size(); i++) {
+        if (phrases[i].empty())
+          set.Nullable = true;
+        else
+          AddChar(&set, phrases[i][0], analyzed->Folded);
+      }
+      break;
+    }
+    case Core::VT_CLASS: {
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(validator);
+      AddClass(&set, fused->Sensitive(), fused->Folded(), analyzed->Folded);
+      break;
+    }
+    case Core::VT_PROPERTY: {
+      const Primitives::PropertyValidator* property =
+            static_cast<const Primitives::PropertyValidator*>(validator);
+      AddClass(&set, property->Sensitive(), property->Folded()
+            , analyzed->Folded);
+      break;
+    }
+    case Core::VT_ANY:
+    case Core::VT_INCHAIN:
+      // both fail on end of text
+      AddAll(&set);
+      set.Chars[0] &= ~1;
+      break;
+    case Core::VT_BOT:
+    case Core::VT_IF:
+    case Core::VT_IFMATCHED:
+      set = Empty(true);
+      break;
+    case Core::VT_CASE:
+    case Core::VT_SETVAR:
+    case Core::VT_DELVAR:
+    case Core::VT_COMMIT:
+      set = Empty(false);
+      break;
+    case Core::VT_SEQ: {
+      // the operands after one that consumes a character are not reached
+      // when the sequence starts with another character, so their side
+      // effects do not stop it from being skipped
+      const Core::NaryValidator* seq =
+            static_cast<const Core::NaryValidator*>(validator);
+      set = Analyze(seq->GetOperand(0), analyzed);
+      for (size_t i = 1; i < seq->Count() && set.Nullable; i++) {
+        FirstSet next = Analyze(seq->GetOperand(i), analyzed);
+        Unite(&set, next);
+        set.Nullable = next.Nullable;
+        set.Pure = set.Pure && next.Pure;
+      }
+      break;
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      set = Analyze(binary->GetFirstOperand(), analyzed);
+      FirstSet second = Analyze(binary->GetSecondOperand(), analyzed);
+      // it fails once any of the non nullable operands fails
+      if (!set.Nullable && !second.Nullable) {
+        Intersect(&set, second);
+      } else if (set.Nullable && !second.Nullable) {
+        memcpy(set.Chars, second.Chars, sizeof(set.Chars));
+        set.Beyond = second.Beyond;
+      } else if (set.Nullable && second.Nullable) {
+        Unite(&set, second);
+      }
+      set.Nullable = set.Nullable && second.Nullable;
+      set.Pure = set.Pure && second.Pure;
+      break;
+    }
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* choice =
+            static_cast<const Core::NaryValidator*>(validator);
+      set = Analyze(choice->GetOperand(0), analyzed);
+      for (size_t i = 1; i < choice->Count(); i++) {
+        FirstSet next = Analyze(choice->GetOperand(i), analyzed);
+        Unite(&set, next);
+        set.Nullable = set.Nullable || next.Nullable;
+        set.Pure = set.Pure && next.Pure;
+      }
+      break;
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKBACK:
+      set = Empty(Analyze(static_cast<const Core::UnaryValidator*>(validator)
+                ->GetOperand(), analyzed).Pure);
+      break;
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_MEMO:
+      set = Analyze(static_cast<const Core::UnaryValidator*>(validator)
+                ->GetOperand(), analyzed);
+      break;
+    case Core::VT_UNTIL:
+      set = Universal(Analyze(static_cast<const Core::UnaryValidator*>(
+                validator)->GetOperand(), analyzed).Pure);
+      break;
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      set = Analyze(repeat->GetOperand(), analyzed);
+      if (repeat->MinIterations() == 0 || repeat->MaxIterations() == 0)
+        set.Nullable = true;
+      break;
+    }
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+      set = Analyze(static_cast<const Core::UnaryValidator*>(validator)
+                ->GetOperand(), analyzed);
+      set.Pure = false;
+      break;
+    case Core::VT_PROGRAM:
+      set = Analyze(static_cast<const Engine::ProgramValidator*>(validator)
+                ->Root(), analyzed);
+      break;
+    case Core::VT_AUTOMATON:
+      set = Analyze(static_cast<const Engine::AutomatonValidator*>(
+                validator)->Root(), analyzed);
+      break;
+    default:
+      // references may be redirected later, custom validators are unknown
+      set = Universal(false);
+      break;
+  }
+
+  analyzed->Sets[validator] = set;
+  return set;
+}
+
+DLL_PUBLIC FirstSet First(const Core::StringValidator* validator
+        , bool folded) {
+  ANALYZED analyzed;
+  analyzed.Folded = folded;
+  return Analyze(validator, &analyzed);
+}
+
+static bool Cuts(const Core::StringValidator* validator, CutsMode mode
+        , std::set<const Core::StringValidator*>* visited) {
+  if (!visited->insert(validator).second)
+    return false;
+  switch (validator->Type()) {
+    case Core::VT_COMMIT:
+      return true;
+    case Core::VT_CUSTOM:
+      return mode != CUTS_WRITTEN;
+    case Core::VT_REF: {
+      // the rule of Ref(rule) may still be under construction
+      if (mode != CUTS_INJECTED)
+        return mode == CUTS_ASSUMED;
+      const Core::StringValidator* target =
+            static_cast<const Manipulators::RefValidator*>(validator)
+              ->Target();
+      return !target || Cuts(target, mode, visited);
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      if (mode == CUTS_WRITTEN)
+        return nary->Committed();
+      for (size_t i = 0; i < nary->Count(); i++) {
+        if (Cuts(nary->GetOperand(i), mode, visited))
+          return true;
+      }
+      return false;
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      return Cuts(binary->GetFirstOperand(), mode, visited)
+            || Cuts(binary->GetSecondOperand(), mode, visited);
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_MEMO:
+      return Cuts(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand(), mode, visited);
+    case Core::VT_PROGRAM:
+      return Cuts(static_cast<const Engine::ProgramValidator*>(validator)
+            ->Root(), mode, visited);
+    default:
+      // primitives and automata (only built from regular trees)
+      return false;
+  }
+}
+
+static bool Stateful(const Core::StringValidator* validator
+        , std::set<const Core::StringValidator*>* visited) {
+  if (!visited->insert(validator).second)
+    return false;
+  switch (validator->Type()) {
+    case Core::VT_SETVAR:
+    case Core::VT_DELVAR:
+    case Core::VT_IF:
+    case Core::VT_IFMATCHED:
+      return true;
+    case Core::VT_REF: {
+      const Core::StringValidator* target =
+            static_cast<const Manipulators::RefValidator*>(validator)
+              ->Target();
+      return !target || Stateful(target, visited);
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < nary->Count(); i++) {
+        if (Stateful(nary->GetOperand(i), visited))
+          return true;
+      }
+      return false;
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      return Stateful(binary->GetFirstOperand(), visited)
+            || Stateful(binary->GetSecondOperand(), visited);
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_MEMO:
+      return Stateful(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand(), visited);
+    case Core::VT_PROGRAM:
+      return Stateful(static_cast<const Engine::ProgramValidator*>(
+            validator)->Root(), visited);
+    default:
+      // primitives, automata (only built from regular trees) and custom 
+      // validators, that are not replayed as the callbacks
+      return false;
+  }
+}
+
+DLL_PUBLIC bool Stateful(const Core::StringValidator* validator) {
+  std::set<const Core::StringValidator*> visited;
+  return Stateful(validator, &visited);
+}
+
+DLL_PUBLIC bool Cuts(const vector<Core::StringValidator*>& alternatives
+        , CutsMode mode) {
+  std::set<const Core::StringValidator*> visited;
+  for (size_t i = 0; i < alternatives.size(); i++) {
+    if (Cuts(alternatives[i], mode, &visited))
+      return true;
+  }
+  return false;
+}
+
+// the literals are sought in their encoded form, the end of text and 
+// SPEG_NUL have none
+static bool Seekable(SChar chr) {
+  return chr && chr < SPEG_NUL;
+}
+
+// returns true if the validator matches exactly the appended characters,
+// so the literal of the next validator in sequence can be appended
+static bool AppendPrefix(const Core::StringValidator* validator
+        , bool extend
+        , vector<SChar>* prefix) {
+  switch (validator->Type()) {
+    case Core::VT_IS: {
+      SChar chr = static_cast<const Primitives::CharValidator*>(validator)
+                    ->Character();
+      if (!Seekable(chr))
+        return false;
+      prefix->push_back(chr);
+      return true;
+    }
+    case Core::VT_EXACT: {
+      const vector<SChar>& phrase =
+            static_cast<const Primitives::PhraseValidator*>(validator)
+              ->Phrase();
+      for (size_t i = 0; i < phrase.size(); i++) {
+        if (!Seekable(phrase[i]))
+          return false;
+        prefix->push_back(phrase[i]);
+      }
+      return true;
+    }
+    case Core::VT_SEQ: {
+      const Core::NaryValidator* seq =
+            static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < seq->Count(); i++) {
+        if (i > 0 && !extend && !prefix->empty())
+          return false;
+        if (!AppendPrefix(seq->GetOperand(i), extend, prefix))
+          return false;
+      }
+      return true;
+    }
+    case Core::VT_AND: {
+      AppendPrefix(static_cast<const Core::BinaryValidator*>(validator)
+            ->GetFirstOperand(), extend, prefix);
+      return false;
+    }
+    case Core::VT_COMMIT:
+      return true;
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      if (repeat->MinIterations() > 0 && repeat->MaxIterations() > 0)
+        AppendPrefix(repeat->GetOperand(), extend, prefix);
+      return false;
+    }
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_MEMO:
+      AppendPrefix(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand(), extend, prefix);
+      return false;
+    case Core::VT_PROGRAM:
+      return AppendPrefix(static_cast<const Engine::ProgramValidator*>(
+            validator)->Root(), extend, prefix);
+    case Core::VT_AUTOMATON:
+      return AppendPrefix(static_cast<const Engine::AutomatonValidator*>(
+            validator)->Root(), extend, prefix);
+    default:
+      return false;
+  }
+}
+
+DLL_PUBLIC vector<SChar> Prefix(const Core::StringValidator* validator
+        , bool extend) {
+  vector<SChar> prefix;
+  AppendPrefix(validator, extend, &prefix);
+  return prefix;
+}
+
+DLL_PUBLIC Dispatch::Dispatch(
+        const vector<Core::StringValidator*>& alternatives) {
+  for (SChar c = 0; c < 256; c++)
+    _table[c] = SPEG_CHOICE_ALL;
+  _beyond = SPEG_CHOICE_ALL;
+  _active = false;
+
+  // alternatives beyond the mask are always tried
+  size_t count = MINIMUM(alternatives.size()
+        , static_cast<size_t>(SPEG_CHOICE_BITS));
+  for (size_t i = 0; i < count; i++) {
+    FirstSet set = First(alternatives[i]);
+    if (!set.Pure || set.Nullable)
+      continue;
+    _active = true;
+    unsigned int bit = 1U << i;
+    for (SChar c = 0; c < 256; c++) {
+      if (!set.Contains(c))
+        _table[c] &= ~bit;
+    }
+    if (!set.Beyond)
+      _beyond &= ~bit;
+  }
+}
+
+DLL_PUBLIC void Choice::_Analyze(
+        const vector<Core::StringValidator*>& alternatives) {
+  Utils::SafeLock(&_lock);
+  if (!_analyzed) {
+    _dispatch = Dispatch(alternatives);
+    _cuts = Analysis::Cuts(alternatives);
+    Utils::SafeStore(&_analyzed, 1);
+  }
+  Utils::SafeUnlock(&_lock);
+}
+}  // namespace Analysis
+
+namespace Engine {
+// whether the phrase can be passed to Skip(), the characters are ASCII
+static bool Ascii(const vector<SChar>& phrase) {
+  for (size_t i = 0; i < phrase.size(); i++) {
+    if (!phrase[i] || phrase[i] >= 0x80)
+      return false;
+  }
+  return !phrase.empty();
+}
+
+DLL_PUBLIC ProgramValidator::ProgramValidator(Core::StringValidator* root)
+  : _root(root) {
+  _root->AddReference();
+  EMITTED emitted;
+  _entry = _Emit(_root, &emitted);
+}
+
+void ProgramValidator::Dispose() {
+  _root->Release();
+}
+
+vector<unsigned int> ProgramValidator::_Fuse(
+        const vector<unsigned int>& pcs) {
+  vector<unsigned int> fused;
+  for (size_t i = 0; i < pcs.size();) {
+    // the run of ASCII characters and phrases starting at i
+    string run;
+    size_t end = i;
+    for (; end < pcs.size(); end++) {
+      const Instruction& ins = _code[pcs[end]];
+      if (ins.Op == Core::VT_IS && ins.Low && ins.Low < 0x80)
+        run += static_cast<char>(ins.Low);
+      else if (ins.Op == Core::VT_EXACT && ins.Low)
+        run.append(_text, ins.High, ins.Second);
+      else
+        break;
+    }
+    if (end - i < 2) {
+      fused.push_back(pcs[i]);
+      i++;
+      continue;
+    }
+
+    Instruction phrase;
+    phrase.Op = Core::VT_EXACT;
+    phrase.First = 0;
+    phrase.Second = static_cast<unsigned int>(run.size());
+    phrase.Low = 1;
+    phrase.High = _text.size();
+    phrase.Data = NULL;
+    phrase.Extra = NULL;
+    _text += run;
+    fused.push_back(static_cast<unsigned int>(_code.size()));
+    _code.push_back(phrase);
+    i = end;
+  }
+  return fused;
+}
+
+// the characters a search skips before trying its operand, the terminator
+// stops the span whatever the class is
+static Utils::CharClass Skipped(const Analysis::FirstSet& first) {
+  Utils::CharClass skip;
+  for (SChar chr = 1; chr < 256; chr++) {
+    if (!first.Contains(chr))
+      skip.Add(chr);
+  }
+  if (!first.Beyond)
+    skip.AddRange(256, 0x10FFFF);
+  return skip;
+}
+
+unsigned int ProgramValidator::_Emit(const Core::StringValidator* validator
+        , EMITTED* emitted) {
+  EMITTED::iterator it = emitted->find(validator);
+  if (it != emitted->end())
+    return it->second;
+
+  // compiled programs are flattened into this one
+  if (validator->Type() == Core::VT_PROGRAM) {
+    unsigned int pc = _Emit(
+          static_cast<const ProgramValidator*>(validator)->Root(), emitted);
+    (*emitted)[validator] = pc;
+    return pc;
+  }
+
+  // the slot is reserved before the operands so recursive references
+  // can point to it
+  unsigned int pc = static_cast<unsigned int>(_code.size());
+  _code.push_back(Instruction());
+  (*emitted)[validator] = pc;
+
+  Instruction ins;
+  ins.Op = validator->Type();
+  ins.First = 0;
+  ins.Second = 0;
+  ins.Low = 0;
+  ins.High = 0;
+  ins.Data = NULL;
+  ins.Extra = NULL;
+
+  switch (ins.Op) {
+    case Core::VT_IS:
+      ins.Low = static_cast<const Primitives::CharValidator*>(validator)
+                  ->Character();
+      ins.High = Utils::CharToLower(ins.Low);
+      break;
+    case Core::VT_BETWEEN: {
+      const Primitives::CharRangeValidator* range =
+            static_cast<const Primitives::CharRangeValidator*>(validator);
+      ins.Low = range->Min();
+      ins.High = range->Max();
+      ins.First = static_cast<unsigned int>(_pool.size());
+      _pool.push_back(Utils::CharToLower(ins.Low));
+      _pool.push_back(Utils::CharToLower(ins.High));
+      break;
+    }
+    case Core::VT_IN:
+    case Core::VT_EXACT: {
+      const vector<SChar>& chars = (ins.Op == Core::VT_IN)
+        ? static_cast<const Primitives::CharSetValidator*>(validator)
+              ->Characters()
+        : static_cast<const Primitives::PhraseValidator*>(validator)
+              ->Phrase();
+      ins.First = static_cast<unsigned int>(_pool.size());
+      ins.Second = static_cast<unsigned int>(chars.size());
+      // followed by the lower case characters
+      _pool.insert(_pool.end(), chars.begin(), chars.end());
+      vector<SChar> folded = Utils::Fold(chars);
+      _pool.insert(_pool.end(), folded.begin(), folded.end());
+      if (ins.Op == Core::VT_EXACT && Ascii(chars)) {
+        ins.Low = 1;
+        ins.High = _text.size();
+        _text.insert(_text.end(), chars.begin(), chars.end());
+      }
+      break;
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      ins.First = _Emit(binary->GetFirstOperand(), emitted);
+      ins.Second = _Emit(binary->GetSecondOperand(), emitted);
+      break;
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const vector<Core::StringValidator*>& operands =
+            static_cast<const Core::NaryValidator*>(validator)->GetOperands();
+      // the operands are emitted before the list since they append 
+      // their own
+      vector<unsigned int> pcs;
+      for (size_t i = 0; i < operands.size(); i++)
+        pcs.push_back(_Emit(operands[i], emitted));
+      ins.First = static_cast<unsigned int>(_operands.size());
+      ins.Second = static_cast<unsigned int>(pcs.size());
+      _operands.insert(_operands.end(), pcs.begin(), pcs.end());
+      if (ins.Op == Core::VT_SEQ) {
+        vector<unsigned int> fused = _Fuse(pcs);
+        if (fused.size() < pcs.size()) {
+          ins.Low = _operands.size();
+          ins.High = fused.size();
+          _operands.insert(_operands.end(), fused.begin(), fused.end());
+        }
+      }
+      // the references are injected by now
+      if (ins.Op != Core::VT_SEQ)
+        ins.Low = Analysis::Cuts(operands, Analysis::CUTS_INJECTED);
+      if (ins.Op == Core::VT_OR)
+        ins.Extra = &static_cast<const Manipulators::OrValidator*>(
+              validator)->Choices();
+      else if (ins.Op == Core::VT_GREEDYOR)
+        ins.Extra = &static_cast<const Manipulators::GreedyOrValidator*>(
+              validator)->Choices();
+      break;
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_MEMO:
+      ins.First = _Emit(static_cast<const Core::UnaryValidator*>(validator)
+                    ->GetOperand(), emitted);
+      break;
+    case Core::VT_UNTIL: {
+      // it seeks the literal its operand starts with as the tree does, 
+      // then skips the characters its operand cannot start with if the 
+      // operand has no side effects
+      const Core::StringValidator* operand =
+            static_cast<const Core::UnaryValidator*>(validator)
+              ->GetOperand();
+      ins.First = _Emit(operand, emitted);
+      ins.Data = validator;
+      Analysis::FirstSet first = Analysis::First(operand);
+      if (first.Pure && !first.Nullable) {
+        _skips.push_back(Skipped(Analysis::First(operand, false)));
+        ins.Low = _skips.size();
+        _skips.push_back(Skipped(first));
+        ins.High = _skips.size();
+      }
+      break;
+    }
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      ins.First = _Emit(repeat->GetOperand(), emitted);
+      ins.Low = repeat->MinIterations();
+      ins.High = repeat->MaxIterations();
+      ins.Data = repeat;
+      break;
+    }
+    case Core::VT_EXTRACT: {
+      const Manipulators::ExtractValidator* extract =
+            static_cast<const Manipulators::ExtractValidator*>(validator);
+      ins.First = _Emit(extract->GetOperand(), emitted);
+      ins.Data = extract->Key();
+      break;
+    }
+    case Core::VT_CALLBACK:
+      ins.First = _Emit(static_cast<const Core::UnaryValidator*>(validator)
+                    ->GetOperand(), emitted);
+      ins.Data = validator;
+      break;
+    case Core::VT_REF: {
+      Core::StringValidator* target =
+            static_cast<const Manipulators::RefValidator*>(validator)
+              ->Target();
+      if (target) {
+        ins.First = _Emit(target, emitted);
+      } else {
+        // not injected yet.. it will be resolved while parsing
+        ins.Op = Core::VT_CUSTOM;
+        ins.Data = validator;
+      }
+      break;
+    }
+    case Core::VT_CASE:
+      ins.Low = static_cast<const StateKeepers::CaseModifier*>(validator)
+                  ->Value();
+      break;
+    case Core::VT_SETVAR: {
+      const StateKeepers::SetFlagModifier* set =
+            static_cast<const StateKeepers::SetFlagModifier*>(validator);
+      ins.Data = set->Flag();
+      ins.Extra = set->Value();
+      break;
+    }
+    case Core::VT_DELVAR:
+      ins.Data = static_cast<const StateKeepers::DelFlagModifier*>(validator)
+                    ->Flag();
+      break;
+    case Core::VT_IF: {
+      const StateKeepers::IfValidator* cond =
+            static_cast<const StateKeepers::IfValidator*>(validator);
+      ins.Data = cond->Flag();
+      ins.Extra = cond->Value();
+      break;
+    }
+    case Core::VT_IFMATCHED: {
+      const StateKeepers::IfMatchedValidator* cond =
+            static_cast<const StateKeepers::IfMatchedValidator*>(validator);
+      ins.Data = cond->Key();
+      ins.Low = cond->Min();
+      ins.High = cond->Max();
+      break;
+    }
+    case Core::VT_CLASS:
+      // the tree the class is fused from is run in place of the class
+      // when it skips spaces or records unnamed matches
+      ins.First = _Emit(static_cast<const Primitives::CharClassValidator*>(
+                    validator)->Tree(), emitted);
+      ins.Data = validator;
+      break;
+    case Core::VT_ANY:
+    case Core::VT_BOT:
+    case Core::VT_INCHAIN:
+    case Core::VT_COMMIT:
+      break;
+    default:
+      ins.Op = Core::VT_CUSTOM;
+      ins.Data = validator;
+      break;
+  }
+
+  // the choices and the references that read or write variables or
+  // matches are never memoized, their outcome is not keyed by the position
+  if (ins.Op == Core::VT_OR
+      || ins.Op == Core::VT_GREEDYOR
+      || ins.Op == Core::VT_REF
+      || ins.Op == Core::VT_MEMO)
+    ins.High = Analysis::Stateful(validator);
+
+  _code[pc] = ins;
+  return pc;
+}
+
+bool ProgramValidator::Check(Core::ContextInterface* context) const {
+  return Core::Direct(this, context);
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::Match(__CONTEXT* context) const {
+  if (context->Flags().IsFlagSet(SPEG_ITERATIVE))
+    return _Iterate(_entry, context);
+  return _Call(_entry, context);
+}
+
+template<typename __CONTEXT>
+inline const unsigned int* ProgramValidator::_SeqOperands(
+        const Instruction& ins, __CONTEXT* context, unsigned int* count) const {
+  // the fused phrases would skip no spaces and add one unnamed match 
+  // between their parts
+  Utils::Flags& flags = context->Flags();
+  if (ins.High && !flags.IsFlagSet(SPEG_IGNORESPACES)
+      && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    *count = static_cast<unsigned int>(ins.High);
+    return &_operands[ins.Low];
+  }
+  *count = ins.Second;
+  return &_operands[ins.First];
+}
+
+// the instruction is executed once per position and flags, its outcome
+// is recalled afterwards
+template<typename __CONTEXT>
+bool ProgramValidator::_Memoized(unsigned int pc, __CONTEXT* context)
+        const {
+  // the instruction address is the memo key
+  const Instruction& ins = _code[pc];
+  bool result;
+  if (context->Recall(&ins, &result))
+    return result;
+
+  Core::Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = _Exec(pc, context);
+  context->Memorize(&ins, start, flags, mark, result);
+  return result;
+}
+
+template<typename __CONTEXT>
+inline bool ProgramValidator::_Seek(const Instruction& ins
+        , __CONTEXT* context) const {
+  if (!static_cast<const Manipulators::UntilValidator*>(ins.Data)
+        ->Seek(context))
+    return false;
+  // the primitives skip the spaces before the characters they check
+  if (ins.Low && !context->Flags().IsFlagSet(SPEG_IGNORESPACES))
+    context->Span(_skips[(context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE)
+          ? ins.High : ins.Low) - 1], static_cast<size_t>(-1));
+  return true;
+}
+
+// the hot composites have functions of their own, _Call calls them 
+// rather than _Exec so the recursion keeps a small stack frame
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Seq(const Instruction& ins, __CONTEXT* context)
+        const {
+  Core::Position start = context->GetPosition();
+  unsigned int count;
+  const unsigned int* operands = _SeqOperands(ins, context, &count);
+  bool success = _Call(operands[0], context);
+  for (unsigned int i = 1; success && i < count; i++) {
+    context->AdjustPosition();
+    success = _Call(operands[i], context);
+  }
+  if (success) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Or(const Instruction& ins, __CONTEXT* context)
+        const {
+  Core::Position start = context->GetPosition();
+  const unsigned int* operands = &_operands[ins.First];
+  unsigned int candidates =
+        static_cast<const Analysis::Dispatch*>(ins.Extra)
+          ->Candidates(context);
+  for (unsigned int i = 0; i < ins.Second; i++) {
+    if (!Analysis::Dispatch::Tries(candidates, i))
+      continue;
+    unsigned int state = ins.Low ? context->BeginCut() : 0;
+    bool success = _Call(operands[i], context);
+    bool cut = ins.Low && context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      break;
+  }
+  return false;
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Repeat(const Instruction& ins, __CONTEXT* context)
+        const {
+  Core::Position start = context->GetPosition();
+  const Manipulators::RepeatValidator* repeat =
+        static_cast<const Manipulators::RepeatValidator*>(ins.Data);
+  if (repeat->Spans(context))
+    return repeat->Match(context);
+
+  unsigned int maxIter = static_cast<unsigned int>(ins.High);
+  unsigned int minIter = static_cast<unsigned int>(ins.Low);
+  for (unsigned int counter = 0; counter < maxIter; counter++) {
+    Core::Position before = context->GetPosition();
+    if (!_Call(ins.First, context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= minIter)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Ref(const Instruction& ins, __CONTEXT* context)
+        const {
+  Core::Position start = context->GetPosition();
+  if (_Call(ins.First, context)) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+// the characters and the ASCII phrases are matched in place, the choices
+// and the references look up the memo table in SPEG_MEMOIZE mode only
+// and the other instructions are executed by _Exec
+template<typename __CONTEXT>
+inline bool ProgramValidator::_Call(unsigned int pc, __CONTEXT* context)
+        const {
+  const Instruction& ins = _code[pc];
+  switch (ins.Op) {
+    case Core::VT_IS:
+      return Primitives::MatchChar(context, ins.Low, ins.High);
+    case Core::VT_BETWEEN:
+      return Primitives::MatchRange(context, ins.Low, ins.High
+            , _pool[ins.First], _pool[ins.First + 1]);
+    case Core::VT_EXACT: {
+      if (!ins.Low)
+        return _Exec(pc, context);
+      // the spaces are skipped before the match begins
+      context->AdjustPosition();
+      Core::Position start = context->GetPosition();
+      if (context->Skip(_text.data() + ins.High, ins.Second)) {
+        context->AddMatch(start);
+        return true;
+      }
+      return false;
+    }
+    case Core::VT_CLASS: {
+      Utils::Flags& flags = context->Flags();
+      if (flags.IsFlagSet(SPEG_IGNORESPACES)
+          || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+        return _Exec(pc, context);
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(ins.Data);
+      const Utils::CharClass& set = flags.IsFlagSet(SPEG_CASEINSENSITIVE)
+            ? fused->Folded() : fused->Sensitive();
+      return set.Contains(context->Get()) && context->Forward();
+    }
+    case Core::VT_SEQ:
+      return _Seq(ins, context);
+    case Core::VT_REPEAT:
+      return _Repeat(ins, context);
+    case Core::VT_OR:
+      if (ins.High || !context->Flags().IsFlagSet(SPEG_MEMOIZE))
+        return _Or(ins, context);
+      return _Memoized(pc, context);
+    case Core::VT_REF:
+      if (ins.High || !context->Flags().IsFlagSet(SPEG_MEMOIZE))
+        return _Ref(ins, context);
+      return _Memoized(pc, context);
+    case Core::VT_GREEDYOR:
+      if (ins.High || !context->Flags().IsFlagSet(SPEG_MEMOIZE))
+        return _Exec(pc, context);
+      return _Memoized(pc, context);
+    case Core::VT_MEMO:
+      if (ins.High)
+        return _Exec(pc, context);
+      return _Memoized(pc, context);
+    default:
+      return _Exec(pc, context);
+  }
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Exec(unsigned int pc, __CONTEXT* context) const {
+  const Instruction& ins = _code[pc];
+  Core::Position start = context->GetPosition();
+  switch (ins.Op) {
+    case Core::VT_IN: {
+      const SChar* set = ins.Second ? &_pool[0] + ins.First : NULL;
+      return Primitives::MatchSet(context, set, set + ins.Second
+            , ins.Second);
+    }
+
+    case Core::VT_EXACT: {
+      const SChar* phrase = ins.Second ? &_pool[0] + ins.First : NULL;
+      return Primitives::MatchPhrase(context, phrase, phrase + ins.Second
+            , ins.Second);
+    }
+
+    case Core::VT_ANY:
+      return Primitives::MatchAny(context);
+
+    case Core::VT_BOT:
+      return context->BOT();
+
+    case Core::VT_COMMIT:
+      context->Commit();
+      return true;
+
+    case Core::VT_INCHAIN:
+      return Primitives::MatchInChain(context);
+
+    case Core::VT_CASE:
+      context->Flags().SetFlag(SPEG_CASEINSENSITIVE, ins.Low != 0);
+      return true;
+
+    case Core::VT_SETVAR:
+      context->SetVar(static_cast<const char*>(ins.Data)
+                , static_cast<const char*>(ins.Extra));
+      return true;
+
+    case Core::VT_DELVAR:
+      context->DelVar(static_cast<const char*>(ins.Data));
+      return true;
+
+    case Core::VT_IF: {
+      const char* val = NULL;
+      return context->GetVar(static_cast<const char*>(ins.Data), &val)
+            && strcmp(static_cast<const char*>(ins.Extra), val) == 0;
+    }
+
+    case Core::VT_IFMATCHED: {
+      unsigned int num = context->NumberOfMatches(
+                  static_cast<const char*>(ins.Data));
+      return (num >= ins.Low && num <= ins.High);
+    }
+
+    case Core::VT_CUSTOM:
+      return static_cast<const Core::StringValidator*>(ins.Data)
+                ->Check(context);
+
+    case Core::VT_OR:
+      return _Or(ins, context);
+
+    case Core::VT_AND:
+      if (_Call(ins.First, context)) {
+        Core::Position frst = context->GetPosition();
+        context->SetPosition(start);
+        if (_Call(ins.Second, context)) {
+          if (frst > context->GetPosition())
+            context->SetPosition(frst);
+          context->AddMatch(start);
+          return true;
+        }
+      }
+      return false;
+
+    case Core::VT_GREEDYOR: {
+      const unsigned int* operands = &_operands[ins.First];
+      unsigned int candidates =
+            static_cast<const Analysis::Dispatch*>(ins.Extra)
+              ->Candidates(context);
+      bool success = false;
+      Core::Position longest = start;
+      for (unsigned int i = 0; i < ins.Second; i++) {
+        context->SetPosition(start);
+        if (!Analysis::Dispatch::Tries(candidates, i))
+          continue;
+        unsigned int state = ins.Low ? context->BeginCut() : 0;
+        if (_Call(operands[i], context))
+          success = true;
+        longest = MAXIMUM(longest, context->GetPosition());
+        if (ins.Low && context->EndCut(state))
+          break;
+      }
+      if (success) {
+        context->SetPosition(longest);
+        context->AddMatch(start);
+        return true;
+      }
+      return false;
+    }
+
+    case Core::VT_NOT:
+      if (_Call(ins.First, context)) {
+        context->SetPosition(start);
+        return false;
+      }
+      return true;
+
+    case Core::VT_LOOKAHEAD: {
+      bool ret = _Call(ins.First, context);
+      context->SetPosition(start);
+      return ret;
+    }
+
+    case Core::VT_LOOKBACK:
+      while (context->Backward()) {
+        Core::Position newStart = context->GetPosition();
+        if (_Call(ins.First, context) && context->GetPosition() == start)
+          return true;
+        context->SetPosition(newStart);
+      }
+      context->SetPosition(start);
+      return false;
+
+    case Core::VT_UNTIL:
+      do {
+        if (!_Seek(ins, context))
+          break;
+        Core::Position before = context->GetPosition();
+        if (_Call(ins.First, context)) {
+          context->SetPosition(before);
+          context->AddMatch(start);
+          return true;
+        }
+      } while (context->Forward());
+      context->SetPosition(start);
+      return false;
+
+    case Core::VT_EXTRACT:
+      if (_Call(ins.First, context)) {
+        context->AddMatch(static_cast<const char*>(ins.Data), start);
+        return true;
+      }
+      return false;
+
+    case Core::VT_CALLBACK:
+      if (_Call(ins.First, context)) {
+        const Manipulators::CallBackValidator* callback =
+          static_cast<const Manipulators::CallBackValidator*>(ins.Data);
+        callback->Function()(start, context->GetPosition()
+                , callback->CallBackContext());
+        return true;
+      }
+      return false;
+
+    case Core::VT_REF:
+      return _Ref(ins, context);
+
+    case Core::VT_MEMO:
+    case Core::VT_CLASS:
+      return _Call(ins.First, context);
+
+    default:
+      return false;
+  }
+}
+
+// returned by _Resume once the instruction is done
+static const unsigned int FRAME_DONE = ~0U;
+
+// how _Iterate enters an instruction
+enum Entry {
+  ENTRY_LEAF,     // no operands, it is executed by _Call as it is
+  ENTRY_FIRST,    // it calls its first operand right away
+  ENTRY_RESUME    // it decides what to do in _Resume
+};
+
+static Entry EntryOf(Core::ValidatorType op) {
+  switch (op) {
+    case Core::VT_SEQ:
+    case Core::VT_AND:
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_REF:
+    case Core::VT_MEMO:
+      return ENTRY_FIRST;
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+      return ENTRY_RESUME;
+    default:
+      return ENTRY_LEAF;
+  }
+}
+
+// a stack that is kept in place till it is deeper than __N, so shallow
+// parsing does not allocate
+template <typename __T, size_t __N>
+class ShortStack {
+  __T _local[__N];
+  vector<__T> _spilled;
+  size_t _size;
+
+ public:
+  ShortStack() : _size(0) {}
+
+  inline bool empty() const {
+    return !_size;
+  }
+
+  inline __T& back() {
+    return _size <= __N ? _local[_size - 1] : _spilled.back();
+  }
+
+  inline __T& push_back() {
+    if (_size++ < __N)
+      return _local[_size - 1];
+    _spilled.push_back(__T());
+    return _spilled.back();
+  }
+
+  inline void pop_back() {
+    if (_size > __N)
+      _spilled.pop_back();
+    _size--;
+  }
+};
+
+template<typename __CONTEXT>
+inline unsigned int ProgramValidator::_Resume(Frame* frame, bool* result
+        , __CONTEXT* context) const {
+  const Instruction& ins = _code[frame->Pc];
+  Core::Position start = frame->Start;
+  unsigned int phase = frame->Phase;
+  frame->Phase = MINIMUM(phase + 1, 2U);
+
+  switch (ins.Op) {
+    case Core::VT_SEQ: {
+      // Count is the index of the next operand
+      unsigned int count;
+      const unsigned int* operands = _SeqOperands(ins, context, &count);
+      if (phase <= 1)
+        frame->Count = 1;
+      if (phase == 0)
+        return operands[0];
+      if (*result && frame->Count < count) {
+        context->AdjustPosition();
+        return operands[frame->Count++];
+      }
+      if (*result)
+        context->AddMatch(start);
+      else
+        context->SetPosition(start);
+      return FRAME_DONE;
+    }
+
+    case Core::VT_AND:
+      if (phase == 0)
+        return ins.First;
+      if (phase == 1 && *result) {
+        frame->Saved = context->GetPosition();
+        context->SetPosition(start);
+        return ins.Second;
+      }
+      if (*result) {
+        if (frame->Saved > context->GetPosition())
+          context->SetPosition(frame->Saved);
+        context->AddMatch(start);
+      }
+      return FRAME_DONE;
+
+    case Core::VT_OR:
+      // Count is the index of the next alternative
+      if (phase == 0) {
+        frame->Candidates = static_cast<const Analysis::Dispatch*>(ins.Extra)
+              ->Candidates(context);
+        frame->Count = 0;
+        *result = false;
+      } else if (ins.Low && context->EndCut(frame->Cut) && !*result) {
+        frame->Count = ins.Second;
+      }
+      while (!*result && frame->Count < ins.Second) {
+        size_t index = static_cast<size_t>(frame->Count++);
+        if (Analysis::Dispatch::Tries(frame->Candidates, index)) {
+          if (ins.Low)
+            frame->Cut = context->BeginCut();
+          return _operands[ins.First + index];
+        }
+      }
+      if (*result)
+        context->AddMatch(start);
+      return FRAME_DONE;
+
+    case Core::VT_GREEDYOR:
+      // Saved is the longest end reached so far
+      if (phase == 0) {
+        frame->Candidates = static_cast<const Analysis::Dispatch*>(ins.Extra)
+              ->Candidates(context);
+        frame->Count = 0;
+        frame->Matched = false;
+        frame->Saved = start;
+      } else {
+        frame->Matched = frame->Matched || *result;
+        frame->Saved = MAXIMUM(frame->Saved, context->GetPosition());
+        if (ins.Low && context->EndCut(frame->Cut))
+          frame->Count = ins.Second;
+      }
+      while (frame->Count < ins.Second) {
+        size_t index = static_cast<size_t>(frame->Count++);
+        if (Analysis::Dispatch::Tries(frame->Candidates, index)) {
+          context->SetPosition(start);
+          if (ins.Low)
+            frame->Cut = context->BeginCut();
+          return _operands[ins.First + index];
+        }
+      }
+      *result = frame->Matched;
+      if (*result) {
+        context->SetPosition(frame->Saved);
+        context->AddMatch(start);
+      }
+      return FRAME_DONE;
+
+    case Core::VT_NOT:
+      if (phase == 0)
+        return ins.First;
+      if (*result)
+        context->SetPosition(start);
+      *result = !*result;
+      return FRAME_DONE;
+
+    case Core::VT_LOOKAHEAD:
+      if (phase == 0)
+        return ins.First;
+      context->SetPosition(start);
+      return FRAME_DONE;
+
+    case Core::VT_LOOKBACK:
+      if (phase > 0) {
+        if (*result && context->GetPosition() == start)
+          return FRAME_DONE;
+        context->SetPosition(frame->Saved);
+      }
+      if (context->Backward()) {
+        frame->Saved = context->GetPosition();
+        return ins.First;
+      }
+      context->SetPosition(start);
+      *result = false;
+      return FRAME_DONE;
+
+    case Core::VT_UNTIL:
+      if (phase > 0) {
+        if (*result) {
+          context->SetPosition(frame->Saved);
+          context->AddMatch(start);
+          return FRAME_DONE;
+        }
+        if (!context->Forward()) {
+          context->SetPosition(start);
+          return FRAME_DONE;
+        }
+      }
+      if (!_Seek(ins, context)) {
+        context->SetPosition(start);
+        *result = false;
+        return FRAME_DONE;
+      }
+      frame->Saved = context->GetPosition();
+      return ins.First;
+
+    case Core::VT_REPEAT: {
+      if (phase == 0) {
+        const Manipulators::RepeatValidator* repeat =
+              static_cast<const Manipulators::RepeatValidator*>(ins.Data);
+        if (repeat->Spans(context)) {
+          *result = repeat->Match(context);
+          return FRAME_DONE;
+        }
+        frame->Count = 0;
+      } else if (!*result || (context->GetPosition() == frame->Saved
+            && !context->Step())) {
+        if (frame->Count < ins.Low) {
+          context->SetPosition(start);
+          *result = false;
+          return FRAME_DONE;
+        }
+        frame->Count = static_cast<unsigned long>(ins.High);
+      } else {
+        frame->Count++;
+      }
+
+      if (frame->Count < ins.High) {
+        frame->Saved = context->GetPosition();
+        return ins.First;
+      }
+      context->AddMatch(start);
+      *result = true;
+      return FRAME_DONE;
+    }
+
+    case Core::VT_EXTRACT:
+      if (phase == 0)
+        return ins.First;
+      if (*result)
+        context->AddMatch(static_cast<const char*>(ins.Data), start);
+      return FRAME_DONE;
+
+    case Core::VT_CALLBACK:
+      if (phase == 0)
+        return ins.First;
+      if (*result) {
+        const Manipulators::CallBackValidator* callback =
+          static_cast<const Manipulators::CallBackValidator*>(ins.Data);
+        callback->Function()(start, context->GetPosition()
+                , callback->CallBackContext());
+      }
+      return FRAME_DONE;
+
+    case Core::VT_REF:
+      if (phase == 0)
+        return ins.First;
+      if (*result)
+        context->AddMatch(start);
+      return FRAME_DONE;
+
+    default:  // VT_MEMO
+      if (phase == 0)
+        return ins.First;
+      return FRAME_DONE;
+  }
+}
+
+template<typename __CONTEXT>
+bool ProgramValidator::_Iterate(unsigned int pc, __CONTEXT* context) const {
+  ShortStack<Frame, 32> stack;
+  bool result = false;
+
+  while (true) {
+    // enter the instruction and the first operands called right away,
+    // the cursor does not move till a leaf is executed
+    Core::Position here = context->GetPosition();
+    while (true) {
+      const Instruction& ins = _code[pc];
+      Entry entry = EntryOf(ins.Op);
+      if (entry == ENTRY_LEAF) {
+        result = _Call(pc, context);
+        break;
+      }
+
+      bool memoize = (ins.Op == Core::VT_MEMO);
+      if (ins.Op == Core::VT_OR
+          || ins.Op == Core::VT_GREEDYOR
+          || ins.Op == Core::VT_REF)
+        memoize = context->Flags().IsFlagSet(SPEG_MEMOIZE);
+      memoize = memoize && !ins.High;
+      if (memoize && context->Recall(&ins, &result))
+        break;
+
+      // the other fields are set by the instruction before use
+      Frame& frame = stack.push_back();
+      frame.Pc = pc;
+      frame.Phase = 0;
+      frame.Start = here;
+      frame.Memo = memoize;
+      if (memoize) {
+        frame.Flags = context->Flags()._flags;
+        frame.Mark = context->BeginMemo();
+      }
+      if (entry == ENTRY_RESUME)
+        break;
+      frame.Phase = 1;
+      unsigned int count;
+      pc = (ins.Op == Core::VT_SEQ) ? _SeqOperands(ins, context, &count)[0]
+            : ins.First;
+    }
+
+    // resume the waiting instructions till one calls an operand
+    pc = FRAME_DONE;
+    while (!stack.empty()) {
+      Frame& frame = stack.back();
+      pc = _Resume(&frame, &result, context);
+      if (pc != FRAME_DONE)
+        break;
+      if (frame.Memo)
+        context->Memorize(&_code[frame.Pc], frame.Start, frame.Flags
+              , frame.Mark, result);
+      stack.pop_back();
+    }
+    if (pc == FRAME_DONE)
+      return result;
+  }
+}
+
+/**
+ * @brief the state of Generate(), nodes are numbered in the order they 
+ * are reached so that shared subtrees are written once
+ * 
+ */
+struct Generator {
+  map<const Core::StringValidator*, unsigned int> Numbers;
+  vector<const Core::StringValidator*> Nodes;
+  string Code;
+};
+
+// compiled programs and automata are written as the tree they are built
+// from
+static const Core::StringValidator* Source(
+        const Core::StringValidator* validator) {
+  while (validator) {
+    if (validator->Type() == Core::VT_PROGRAM)
+      validator = static_cast<const ProgramValidator*>(validator)->Root();
+    else if (validator->Type() == Core::VT_AUTOMATON)
+      validator = static_cast<const AutomatonValidator*>(validator)->Root();
+    else
+      break;
+  }
+  return validator;
+}
+
+static bool Number(const Core::StringValidator* validator
+        , Generator* generator) {
+  validator = Source(validator);
+  if (!validator)
+    return false;
+  if (generator->Numbers.count(validator))
+    return true;
+  generator->Numbers[validator] =
+        static_cast<unsigned int>(generator->Nodes.size());
+  generator->Nodes.push_back(validator);
+
+  switch (validator->Type()) {
+    case Core::VT_IS:
+    case Core::VT_IN:
+    case Core::VT_BETWEEN:
+    case Core::VT_EXACT:
+    case Core::VT_ANY:
+    case Core::VT_BOT:
+    case Core::VT_INCHAIN:
+    case Core::VT_COMMIT:
+    case Core::VT_TRIE:
+    case Core::VT_PROPERTY:
+    case Core::VT_CASE:
+    case Core::VT_SETVAR:
+    case Core::VT_DELVAR:
+    case Core::VT_IF:
+    case Core::VT_IFMATCHED:
+      return true;
+    case Core::VT_CLASS:
+      return Number(static_cast<const Primitives::CharClassValidator*>(
+            validator)->Tree(), generator);
+    case Core::VT_REF:
+      return Number(static_cast<const Manipulators::RefValidator*>(
+            validator)->Target(), generator);
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+    case Core::VT_EXTRACT:
+    case Core::VT_MEMO:
+      return Number(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand(), generator);
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      return Number(binary->GetFirstOperand(), generator)
+            && Number(binary->GetSecondOperand(), generator);
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < nary->Count(); i++) {
+        if (!Number(nary->GetOperand(i), generator))
+          return false;
+      }
+      return true;
+    }
+    default:
+      // callbacks and custom validators are pointers to the running
+      // program, they have no source form
+      return false;
+  }
+}
+
+static string Call(const Core::StringValidator* validator
+        , const Generator& generator) {
+  char text[32];
+  sprintf(text, "Node%u", generator.Numbers.find(Source(validator))->second);
+  return text;
+}
+
+static string Unsigned(unsigned long value) {
+  char text[32];
+  sprintf(text, "%luUL", value);
+  return text;
+}
+
+static string Character(SChar chr) {
+  char text[32];
+  if (chr >= ' ' && chr < 127 && chr != '\'' && chr != '\\')
+    sprintf(text, "'%c'", static_cast<char>(chr));
+  else
+    sprintf(text, "0x%lXUL", static_cast<unsigned long>(chr));
+  return text;
+}
+
+// the character as Get() returns it, the lower case one is picked once
+// the case insensitive mode is read by Folds()
+static string Folded(SChar chr) {
+  SChar folded = Utils::CharToLower(chr);
+  if (folded == chr)
+    return Character(chr);
+  return "(fold ? " + Character(folded) + " : " + Character(chr) + ")";
+}
+
+// reads the case insensitive mode if any of the characters has a case
+static string Folds(const vector<SChar>& chars) {
+  for (size_t i = 0; i < chars.size(); i++) {
+    if (Utils::CharToLower(chars[i]) != chars[i])
+      return "  bool fold = context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);"
+            "\n";
+  }
+  return "";
+}
+
+
+// a string literal, octal escapes are used since hexadecimal ones do not
+// end before the following hexadecimal digits
+static string Quote(const char* str) {
+  string text = "\"";
+  for (; *str; str++) {
+    unsigned char chr = static_cast<unsigned char>(*str);
+    if (chr >= ' ' && chr < 127 && chr != '"' && chr != '\\' && chr != '?') {
+      text += static_cast<char>(chr);
+    } else {
+      char escape[8];
+      sprintf(escape, "\\%03o", chr);
+      text += escape;
+    }
+  }
+  return text + "\"";
+}
+
+// the sorted disjoint ranges of the class
+static vector<Utils::CharClass::RANGE> Runs(const Utils::CharClass& set) {
+  vector<Utils::CharClass::RANGE> runs;
+  for (SChar chr = 0; chr < 256; chr++) {
+    if (!set.Contains(chr))
+      continue;
+    if (!runs.empty() && runs.back().second + 1 == chr)
+      runs.back().second = chr;
+    else
+      runs.push_back(make_pair(chr, chr));
+  }
+  for (size_t i = 0; i < set.Ranges.size(); i++) {
+    if (!runs.empty() && runs.back().second + 1 == set.Ranges[i].first)
+      runs.back().second = set.Ranges[i].second;
+    else
+      runs.push_back(set.Ranges[i]);
+  }
+  return runs;
+}
+
+static string InRuns(const vector<Utils::CharClass::RANGE>& runs
+        , size_t from) {
+  string test;
+  for (size_t i = from; i < runs.size(); i++) {
+    if (!test.empty())
+      test += " || ";
+    if (runs[i].first == runs[i].second) {
+      test += "chr == " + Character(runs[i].first);
+    } else if (!runs[i].first) {
+      test += "chr <= " + Character(runs[i].second);
+    } else if (runs[i].second == static_cast<SChar>(-1)) {
+      test += "chr >= " + Character(runs[i].first);
+    } else {
+      test += "(chr >= " + Character(runs[i].first) + " && chr <= "
+            + Character(runs[i].second) + ")";
+    }
+  }
+  return test.empty() ? "false" : test;
+}
+
+// the test of chr against the class, a few ranges are compared inline 
+// and the others are looked up in a bitmap declared as @p table
+static string Contains(const Utils::CharClass& set, const char* table
+        , string* declarations) {
+  vector<Utils::CharClass::RANGE> runs = Runs(set);
+  if (runs.size() <= 4)
+    return InRuns(runs, 0);
+
+  char line[64];
+  string bitmap;
+  for (size_t i = 0; i < sizeof(set.Bits); i++) {
+    sprintf(line, "%s0x%02X", (i % 8) ? ", " : (i ? ",\n        " : "")
+          , set.Bits[i]);
+    bitmap += line;
+  }
+  *declarations += string("  static const unsigned char ") + table
+        + "[32] = {\n        " + bitmap + " };\n";
+
+  size_t beyond = 0;
+  while (beyond < runs.size() && runs[beyond].second < 256)
+    beyond++;
+  vector<Utils::CharClass::RANGE> high(runs.begin() + beyond, runs.end());
+  if (!high.empty() && high[0].first < 256)
+    high[0].first = 256;
+  return string("(chr < 256 ? ((") + table + "[chr >> 3] >> (chr & 7)) & 1)"
+        + " != 0 : (" + InRuns(high, 0) + "))";
+}
+
+// statements building the named Utils::CharClass once
+static string Class(const Utils::CharClass& set, const char* name) {
+  vector<Utils::CharClass::RANGE> runs = Runs(set);
+  string code = string("  static const SPEG::SChar ") + name + "Ranges[][2] = {";
+  for (size_t i = 0; i < runs.size(); i++) {
+    code += (i ? ", {" : " {") + Character(runs[i].first) + ", "
+          + Character(runs[i].second) + "}";
+  }
+  if (runs.empty())
+    code += " {1, 0}";
+  char count[32];
+  sprintf(count, "%lu", static_cast<unsigned long>(runs.size()));
+  return code + " };\n  static const SPEG::Utils::CharClass " + name
+        + " = Class(" + name + "Ranges, " + count + ");\n";
+}
+
+static string Literal(const vector<SChar>& chars, const char* name) {
+  string code = string("  static const SPEG::SChar ") + name + "Chars[] = {";
+  for (size_t i = 0; i < chars.size(); i++)
+    code += (i ? ", " : " ") + Character(chars[i]);
+  char count[32];
+  sprintf(count, "%lu", static_cast<unsigned long>(chars.size()));
+  return code + " };\n  static const SPEG::Utils::Literal " + name
+        + "(std::vector<SPEG::SChar>(" + name + "Chars, " + name + "Chars + "
+        + count + "));\n";
+}
+
+// the state machine walking one of the tries, as TrieValidator::Check
+static string Walk(const vector<Primitives::TrieValidator::Node>& trie
+        , const char* label, unsigned int none) {
+  string code;
+  char line[128];
+  for (unsigned int n = 0; n < trie.size(); n++) {
+    sprintf(line, "%s%u:\n", label, n);
+    code += line;
+    if (n) {
+      code += "  if (!context->Forward())\n    goto done;\n";
+      if (trie[n].Phrase != none) {
+        sprintf(line, "  if (best > %u) {\n    best = %u;\n"
+              "    end = context->GetPosition();\n  }\n"
+              , trie[n].Phrase, trie[n].Phrase);
+        code += line;
+      }
+    }
+    // no phrase below can precede the best one
+    if (trie[n].Below == none || trie[n].Edges.empty()) {
+      code += "  goto done;\n";
+      continue;
+    }
+    sprintf(line, "  if (best <= %u)\n    goto done;\n", trie[n].Below);
+    code += line;
+    code += "  switch (context->Get()) {\n";
+    for (size_t e = 0; e < trie[n].Edges.size(); e++) {
+      sprintf(line, "%s%u;\n", label, trie[n].Edges[e].second);
+      code += "    case " + Character(trie[n].Edges[e].first) + ": goto "
+            + line;
+    }
+    code += "    default: goto done;\n  }\n";
+  }
+  return code;
+}
+
+// the choice alternatives that can match the current character, as
+// Analysis::Dispatch
+static string Candidates(const Core::NaryValidator* choice
+        , string* declarations) {
+  unsigned int table[256];
+  unsigned int beyond = SPEG_CHOICE_ALL;
+  bool active = false;
+  for (SChar c = 0; c < 256; c++)
+    table[c] = SPEG_CHOICE_ALL;
+  size_t count = MINIMUM(choice->Count()
+        , static_cast<size_t>(SPEG_CHOICE_BITS));
+  for (size_t i = 0; i < count; i++) {
+    Analysis::FirstSet set = Analysis::First(choice->GetOperand(i));
+    if (!set.Pure || set.Nullable)
+      continue;
+    active = true;
+    for (SChar c = 0; c < 256; c++) {
+      if (!set.Contains(c))
+        table[c] &= ~(1U << i);
+    }
+    if (!set.Beyond)
+      beyond &= ~(1U << i);
+  }
+  if (!active)
+    return "  unsigned int candidates = SPEG_CHOICE_ALL;\n";
+
+  // only the bits of the alternatives are written
+  unsigned int used = (count < SPEG_CHOICE_BITS) ? (1U << count) - 1
+        : SPEG_CHOICE_ALL;
+  beyond &= used;
+  char line[64];
+  string text;
+  for (SChar c = 0; c < 256; c++) {
+    sprintf(line, "%s0x%XU", (c % 8) ? ", " : (c ? ",\n        " : "")
+          , table[c] & used);
+    text += line;
+  }
+  *declarations += "  static const unsigned int table[256] = {\n        "
+        + text + " };\n";
+  sprintf(line, "    candidates = chr < 256 ? table[chr] : 0x%XU;\n", beyond);
+  return string("  unsigned int candidates = SPEG_CHOICE_ALL;\n"
+        "  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {\n"
+        "    SPEG::SChar chr = context->Get();\n") + line + "  }\n";
+}
+
+// the test of the alternative index of a choice in the candidates, as 
+// Analysis::Dispatch::Tries, empty if it is always tried
+static string Mask(size_t index) {
+  if (index >= SPEG_CHOICE_BITS)
+    return string();
+  char mask[32];
+  sprintf(mask, "(candidates & 0x%XU)", 1U << index);
+  return mask;
+}
+
+// the condition trying the alternative index of a choice
+static string Tries(size_t index, const string& call) {
+  string mask = Mask(index);
+  return (mask.empty() ? mask : mask + " && ") + call + "(context)";
+}
+
+// the block trying the alternative index of a choice in a cut scope, 
+// the outcome is left in success and cut
+static string TriesInScope(size_t index, const string& call) {
+  string mask = Mask(index);
+  return "  " + (mask.empty() ? string("{") : "if " + mask + " {") + "\n"
+        "    unsigned int state = context->BeginCut();\n"
+        "    success = " + call + "(context);\n"
+        "    cut = context->EndCut(state);\n";
+}
+
+// the node body running Evaluate<number> through the memo table, always
+// or only under SPEG_MEMOIZE, never if the node reads or writes variables 
+// or matches
+static string Memoized(unsigned int number, bool always
+        , const Core::StringValidator* validator) {
+  char line[128];
+  string code;
+  if (Analysis::Stateful(validator)) {
+    sprintf(line, "  return Evaluate%u(context);\n", number);
+    return line;
+  }
+  if (!always) {
+    sprintf(line, "  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))\n"
+          "    return Evaluate%u(context);\n", number);
+    code = line;
+  }
+  sprintf(line, "  result = Evaluate%u(context);\n", number);
+  return code + "  static const char key = 0;\n"
+        "  bool result;\n"
+        "  if (context->Recall(&key, &result))\n"
+        "    return result;\n\n"
+        "  Position start = context->GetPosition();\n"
+        "  unsigned long flags = context->Flags()._flags;\n"
+        "  size_t mark = context->BeginMemo();\n" + string(line)
+        + "  context->Memorize(&key, start, flags, mark, result);\n"
+        "  return result;\n";
+}
+
+// the node body matching an ASCII phrase with one Skip(), the text is 
+// not decoded.. empty if the phrase has other characters
+static string Skips(const vector<SChar>& phrase) {
+  string text;
+  for (size_t i = 0; i < phrase.size(); i++) {
+    if (!phrase[i] || phrase[i] >= 0x80)
+      return "";
+    text += static_cast<char>(phrase[i]);
+  }
+  char size[32];
+  sprintf(size, "%lu", static_cast<unsigned long>(phrase.size()));
+  return "  context->AdjustPosition();\n"
+        "  Position start = context->GetPosition();\n"
+        "  if (!context->Skip(" + Quote(text.c_str()) + ", " + size + "))\n"
+        "    return false;\n"
+        "  context->AddMatch(start);\n"
+        "  return true;\n";
+}
+
+static string Header(const char* function, unsigned int number
+        , bool definition = true) {
+  char line[128];
+  sprintf(line, "template <typename __CONTEXT>\ninline bool %s%u("
+        "__CONTEXT* context)%s\n", function, number, definition ? " {" : ";");
+  return line;
+}
+
+static const char* Trailer = "}\n\n";
+
+static void Write(unsigned int number, Generator* generator) {
+  const Core::StringValidator* validator = generator->Nodes[number];
+  // set by the type of the node, below
+  const Core::UnaryValidator* unary = NULL;
+  const Core::BinaryValidator* binary = NULL;
+  const Core::NaryValidator* nary = NULL;
+  string operand;
+  string first;
+  string second;
+  vector<string> operands;
+  string declarations;
+  string body;
+  switch (validator->Type()) {
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+    case Core::VT_EXTRACT:
+    case Core::VT_MEMO:
+      unary = static_cast<const Core::UnaryValidator*>(validator);
+      operand = Call(unary->GetOperand(), *generator);
+      break;
+    case Core::VT_AND:
+      binary = static_cast<const Core::BinaryValidator*>(validator);
+      first = Call(binary->GetFirstOperand(), *generator);
+      second = Call(binary->GetSecondOperand(), *generator);
+      break;
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR:
+      nary = static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < nary->Count(); i++)
+        operands.push_back(Call(nary->GetOperand(i), *generator));
+      break;
+    default:
+      break;
+  }
+
+  string& code = generator->Code;
+  switch (validator->Type()) {
+    case Core::VT_IS: {
+      vector<SChar> chr(1, static_cast<const Primitives::CharValidator*>(
+            validator)->Character());
+      body = Skips(chr);
+      if (!body.empty())
+        break;
+      body = "  context->AdjustPosition();\n"
+            "  Position start = context->GetPosition();\n"
+            + Folds(chr)
+            + "  if (context->Get() != " + Folded(chr[0]) + ")\n"
+            "    return false;\n"
+            "  context->Forward();\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_IN: {
+      const vector<SChar>& set =
+            static_cast<const Primitives::CharSetValidator*>(validator)
+            ->Characters();
+      body = "  context->AdjustPosition();\n";
+      if (set.empty()) {
+        body += "  return false;\n";
+        break;
+      }
+      body += "  Position start = context->GetPosition();\n" + Folds(set)
+            + "  SPEG::SChar chr = context->Get();\n  if (";
+      for (size_t i = 0; i < set.size(); i++)
+        body += (i ? "\n      && chr != " : "chr != ") + Folded(set[i]);
+      body += ")\n    return false;\n"
+            "  context->Forward();\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_BETWEEN: {
+      const Primitives::CharRangeValidator* range =
+            static_cast<const Primitives::CharRangeValidator*>(validator);
+      vector<SChar> bounds;
+      bounds.push_back(range->Min());
+      bounds.push_back(range->Max());
+      body = "  context->AdjustPosition();\n"
+            "  Position start = context->GetPosition();\n"
+            + Folds(bounds)
+            + "  SPEG::SChar chr = context->Get();\n"
+            "  if (chr < " + Folded(bounds[0]) + "\n"
+            "      || chr > " + Folded(bounds[1]) + "\n"
+            "      || !context->Forward())\n"
+            "    return false;\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_EXACT: {
+      const vector<SChar>& phrase =
+            static_cast<const Primitives::PhraseValidator*>(validator)
+            ->Phrase();
+      body = Skips(phrase);
+      if (!body.empty())
+        break;
+      body = "  context->AdjustPosition();\n"
+            "  Position start = context->GetPosition();\n" + Folds(phrase);
+      for (size_t i = 0; i < phrase.size(); i++) {
+        body += "  if (context->Get() != " + Folded(phrase[i]) + ") {\n"
+              "    context->SetPosition(start);\n"
+              "    return false;\n"
+              "  }\n"
+              "  context->Forward();\n";
+      }
+      body += "  context->AddMatch(start);\n  return true;\n";
+      break;
+    }
+    case Core::VT_ANY:
+      body = "  Position start = context->GetPosition();\n"
+            "  if (!context->Forward())\n"
+            "    return false;\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    case Core::VT_BOT:
+      body = "  return context->BOT();\n";
+      break;
+    case Core::VT_COMMIT:
+      body = "  context->Commit();\n"
+            "  return true;\n";
+      break;
+    case Core::VT_INCHAIN:
+      body = "  Position start = context->GetPosition();\n"
+            "  SPEG::SChar curr = context->Get();\n"
+            "  if (context->Backward()) {\n"
+            "    SPEG::SChar prev = context->Get();\n"
+            "    context->Forward();\n"
+            "    if (prev == curr - 1 && context->Forward()) {\n"
+            "      context->AddMatch(start);\n"
+            "      return true;\n"
+            "    }\n"
+            "  }\n"
+            "  return false;\n";
+      break;
+    case Core::VT_TRIE: {
+      const Primitives::TrieValidator* trie =
+            static_cast<const Primitives::TrieValidator*>(validator);
+      unsigned int none =
+            static_cast<unsigned int>(trie->Phrases().size());
+      char line[128];
+      string depths;
+      for (size_t i = 0; i < trie->Depths().size(); i++) {
+        sprintf(line, "%s%u", i ? ", " : " ", trie->Depths()[i]);
+        depths += line;
+      }
+      sprintf(line, "  unsigned int best = %u;\n", trie->Trie(false)[0].Phrase);
+      body = "  static const unsigned int depths[] = {" + depths + " };\n"
+            "  Position entry = context->GetPosition();\n"
+            "  context->AdjustPosition();\n"
+            "  Position start = context->GetPosition();\n"
+            "  Position end = start;\n" + line +
+            "  // Get() returns the lower case character in case insensitive"
+            " mode\n"
+            "  if (context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE))\n"
+            "    goto folded0;\n"
+            "  goto sensitive0;\n\n"
+            + Walk(trie->Trie(false), "sensitive", none) + "\n"
+            + Walk(trie->Trie(true), "folded", none);
+      sprintf(line, "  if (best == %u) {\n", none);
+      body += string("\ndone:\n") + line +
+            "    context->SetPosition(start);\n"
+            "    return false;\n"
+            "  }\n"
+            "  context->SetPosition(end);\n"
+            "  context->AddMatch(start);\n"
+            "  for (unsigned int i = 0; i < depths[best]; i++)\n"
+            "    context->AddMatch(entry);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_CLASS: {
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(validator);
+      string sensitive = Contains(fused->Sensitive(), "sensitive"
+            , &declarations);
+      string folded = Contains(fused->Folded(), "folded", &declarations);
+      body = "  SPEG::Utils::Flags& flags = context->Flags();\n"
+            "  if (flags.IsFlagSet(SPEG_IGNORESPACES)"
+            " || flags.IsFlagSet(SPEG_MATCHUNNAMED))\n"
+            "    return " + Call(fused->Tree(), *generator) + "(context);\n\n"
+            "  // Get() returns the lower case character in case insensitive"
+            " mode\n"
+            "  SPEG::SChar chr = context->Get();\n"
+            "  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))\n"
+            "    return (" + folded + ") && context->Forward();\n"
+            "  return (" + sensitive + ") && context->Forward();\n";
+      break;
+    }
+    case Core::VT_PROPERTY: {
+      const Primitives::PropertyValidator* property =
+            static_cast<const Primitives::PropertyValidator*>(validator);
+      declarations = Class(property->Sensitive(), "sensitive")
+            + Class(property->Folded(), "folded");
+      body = "  context->AdjustPosition();\n"
+            "  Position start = context->GetPosition();\n"
+            "  // Get() returns the lower case character in case insensitive"
+            " mode\n"
+            "  const SPEG::Utils::CharClass& set =\n"
+            "        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE)"
+            " ? folded : sensitive;\n"
+            "  if (!set.Contains(context->Get()) || !context->Forward())\n"
+            "    return false;\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_SEQ:
+      body = "  Position start = context->GetPosition();\n"
+            "  if (" + operands[0] + "(context)";
+      for (size_t i = 1; i < operands.size(); i++)
+        body += "\n      && (context->AdjustPosition(), " + operands[i]
+              + "(context))";
+      body += ") {\n"
+            "    context->AddMatch(start);\n"
+            "    return true;\n"
+            "  }\n"
+            "  context->SetPosition(start);\n"
+            "  return false;\n";
+      break;
+    case Core::VT_AND:
+      body = "  Position start = context->GetPosition();\n"
+            "  if (" + first + "(context)) {\n"
+            "    Position frst = context->GetPosition();\n"
+            "    context->SetPosition(start);\n"
+            "    if (" + second + "(context)) {\n"
+            "      if (frst > context->GetPosition())\n"
+            "        context->SetPosition(frst);\n"
+            "      context->AddMatch(start);\n"
+            "      return true;\n"
+            "    }\n"
+            "  }\n"
+            "  return false;\n";
+      break;
+    case Core::VT_OR:
+      body = Candidates(nary, &declarations);
+      if (Analysis::Cuts(nary->GetOperands()
+            , Analysis::CUTS_INJECTED)) {
+        body += "  bool success;\n  bool cut;\n";
+        for (size_t i = 0; i < operands.size(); i++)
+          body += "\n" + TriesInScope(i, operands[i]) +
+                "    if (success) {\n"
+                "      context->AddMatch(start);\n"
+                "      return true;\n"
+                "    }\n"
+                "    if (cut)\n"
+                "      return false;\n"
+                "  }\n";
+        body += "  return false;\n";
+      } else {
+        body += "  if ((" + Tries(0, operands[0]) + ")";
+        for (size_t i = 1; i < operands.size(); i++)
+          body += "\n      || (" + Tries(i, operands[i]) + ")";
+        body += ") {\n"
+              "    context->AddMatch(start);\n"
+              "    return true;\n"
+              "  }\n"
+              "  return false;\n";
+      }
+      code += Header("Evaluate", number) + declarations
+            + "  Position start = context->GetPosition();\n" + body
+            + Trailer;
+      declarations.clear();
+      body = Memoized(number, false, validator);
+      break;
+    case Core::VT_GREEDYOR:
+      body = Candidates(nary, &declarations)
+            + "  bool success = false;\n"
+            "  Position longest = start;\n";
+      if (Analysis::Cuts(nary->GetOperands()
+            , Analysis::CUTS_INJECTED)) {
+        body += "  bool matched = false;\n  bool cut;\n";
+        for (size_t i = 0; i < operands.size(); i++)
+          body += "\n  context->SetPosition(start);\n"
+                + TriesInScope(i, operands[i]) +
+                "    matched = matched || success;\n"
+                "    if (context->GetPosition() > longest)\n"
+                "      longest = context->GetPosition();\n"
+                "    if (cut)\n"
+                "      goto done;\n"
+                "  }\n";
+        body += "\ndone:\n  success = matched;\n";
+      } else {
+        for (size_t i = 0; i < operands.size(); i++)
+          body += "\n  context->SetPosition(start);\n"
+                "  if (" + Tries(i, operands[i]) + ")\n"
+                "    success = true;\n"
+                "  if (context->GetPosition() > longest)\n"
+                "    longest = context->GetPosition();\n";
+      }
+      code += Header("Evaluate", number) + declarations
+            + "  Position start = context->GetPosition();\n" + body +
+            "\n  if (!success)\n"
+            "    return false;\n"
+            "  context->SetPosition(longest);\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n" + Trailer;
+      declarations.clear();
+      body = Memoized(number, false, validator);
+      break;
+    case Core::VT_NOT:
+      body = "  Position start = context->GetPosition();\n"
+            "  if (" + operand + "(context)) {\n"
+            "    context->SetPosition(start);\n"
+            "    return false;\n"
+            "  }\n"
+            "  return true;\n";
+      break;
+    case Core::VT_LOOKAHEAD:
+      body = "  Position start = context->GetPosition();\n"
+            "  bool result = " + operand + "(context);\n"
+            "  context->SetPosition(start);\n"
+            "  return result;\n";
+      break;
+    case Core::VT_LOOKBACK:
+      body = "  Position start = context->GetPosition();\n"
+            "  while (context->Backward()) {\n"
+            "    Position newStart = context->GetPosition();\n"
+            "    if (" + operand + "(context)\n"
+            "        && context->GetPosition() == start)\n"
+            "      return true;\n"
+            "    context->SetPosition(newStart);\n"
+            "  }\n"
+            "  context->SetPosition(start);\n"
+            "  return false;\n";
+      break;
+    case Core::VT_UNTIL: {
+      // as UntilValidator::Seek
+      vector<SChar> prefix = Analysis::Prefix(unary->GetOperand());
+      string skip;
+      if (!prefix.empty()) {
+        declarations = Literal(prefix, "prefix")
+              + Literal(Analysis::Prefix(unary->GetOperand(), false)
+                    , "leading");
+        body = "  SPEG::Utils::Flags& flags = context->Flags();\n";
+        skip = "    if (!flags.IsFlagSet(SPEG_CASEINSENSITIVE)\n"
+              "        && !flags.IsFlagSet(SPEG_IGNORESPACES)\n"
+              "        && !context->Seek(flags.IsFlagSet(SPEG_MATCHUNNAMED)"
+              " ? leading : prefix))\n"
+              "      break;\n";
+      }
+      body += "  Position start = context->GetPosition();\n"
+            "  do {\n" + skip +
+            "    Position before = context->GetPosition();\n"
+            "    if (" + operand + "(context)) {\n"
+            "      context->SetPosition(before);\n"
+            "      context->AddMatch(start);\n"
+            "      return true;\n"
+            "    }\n"
+            "  } while (context->Forward());\n\n"
+            "  context->SetPosition(start);\n"
+            "  return false;\n";
+      break;
+    }
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      char line[64];
+      sprintf(line, "%uU", repeat->MaxIterations());
+      string max = line;
+      sprintf(line, "%uU", repeat->MinIterations());
+      string min = line;
+
+      body = "  Position start = context->GetPosition();\n";
+      Utils::CharClass sensitive;
+      Utils::CharClass folded;
+      if (Primitives::Classify(unary->GetOperand(), &sensitive, &folded)) {
+        declarations = Class(sensitive, "sensitive")
+              + Class(folded, "folded");
+        body += "  SPEG::Utils::Flags& flags = context->Flags();\n"
+              "  if (!flags.IsFlagSet(SPEG_IGNORESPACES)"
+              " && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {\n"
+              "    size_t count = context->Span(\n"
+              "          flags.IsFlagSet(SPEG_CASEINSENSITIVE)"
+              " ? folded : sensitive, " + max + ");\n"
+              "    if (count < " + min + ") {\n"
+              "      context->SetPosition(start);\n"
+              "      return false;\n"
+              "    }\n"
+              "    context->AddMatch(start);\n"
+              "    return true;\n"
+              "  }\n\n";
+      }
+      body += "  for (unsigned int counter = 0; counter < " + max
+            + "; counter++) {\n"
+            "    Position before = context->GetPosition();\n";
+      if (!repeat->MinIterations()) {
+        body += "    if (!" + operand + "(context)\n"
+              "        || (context->GetPosition() == before"
+              " && !context->Step()))\n"
+              "      break;\n";
+      } else {
+        body += "    if (!" + operand + "(context)\n"
+              "        || (context->GetPosition() == before"
+              " && !context->Step())) {\n"
+              "      if (counter >= " + min + ")\n"
+              "        break;\n"
+              "      context->SetPosition(start);\n"
+              "      return false;\n"
+              "    }\n";
+      }
+      body += "  }\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n";
+      break;
+    }
+    case Core::VT_EXTRACT:
+      body = "  Position start = context->GetPosition();\n"
+            "  if (!" + operand + "(context))\n"
+            "    return false;\n"
+            "  context->AddMatch(" + Quote(
+                  static_cast<const Manipulators::ExtractValidator*>(
+                  validator)->Key()) + ", start);\n"
+            "  return true;\n";
+      break;
+    case Core::VT_REF:
+      code += Header("Evaluate", number) +
+            "  Position start = context->GetPosition();\n"
+            "  if (!" + Call(static_cast<const Manipulators::RefValidator*>(
+                  validator)->Target(), *generator) + "(context))\n"
+            "    return false;\n"
+            "  context->AddMatch(start);\n"
+            "  return true;\n" + Trailer;
+      body = Memoized(number, false, validator);
+      break;
+    case Core::VT_MEMO:
+      code += Header("Evaluate", number) + "  return " + operand
+            + "(context);\n" + Trailer;
+      body = Memoized(number, true, validator);
+      break;
+    case Core::VT_CASE:
+      body = string("  context->Flags().SetFlag(SPEG_CASEINSENSITIVE, ")
+            + (static_cast<const StateKeepers::CaseModifier*>(validator)
+                  ->Value() ? "true" : "false") + ");\n"
+            "  return true;\n";
+      break;
+    case Core::VT_SETVAR: {
+      const StateKeepers::SetFlagModifier* var =
+            static_cast<const StateKeepers::SetFlagModifier*>(validator);
+      body = "  context->SetVar(" + Quote(var->Flag()) + ", "
+            + Quote(var->Value()) + ");\n  return true;\n";
+      break;
+    }
+    case Core::VT_DELVAR:
+      body = "  context->DelVar(" + Quote(
+                  static_cast<const StateKeepers::DelFlagModifier*>(
+                  validator)->Flag()) + ");\n  return true;\n";
+      break;
+    case Core::VT_IF: {
+      const StateKeepers::IfValidator* var =
+            static_cast<const StateKeepers::IfValidator*>(validator);
+      body = "  const char* value = NULL;\n"
+            "  if (context->GetVar(" + Quote(var->Flag()) + ", &value))\n"
+            "    return strcmp(" + Quote(var->Value()) + ", value) == 0;\n"
+            "  return false;\n";
+      break;
+    }
+    case Core::VT_IFMATCHED: {
+      const StateKeepers::IfMatchedValidator* matched =
+            static_cast<const StateKeepers::IfMatchedValidator*>(validator);
+      body = "  unsigned long num = context->NumberOfMatches("
+            + Quote(matched->Key()) + ");\n"
+            "  return num >= " + Unsigned(matched->Min()) + " && num <= "
+            + Unsigned(matched->Max()) + ";\n";
+      break;
+    }
+    default:
+      break;
+  }
+  code += Header("Node", number) + declarations + body + Trailer;
+}
+
+DLL_PUBLIC bool Generate(const Core::StringValidator* root
+        , const char* name, string* source) {
+  Generator generator;
+  if (!name || !source || !Number(root, &generator))
+    return false;
+
+  string guard = "STRINGOZZI_GENERATED_";
+  for (const char* chr = name; *chr; chr++)
+    guard += static_cast<char>(toupper(static_cast<unsigned char>(*chr)));
+  guard += "_H_";
+
+  string declarations;
+  for (unsigned int i = 0; i < generator.Nodes.size(); i++)
+    declarations += Header("Node", i, false);
+
+  for (unsigned int i = 0; i < generator.Nodes.size(); i++)
+    Write(i, &generator);
+
+  *source = "// generated by SPEG::Engine::Generate(), do not edit\n"
+        "#ifndef " + guard + "\n"
+        "#define " + guard + "\n"
+        "#include \"Stringozzi.h\"\n\n"
+        "namespace " + name + " {\n"
+        "typedef SPEG::Core::Position Position;\n\n"
+        "inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]\n"
+        "      , size_t count) {\n"
+        "  SPEG::Utils::CharClass set;\n"
+        "  for (size_t i = 0; i < count; i++)\n"
+        "    set.AddRange(ranges[i][0], ranges[i][1]);\n"
+        "  return set;\n"
+        "}\n\n"
+        + declarations + "\n" + generator.Code +
+        "template <typename __CONTEXT>\n"
+        "inline bool Check(__CONTEXT* context) {\n"
+        "  return Node0(context);\n"
+        "}\n\n"
+        "template <typename __CHARTYPE>\n"
+        "inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {\n"
+        "  if (!str)\n"
+        "    return false;\n"
+        "  SPEG::Core::Context<__CHARTYPE> context(str, flags);\n"
+        "  return Node0(&context);\n"
+        "}\n\n"
+        "// a Context<> is called directly, as Core::Direct() does\n"
+        "class Validator : public SPEG::Core::NormalValidator {\n"
+        " public:\n"
+        "  virtual bool Check(SPEG::Core::ContextInterface* context) const {\n"
+        "    switch (context->Kind()) {\n"
+        "      case SPEG::Core::CK_CHAR:\n"
+        "        return Node0(static_cast<SPEG::Core::ContextA*>(context));\n"
+        "      case SPEG::Core::CK_WCHAR:\n"
+        "        return Node0(static_cast<SPEG::Core::ContextW*>(context));\n"
+        "      default:\n"
+        "        return Node0(context);\n"
+        "    }\n"
+        "  }\n"
+        "};\n"
+        "}  // namespace " + name + "\n"
+        "#endif  // " + guard + "\n";
+  return true;
+}
+// the nodes of the regular tree an automaton is built from, the 
+// characters are already folded in the case insensitive automaton
+enum RegularKind {
+  RK_SET,     // a character of the class First
+  RK_EOT,     // the end of text, without moving
+  RK_BOT,     // the beginning of text
+  RK_EMPTY,
+  RK_SEQ,
+  RK_OR,
+  RK_NOT,
+  RK_AHEAD,
+  RK_UNTIL,
+  RK_REPEAT
+};
+
+struct RegularNode {
+  RegularKind Kind;
+  int First;
+  int Second;
+  unsigned int Min;
+  unsigned int Max;
+};
+
+// a continuation is a chain of frames: the node to parse (and how many 
+// times a repetition was parsed) then the rest of the chain .. a frame 
+// without node commits the nearest ordered choice. Chain 0 ends the 
+// match and chain 1 ends a predicate
+struct Frame {
+  int Node;
+  unsigned int Count;
+  int Next;
+};
+
+// a state is a term of the parsing paths that are alive, written in 
+// prefix order, the first operand of a choice precedes the second one
+enum {
+  T_FAIL,
+  T_ACCEPT,   // matched, the end is in the register that follows
+  T_DONE,     // the predicate matched
+  T_START,    // the chain that follows starts at the current character
+  T_NEXT,     // the chain that follows starts at the next character
+  T_CHOICE,   // first operand until it commits, otherwise the second one
+  T_PEEK,     // predicate, then, else
+  T_PASSED    // the operand committed the nearest choice
+};
+
+static const long EDGE_UNKNOWN = -1;
+static const long EDGE_FAIL = -2;
+static const long EDGE_ACCEPT = -3;
+static const long EDGE_OVERFLOW = -4;
+
+struct AutomatonEdge {
+  // the next state, or one of the EDGE_ values, it is written last
+  volatile long Next;
+  // the register of the end on EDGE_ACCEPT, -1 for the current position
+  int Accept;
+  // the register every register of the next state is copied from, -1 for
+  // the current position
+  vector<int> From;
+  // the edges of the next state, so a step does not go through States
+  AutomatonEdge* Target;
+
+  AutomatonEdge() : Next(EDGE_UNKNOWN), Accept(-1), Target(NULL) {}
+};
+
+struct AutomatonState {
+  vector<int> Term;
+  bool Bot;
+  AutomatonEdge* Edges;
+};
+
+struct Automaton {
+  vector<RegularNode> Nodes;
+  vector<Utils::CharClass> Sets;
+  int Root;
+
+  // the alphabet: characters are grouped into the classes no set tells 
+  // apart, class 0 is the end of text
+  int Table[256];
+  vector<SChar> Bounds;
+  vector<int> Classes;
+  vector<SChar> Samples;
+
+  vector<Frame> Frames;
+  map<pair<pair<int, unsigned int>, int>, int> FrameIds;
+  vector<AutomatonState*> States;
+  map<vector<int>, long> StateIds;
+  size_t Limit;
+  unsigned long Lock;
+  volatile long Full;
+
+  // an automaton of Until(x) seeks the literal x starts with, as the tree
+  Utils::Literal Prefix;
+
+  Automaton() : Root(-1), Limit(0), Lock(0), Full(0) {}
+
+  ~Automaton() {
+    for (size_t i = 0; i < States.size(); i++) {
+      delete[] States[i]->Edges;
+      delete States[i];
+    }
+  }
+
+  int Add(RegularKind kind, int first, int second = -1
+        , unsigned int min = 0, unsigned int max = 0) {
+    if (first < 0 || (second < 0 && (kind == RK_SEQ || kind == RK_OR)))
+      return -1;
+    RegularNode node;
+    node.Kind = kind;
+    node.First = first;
+    node.Second = second;
+    node.Min = min;
+    node.Max = max;
+    Nodes.push_back(node);
+    return static_cast<int>(Nodes.size()) - 1;
+  }
+
+  int Add(const Utils::CharClass& set) {
+    Sets.push_back(set);
+    return Add(RK_SET, static_cast<int>(Sets.size()) - 1);
+  }
+
+  inline int Class(SChar chr) const {
+    if (chr < 256)
+      return Table[chr];
+    size_t low = 0;
+    size_t high = Bounds.size();
+    while (low < high) {
+      size_t mid = (low + high) / 2;
+      if (Bounds[mid] <= chr)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return Classes[low - 1];
+  }
+
+  bool Nullable(int node) const;
+  void Index();
+  int Push(int node, unsigned int count, int next);
+  void Expand(int chain, int cls, bool bot, vector<int>* out);
+  void Resolve(const vector<int>& term, size_t* at, int cls, bool bot
+        , vector<int>* out);
+  long Insert(const vector<int>& term, bool bot);
+  long Build(long state, int cls);
+  template <typename __CURSOR>
+  int Scan(__CURSOR* cursor, bool bot);
+};
+
+bool Automaton::Nullable(int node) const {
+  const RegularNode& regular = Nodes[node];
+  switch (regular.Kind) {
+    case RK_SET:
+      return false;
+    case RK_SEQ:
+      return Nullable(regular.First) && Nullable(regular.Second);
+    case RK_OR:
+      return Nullable(regular.First) || Nullable(regular.Second);
+    case RK_REPEAT:
+      return !regular.Min || !regular.Max || Nullable(regular.First);
+    default:
+      return true;
+  }
+}
+
+static SChar Fold(SChar chr, bool folded) {
+  return folded ? Utils::CharToLower(chr) : chr;
+}
+
+static int LowerPhrase(const vector<SChar>& phrase, bool folded
+        , Automaton* automaton) {
+  if (phrase.empty())
+    return automaton->Add(RK_EMPTY, 0);
+  int node = -1;
+  for (size_t i = phrase.size(); i-- > 0;) {
+    if (!phrase[i])
+      return -1;
+    Utils::CharClass set;
+    set.Add(Fold(phrase[i], folded));
+    int chr = automaton->Add(set);
+    node = (i + 1 == phrase.size()) ? chr : automaton->Add(RK_SEQ, chr, node);
+  }
+  return node;
+}
+
+static bool ZeroWidth(const Automaton* automaton, int node) {
+  RegularKind kind = automaton->Nodes[node].Kind;
+  return kind == RK_NOT || kind == RK_AHEAD || kind == RK_EOT 
+        || kind == RK_BOT || kind == RK_EMPTY;
+}
+
+// lower the tree into the nodes of the automaton, -1 if it is not regular
+static int Lower(const Core::StringValidator* validator, bool folded
+        , Automaton* automaton
+        , map<const Core::StringValidator*, int>* lowered) {
+  map<const Core::StringValidator*, int>::iterator found =
+        lowered->find(validator);
+  if (found != lowered->end())
+    return found->second;
+
+  int node = -1;
+  switch (validator->Type()) {
+    case Core::VT_IS: {
+      SChar chr = static_cast<const Primitives::CharValidator*>(validator)
+            ->Character();
+      if (!chr) {
+        node = automaton->Add(RK_EOT, 0);
+      } else {
+        Utils::CharClass set;
+        set.Add(Fold(chr, folded));
+        node = automaton->Add(set);
+      }
+      break;
+    }
+    case Core::VT_IN: {
+      // '\0' matches the end of text without moving
+      const vector<SChar>& chars =
+            static_cast<const Primitives::CharSetValidator*>(validator)
+              ->Characters();
+      Utils::CharClass set;
+      bool eot = false;
+      for (size_t i = 0; i < chars.size(); i++) {
+        if (chars[i])
+          set.Add(Fold(chars[i], folded));
+        else
+          eot = true;
+      }
+      node = automaton->Add(set);
+      if (eot)
+        node = automaton->Add(RK_OR, node, automaton->Add(RK_EOT, 0));
+      break;
+    }
+    case Core::VT_BETWEEN: {
+      const Primitives::CharRangeValidator* range =
+            static_cast<const Primitives::CharRangeValidator*>(validator);
+      SChar min = Fold(range->Min(), folded);
+      SChar max = Fold(range->Max(), folded);
+      Utils::CharClass set;
+      if (min <= max)
+        set.AddRange(min, max);
+      set.Remove(0);
+      node = automaton->Add(set);
+      break;
+    }
+    case Core::VT_EXACT:
+      node = LowerPhrase(static_cast<const Primitives::PhraseValidator*>(
+            validator)->Phrase(), folded, automaton);
+      break;
+    case Core::VT_ANY: {
+      Utils::CharClass set;
+      set.AddRange(1, (SChar)-1);
+      node = automaton->Add(set);
+      break;
+    }
+    case Core::VT_BOT:
+      node = automaton->Add(RK_BOT, 0);
+      break;
+    case Core::VT_CLASS: {
+      // Get() returns the lower case character in case insensitive mode
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(validator);
+      node = automaton->Add(folded ? fused->Folded() : fused->Sensitive());
+      break;
+    }
+    case Core::VT_PROPERTY: {
+      const Primitives::PropertyValidator* property =
+            static_cast<const Primitives::PropertyValidator*>(validator);
+      node = automaton->Add(folded ? property->Folded()
+            : property->Sensitive());
+      break;
+    }
+    case Core::VT_TRIE: {
+      // the earlier phrase wins as in a choice of phrases
+      const vector<vector<SChar> >& phrases =
+            static_cast<const Primitives::TrieValidator*>(validator)
+              ->Phrases();
+      for (size_t i = phrases.size(); i-- > 0;) {
+        int phrase = LowerPhrase(phrases[i], folded, automaton);
+        node = (i + 1 == phrases.size()) ? phrase 
+              : automaton->Add(RK_OR, phrase, node);
+      }
+      break;
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR: {
+      // the operands are folded from the last one into binary nodes
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      RegularKind kind = (validator->Type() == Core::VT_SEQ)
+            ? RK_SEQ : RK_OR;
+      for (size_t i = nary->Count(); i-- > 0;) {
+        int operand = Lower(nary->GetOperand(i), folded, automaton
+              , lowered);
+        if (operand < 0) {
+          node = -1;
+          break;
+        }
+        node = (i + 1 == nary->Count()) ? operand
+              : automaton->Add(kind, operand, node);
+      }
+      break;
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      int first = Lower(binary->GetFirstOperand(), folded, automaton
+            , lowered);
+      int second = Lower(binary->GetSecondOperand(), folded, automaton
+            , lowered);
+      if (first < 0 || second < 0)
+        break;
+      if (ZeroWidth(automaton, second)) {
+        // the operand that does not move is a predicate before the other
+        node = automaton->Add(RK_SEQ, automaton->Add(RK_AHEAD, second)
+              , first);
+      } else if (ZeroWidth(automaton, first)) {
+        node = automaton->Add(RK_SEQ, automaton->Add(RK_AHEAD, first)
+              , second);
+      }
+      break;
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_UNTIL: {
+      int operand = Lower(static_cast<const Core::UnaryValidator*>(
+            validator)->GetOperand(), folded, automaton, lowered);
+      RegularKind kind = RK_UNTIL;
+      if (validator->Type() == Core::VT_NOT)
+        kind = RK_NOT;
+      else if (validator->Type() == Core::VT_LOOKAHEAD)
+        kind = RK_AHEAD;
+      node = automaton->Add(kind, operand);
+      break;
+    }
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      int operand = Lower(repeat->GetOperand(), folded, automaton, lowered);
+      unsigned int max = repeat->MaxIterations();
+      // an operand that matches nothing is parsed again up to max times
+      if (operand < 0 || (automaton->Nullable(operand) && max > 256))
+        break;
+      node = automaton->Add(RK_REPEAT, operand, -1
+            , repeat->MinIterations(), max);
+      break;
+    }
+    case Core::VT_EXTRACT:
+    case Core::VT_MEMO:
+      // the matches are recorded by the tree, the memo table does not
+      // change the outcome
+      node = Lower(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand(), folded, automaton, lowered);
+      break;
+    case Core::VT_PROGRAM:
+      node = Lower(static_cast<const ProgramValidator*>(validator)->Root()
+            , folded, automaton, lowered);
+      break;
+    case Core::VT_AUTOMATON:
+      node = Lower(static_cast<const AutomatonValidator*>(validator)
+            ->Root(), folded, automaton, lowered);
+      break;
+    default:
+      break;
+  }
+  (*lowered)[validator] = node;
+  return node;
+}
+
+void Automaton::Index() {
+  map<vector<bool>, int> classes;
+  Samples.push_back(0);
+  Table[0] = 0;
+
+  vector<SChar> bounds;
+  bounds.push_back(256);
+  for (size_t i = 0; i < Sets.size(); i++) {
+    for (size_t j = 0; j < Sets[i].Ranges.size(); j++) {
+      bounds.push_back(Sets[i].Ranges[j].first);
+      if (Sets[i].Ranges[j].second != (SChar)-1)
+        bounds.push_back(Sets[i].Ranges[j].second + 1);
+    }
+  }
+  std::sort(bounds.begin(), bounds.end());
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  // every character below 256, then every range between two bounds
+  for (size_t i = 1; i < 256 + bounds.size(); i++) {
+    SChar chr = (i < 256) ? static_cast<SChar>(i) : bounds[i - 256];
+    vector<bool> members(Sets.size());
+    for (size_t j = 0; j < Sets.size(); j++)
+      members[j] = Sets[j].Contains(chr);
+
+    map<vector<bool>, int>::iterator found = classes.find(members);
+    int cls;
+    if (found == classes.end()) {
+      cls = static_cast<int>(Samples.size());
+      classes.insert(make_pair(members, cls));
+      Samples.push_back(chr);
+    } else {
+      cls = found->second;
+    }
+    if (i < 256) {
+      Table[i] = cls;
+    } else {
+      Bounds.push_back(chr);
+      Classes.push_back(cls);
+    }
+  }
+}
+
+int Automaton::Push(int node, unsigned int count, int next) {
+  pair<pair<int, unsigned int>, int> key(make_pair(node, count), next);
+  map<pair<pair<int, unsigned int>, int>, int>::iterator found =
+        FrameIds.find(key);
+  if (found != FrameIds.end())
+    return found->second;
+
+  Frame frame;
+  frame.Node = node;
+  frame.Count = count;
+  frame.Next = next;
+  // chains 0 and 1 are the ends
+  int chain = static_cast<int>(Frames.size()) + 2;
+  Frames.push_back(frame);
+  FrameIds.insert(make_pair(key, chain));
+  return chain;
+}
+
+// the end of the subterm at the position
+static size_t SkipTerm(const vector<int>& term, size_t at) {
+  switch (term[at]) {
+    case T_ACCEPT:
+    case T_START:
+    case T_NEXT:
+      return at + 2;
+    case T_CHOICE:
+      return SkipTerm(term, SkipTerm(term, at + 1));
+    case T_PEEK:
+      return SkipTerm(term, SkipTerm(term, SkipTerm(term, at + 1)));
+    case T_PASSED:
+      return SkipTerm(term, at + 1);
+    default:
+      return at + 1;
+  }
+}
+
+// a path that committed and failed still fails the choice
+static void Passed(const vector<int>& operand, vector<int>* out) {
+  out->push_back(T_PASSED);
+  out->insert(out->end(), operand.begin(), operand.end());
+}
+
+static void Choice(const vector<int>& first, const vector<int>& second
+        , vector<int>* out) {
+  if (first[0] == T_FAIL) {
+    out->insert(out->end(), second.begin(), second.end());
+  } else if (first[0] == T_PASSED) {
+    out->insert(out->end(), first.begin() + 1, first.end());
+  } else {
+    out->push_back(T_CHOICE);
+    out->insert(out->end(), first.begin(), first.end());
+    out->insert(out->end(), second.begin(), second.end());
+  }
+}
+
+static void Peek(const vector<int>& predicate, const vector<int>& then
+        , const vector<int>& otherwise, vector<int>* out) {
+  if (predicate[0] == T_FAIL) {
+    out->insert(out->end(), otherwise.begin(), otherwise.end());
+    return;
+  }
+  if (predicate[0] == T_DONE || then == otherwise) {
+    out->insert(out->end(), then.begin(), then.end());
+    return;
+  }
+
+  out->push_back(T_PEEK);
+  out->insert(out->end(), predicate.begin(), predicate.end());
+  out->insert(out->end(), then.begin(), then.end());
+
+  // the same predicate one character later (i.e. Until) fails whenever 
+  // this one fails and is never taken when this one matches
+  if (otherwise[0] == T_PEEK) {
+    size_t split = SkipTerm(otherwise, 1);
+    if (split - 1 == predicate.size()
+        && std::equal(predicate.begin(), predicate.end()
+              , otherwise.begin() + 1)) {
+      out->insert(out->end(), otherwise.begin() + SkipTerm(otherwise, split)
+            , otherwise.end());
+      return;
+    }
+  }
+  out->insert(out->end(), otherwise.begin(), otherwise.end());
+}
+
+void Automaton::Expand(int chain, int cls, bool bot, vector<int>* out) {
+  if (chain == 0) {
+    out->push_back(T_ACCEPT);
+    out->push_back(-1);
+    return;
+  }
+  if (chain == 1) {
+    out->push_back(T_DONE);
+    return;
+  }
+
+  Frame frame = Frames[chain - 2];
+  if (frame.Node < 0) {
+    vector<int> operand;
+    Expand(frame.Next, cls, bot, &operand);
+    Passed(operand, out);
+    return;
+  }
+
+  RegularNode node = Nodes[frame.Node];
+  switch (node.Kind) {
+    case RK_SET:
+      if (cls && Sets[node.First].Contains(Samples[cls])) {
+        out->push_back(T_NEXT);
+        out->push_back(frame.Next);
+      } else {
+        out->push_back(T_FAIL);
+      }
+      return;
+    case RK_EOT:
+    case RK_BOT:
+      if ((node.Kind == RK_EOT) ? !cls : bot)
+        Expand(frame.Next, cls, bot, out);
+      else
+        out->push_back(T_FAIL);
+      return;
+    case RK_EMPTY:
+      Expand(frame.Next, cls, bot, out);
+      return;
+    case RK_SEQ:
+      Expand(Push(node.First, 0, Push(node.Second, 0, frame.Next))
+            , cls, bot, out);
+      return;
+    case RK_OR:
+    case RK_REPEAT: {
+      vector<int> first;
+      vector<int> second;
+      if (node.Kind == RK_OR) {
+        Expand(Push(node.First, 0, Push(-1, 0, frame.Next)), cls, bot
+              , &first);
+      } else {
+        const unsigned int infinite = static_cast<unsigned int>(-1);
+        if (node.Max != infinite && frame.Count >= node.Max) {
+          Expand(frame.Next, cls, bot, out);
+          return;
+        }
+        // the counts beyond the minimum are all the same if unbounded
+        unsigned int count = frame.Count + 1;
+        if (node.Max == infinite)
+          count = MINIMUM(count, node.Min);
+        Expand(Push(node.First, 0, Push(-1, 0, Push(frame.Node, count
+              , frame.Next))), cls, bot, &first);
+      }
+
+      if (first[0] == T_PASSED) {
+        out->insert(out->end(), first.begin() + 1, first.end());
+        return;
+      }
+      if (node.Kind == RK_OR)
+        Expand(Push(node.Second, 0, frame.Next), cls, bot, &second);
+      else if (frame.Count >= node.Min)
+        Expand(frame.Next, cls, bot, &second);
+      else
+        second.push_back(T_FAIL);
+      Choice(first, second, out);
+      return;
+    }
+    case RK_NOT:
+    case RK_AHEAD:
+    case RK_UNTIL: {
+      vector<int> predicate;
+      vector<int> then;
+      vector<int> otherwise;
+      Expand(Push(node.First, 0, 1), cls, bot, &predicate);
+      if (predicate[0] != T_FAIL) {
+        if (node.Kind == RK_NOT)
+          then.push_back(T_FAIL);
+        else
+          Expand(frame.Next, cls, bot, &then);
+      }
+      if (predicate[0] != T_DONE) {
+        if (node.Kind == RK_NOT) {
+          Expand(frame.Next, cls, bot, &otherwise);
+        } else if (node.Kind == RK_UNTIL && cls) {
+          // try again at the next character
+          otherwise.push_back(T_NEXT);
+          otherwise.push_back(chain);
+        } else {
+          otherwise.push_back(T_FAIL);
+        }
+      }
+      Peek(predicate, then, otherwise, out);
+      return;
+    }
+  }
+}
+
+void Automaton::Resolve(const vector<int>& term, size_t* at, int cls
+        , bool bot, vector<int>* out) {
+  int op = term[(*at)++];
+  switch (op) {
+    case T_ACCEPT:
+      out->push_back(op);
+      out->push_back(term[(*at)++]);
+      return;
+    case T_START:
+      Expand(term[(*at)++], cls, bot, out);
+      return;
+    case T_PASSED: {
+      vector<int> operand;
+      Resolve(term, at, cls, bot, &operand);
+      Passed(operand, out);
+      return;
+    }
+    case T_CHOICE: {
+      vector<int> first;
+      vector<int> second;
+      Resolve(term, at, cls, bot, &first);
+      if (first[0] == T_PASSED) {
+        *at = SkipTerm(term, *at);
+        out->insert(out->end(), first.begin() + 1, first.end());
+        return;
+      }
+      Resolve(term, at, cls, bot, &second);
+      Choice(first, second, out);
+      return;
+    }
+    case T_PEEK: {
+      vector<int> predicate;
+      vector<int> then;
+      vector<int> otherwise;
+      Resolve(term, at, cls, bot, &predicate);
+      if (predicate[0] == T_FAIL)
+        *at = SkipTerm(term, *at);
+      else
+        Resolve(term, at, cls, bot, &then);
+      if (predicate[0] == T_DONE)
+        *at = SkipTerm(term, *at);
+      else
+        Resolve(term, at, cls, bot, &otherwise);
+      Peek(predicate, then, otherwise, out);
+      return;
+    }
+    default:
+      out->push_back(op);
+      return;
+  }
+}
+
+long Automaton::Insert(const vector<int>& term, bool bot) {
+  vector<int> key(1, bot);
+  key.insert(key.end(), term.begin(), term.end());
+  map<vector<int>, long>::iterator found = StateIds.find(key);
+  if (found != StateIds.end())
+    return found->second;
+  if (States.size() >= Limit)
+    return EDGE_OVERFLOW;
+
+  AutomatonState* state = new AutomatonState();
+  state->Term = term;
+  state->Bot = bot;
+  state->Edges = new AutomatonEdge[Samples.size()];
+  long id = static_cast<long>(States.size());
+  // the room is reserved, so the states are read without the lock once 
+  // the edge that leads to them is loaded by SafeLoad
+  States.push_back(state);
+  StateIds.insert(make_pair(key, id));
+  return id;
+}
+
+long Automaton::Build(long state, int cls) {
+  AutomatonEdge* edge = &States[state]->Edges[cls];
+  if (Utils::SafeLoad(&edge->Next) != EDGE_UNKNOWN)
+    return edge->Next;
+  if (Full)
+    return EDGE_OVERFLOW;
+
+  vector<int> term;
+  size_t at = 0;
+  Resolve(States[state]->Term, &at, cls, States[state]->Bot, &term);
+
+  long next = EDGE_FAIL;
+  if (term[0] == T_ACCEPT) {
+    edge->Accept = term[1];
+    next = EDGE_ACCEPT;
+  } else if (term[0] != T_FAIL && cls) {
+    // the registers are numbered in order, so equal states are equal terms
+    vector<int> from;
+    for (size_t i = 0; i < term.size(); i++) {
+      if (term[i] == T_NEXT) {
+        term[i++] = T_START;
+      } else if (term[i] == T_ACCEPT || term[i] == T_START) {
+        if (term[i++] == T_ACCEPT) {
+          from.push_back(term[i]);
+          term[i] = static_cast<int>(from.size()) - 1;
+        }
+      }
+    }
+    next = (from.size() > SPEG_DFA_REGISTERS) ? EDGE_OVERFLOW 
+          : Insert(term, false);
+    edge->From = from;
+    if (next >= 0)
+      edge->Target = States[next]->Edges;
+  }
+
+  if (next == EDGE_OVERFLOW)
+    Utils::SafeStore(&Full, 1);
+  else
+    Utils::SafeStore(&edge->Next, next);
+  return next;
 }
 
-bool AnyValidator::Check(Core::ContextInterface* context) const {
-  Core::Position start = context->GetPosition();
-  if (context->Forward()) {
-    context->AddMatch(start);
+// reads the text through the context interface
+struct ContextCursor {
+  Core::ContextInterface* Context;
+
+  inline SChar Get() { return Context->Get(); }
+  inline Core::Position GetPosition() { return Context->GetPosition(); }
+  inline void SetPosition(Core::Position pos) { Context->SetPosition(pos); }
+  inline void Forward() { Context->Forward(); }
+  inline bool Seek(const Utils::Literal& literal) {
+    return Context->Seek(literal);
+  }
+};
+
+// reads UTF-8 text directly, the ASCII characters are not decoded.. a
+// bounded text is read through the bounded helpers and SPEG_BYTES reads
+// a byte as a character
+struct TextCursor {
+  const char** Pointer;
+  const char* End;
+  bool Folded;
+  bool Bytes;
+
+  inline SChar Get() {
+    SChar chr;
+    if (Bytes) {
+      chr = Utils::GetByte(*Pointer, End);
+    } else if (End) {
+      chr = Utils::GetChar(*Pointer, End);
+    } else {
+      unsigned char byte = static_cast<unsigned char>(**Pointer);
+      chr = (byte < 0x80) ? byte : Utils::GetChar(*Pointer);
+    }
+    if (Folded)
+      chr = Utils::CharToLower(chr);
+    return chr;
+  }
+  inline Core::Position GetPosition() { return *Pointer; }
+  inline void SetPosition(Core::Position pos) {
+    *Pointer = static_cast<const char*>(pos);
+  }
+  inline void Forward() {
+    if (Bytes) {
+      if (End ? *Pointer < End : **Pointer != 0)
+        (*Pointer)++;
+    } else if (End) {
+      if (*Pointer < End)
+        Utils::Increment(Pointer, End);
+    } else if (static_cast<unsigned char>(**Pointer) < 0x80) {
+      if (**Pointer)
+        (*Pointer)++;
+    } else {
+      Utils::Increment(Pointer);
+    }
+  }
+  inline bool Seek(const Utils::Literal& literal) {
+    const char* found = Bytes ? Utils::FindBytes(*Pointer, End, literal)
+          : Utils::Find(*Pointer, End, literal);
+    if (!found)
+      return false;
+    *Pointer = found;
     return true;
   }
-  return false;
-}
+};
+
+template <typename __CURSOR>
+int Automaton::Scan(__CURSOR* cursor, bool bot) {
+  Core::Position start = cursor->GetPosition();
+  Core::Position registers[2][SPEG_DFA_REGISTERS];
+  int current = 0;
+  // state 1 is the start at the beginning of text
+  long state = bot ? 1 : 0;
+  AutomatonEdge* edges = States[state]->Edges;
+
+  while (true) {
+    // the start at the beginning of text seeks too, as Until does, and is
+    // no longer at the beginning once the literal is found further on
+    if (state <= 1 && !Prefix.Empty()) {
+      Core::Position here = cursor->GetPosition();
+      if (!cursor->Seek(Prefix))
+        break;
+      if (cursor->GetPosition() != here) {
+        state = 0;
+        edges = States[0]->Edges;
+      }
+    }
 
-bool InChainValidator::Check(Core::ContextInterface* context) const {
-  Core::Position start = context->GetPosition();
-  SChar curr = context->Get();
-  if (context->Backward()) {
-    SChar prev = context->Get();
-    context->Forward();
-    if (prev == curr - 1 && context->Forward()) {
-      context->AddMatch(start);
-      return true;
+    int cls = Class(cursor->Get());
+    AutomatonEdge* edge = &edges[cls];
+    // the edge, and the state it leads to, are written before Next
+    long next = Utils::SafeLoad(&edge->Next);
+    if (next == EDGE_UNKNOWN) {
+      Utils::SafeLock(&Lock);
+      next = Build(state, cls);
+      Utils::SafeUnlock(&Lock);
     }
-  }
-  return false;
-}
 
-}  // namespace Primitives
+    if (next == EDGE_ACCEPT) {
+      if (edge->Accept >= 0)
+        cursor->SetPosition(registers[current][edge->Accept]);
+      return 1;
+    }
+    if (next == EDGE_FAIL)
+      break;
+    if (next == EDGE_OVERFLOW) {
+      cursor->SetPosition(start);
+      return -1;
+    }
 
-namespace StateKeepers {
-bool CaseModifier::Check(Core::ContextInterface* context) const {
-  context->Flags().SetFlag(SPEG_CASEINSENSITIVE, _caseSensitive);
-  return true;
+    const vector<int>& from = edge->From;
+    if (!from.empty()) {
+      Core::Position here = cursor->GetPosition();
+      for (size_t i = 0; i < from.size(); i++)
+        registers[1 - current][i] = (from[i] < 0) ? here 
+              : registers[current][from[i]];
+      current = 1 - current;
+    }
+    cursor->Forward();
+    state = next;
+    edges = edge->Target;
+  }
+
+  cursor->SetPosition(start);
+  return 0;
 }
 
-bool SetFlagModifier::Check(Core::ContextInterface* context) const {
-  context->SetVar(_flag, _value);
-  return true;
+DLL_PUBLIC int Run(Automaton* automaton, Core::ContextInterface* context) {
+  ContextCursor cursor;
+  cursor.Context = context;
+  return automaton->Scan(&cursor, context->BOT());
 }
 
-bool DelFlagModifier::Check(Core::ContextInterface* context) const {
-  context->DelVar(_flag);
-  return true;
+template<>
+DLL_PUBLIC int Run<char>(Automaton* automaton
+        , Core::ContextInterface* context
+        , const char** pointer
+        , const char* end) {
+  TextCursor cursor;
+  cursor.Pointer = pointer;
+  cursor.End = end;
+  cursor.Folded = context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);
+  cursor.Bytes = context->Flags().IsFlagSet(SPEG_BYTES);
+  return automaton->Scan(&cursor, context->BOT());
 }
 
-bool IfValidator::Check(Core::ContextInterface* context) const {
-  const char *val = NULL;
-  if (context->GetVar(_flag, &val)) {
-    return strcmp(_value, val) == 0;
+static Automaton* BuildAutomaton(const Core::StringValidator* root
+        , bool folded, size_t limit) {
+  Automaton* automaton = new Automaton();
+  map<const Core::StringValidator*, int> lowered;
+  automaton->Root = Lower(root, folded, automaton, &lowered);
+  if (automaton->Root < 0) {
+    delete automaton;
+    return NULL;
   }
-  return false;
+  automaton->Index();
+  automaton->Limit = MAXIMUM(limit, (size_t)2);
+  automaton->States.reserve(automaton->Limit);
+
+  vector<int> start;
+  start.push_back(T_START);
+  start.push_back(automaton->Push(automaton->Root, 0, 0));
+  automaton->Insert(start, false);
+  automaton->Insert(start, true);
+  return automaton;
 }
 
-bool IfMatchedValidator::Check(Core::ContextInterface* context) const {
-  unsigned int num = context->NumberOfMatches(_key);
-  return (num >= _min && num <= _max);
+DLL_PUBLIC AutomatonValidator::AutomatonValidator(Core::StringValidator* root
+        , size_t limit)
+  : _root(root) {
+  _root->AddReference();
+  _sensitive = BuildAutomaton(_root, false, limit);
+  _folded = BuildAutomaton(_root, true, limit);
+
+  // the literals are sought case sensitively, as Until does
+  const Core::StringValidator* until = _root;
+  while (until->Type() == Core::VT_MEMO || until->Type() == Core::VT_EXTRACT)
+    until = static_cast<const Core::UnaryValidator*>(until)->GetOperand();
+  if (_sensitive && until->Type() == Core::VT_UNTIL)
+    _sensitive->Prefix = Utils::Literal(Analysis::Prefix(
+          static_cast<const Core::UnaryValidator*>(until)->GetOperand()));
 }
 
-}  // namespace StateKeepers
-
-namespace Manipulators {
-bool RepeatValidator::Check(Core::ContextInterface* context) const {
-  Core::Position start = context->GetPosition();
-
-  for (unsigned int counter = 0; counter < _maxIter; counter++) {
-    Core::Position startOp = context->GetPosition();
-    if (!Operand->Check(context)) {
-      if (counter >= _minIter) {
-        break;
-      } else {
-        context->SetPosition(start);
-        return false;
-      }
-    }
-  }
-  context->AddMatch(start);
-  return true;
+void AutomatonValidator::Dispose() {
+  delete _sensitive;
+  delete _folded;
+  _root->Release();
 }
 
-bool RefValidator::Check(Core::ContextInterface* context) const {
-  Core::Position start = context->GetPosition();
-  if (!_validator) {
-    if (_rule->Get()->Check(context)) {
-      context->AddMatch(start);
-      return true;
-    } else {
-      return false;
+bool AutomatonValidator::Check(Core::ContextInterface* context) const {
+  Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES)
+      && !flags.IsFlagSet(SPEG_MATCHNAMED)
+      && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    Automaton* automaton =
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? _folded : _sensitive;
+    if (automaton && !automaton->Full) {
+      int result = context->Run(automaton);
+      if (result >= 0)
+        return result != 0;
     }
   }
+  return _root->Check(context);
+}
 
-  if (_validator && _validator->Check(context)) {
-    context->AddMatch(start);
-    return true;
-  }
-  return false;
+DLL_PUBLIC size_t AutomatonValidator::States(bool folded) const {
+  Automaton* automaton = folded ? _folded : _sensitive;
+  if (!automaton)
+    return 0;
+  Utils::SafeLock(&automaton->Lock);
+  size_t count = automaton->States.size();
+  Utils::SafeUnlock(&automaton->Lock);
+  return count;
 }
 
-DLL_PUBLIC void RefValidator::Set(const Core::Rule &rule) {
-  _validator = rule.Get();
+DLL_PUBLIC bool AutomatonValidator::Overflowed(bool folded) const {
+  Automaton* automaton = folded ? _folded : _sensitive;
+  return !automaton || automaton->Full;
 }
 
-}  // namespace Manipulators
+DLL_PUBLIC bool AutomatonValidator::Regular(
+        const Core::StringValidator* root) {
+  Automaton automaton;
+  map<const Core::StringValidator*, int> lowered;
+  return Lower(root, false, &automaton, &lowered) >= 0;
+}
+}  // namespace Engine
 
 namespace Core {
 DLL_PUBLIC Rule& Rule::operator=(const Rule &other) {
@@ -439,6 +4968,10 @@ DLL_PUBLIC Rule& Rule::operator=(const Rule &other) {
   _strValid->AddReference();
   return ((*this));
 }
+
+DLL_PUBLIC Rule Rule::Compile() const {
+  return new Engine::ProgramValidator(_strValid);
+}
 }  // namespace Core
 }  // namespace SPEG
 
@@ -450,12 +4983,14 @@ DLL_PUBLIC SPEG::Core::Rule operator > (const SPEG::Core::Rule& first
 
 DLL_PUBLIC SPEG::Core::Rule operator & (const SPEG::Core::Rule& first
             , const SPEG::Core::Rule& second) {
-  return new SPEG::Manipulators::AndValidator(first.Get(), second.Get());
+  return SPEG::Primitives::Fuse(
+        new SPEG::Manipulators::AndValidator(first.Get(), second.Get()));
 }
 
 DLL_PUBLIC SPEG::Core::Rule operator | (const SPEG::Core::Rule& first
               , const SPEG::Core::Rule& second) {
-    return new SPEG::Manipulators::OrValidator(first.Get(), second.Get());
+  return SPEG::Primitives::Fuse(
+        new SPEG::Manipulators::OrValidator(first.Get(), second.Get()));
 }
 DLL_PUBLIC SPEG::Core::Rule operator ||(const SPEG::Core::Rule &first
             , const SPEG::Core::Rule &second) {
@@ -559,57 +5094,802 @@ DLL_PUBLIC Rule LookBack(const Rule &rule) {
   return new Manipulators::LookBackValidator(rule.Get());
 }
 
+DLL_PUBLIC Rule Compile(const Rule &rule) {
+  return rule.Compile();
+}
+
+DLL_PUBLIC bool Generate(const Rule &rule, const char* name
+        , string* source) {
+  return Engine::Generate(rule.Get(), name, source);
+}
+
+DLL_PUBLIC Rule Memoize(const Rule &rule) {
+  return new Manipulators::MemoValidator(rule.Get());
+}
+
+// collects the phrases of a choice in order of precedence
+static bool CollectPhrases(const Core::StringValidator* validator
+        , unsigned int depth
+        , vector<vector<SChar> >* phrases
+        , vector<unsigned int>* depths) {
+  switch (validator->Type()) {
+    case Core::VT_OR: {
+      const Core::NaryValidator* choice =
+            static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < choice->Count(); i++) {
+        if (!CollectPhrases(choice->GetOperand(i), depth + 1
+                  , phrases, depths))
+          return false;
+      }
+      return true;
+    }
+    case Core::VT_IS: {
+      SChar chr = static_cast<const Primitives::CharValidator*>(validator)
+                    ->Character();
+      if (!chr)
+        return false;
+      phrases->push_back(vector<SChar>(1, chr));
+      depths->push_back(depth);
+      return true;
+    }
+    case Core::VT_EXACT: {
+      const vector<SChar>& phrase =
+            static_cast<const Primitives::PhraseValidator*>(validator)
+              ->Phrase();
+      for (size_t i = 0; i < phrase.size(); i++) {
+        if (!phrase[i])
+          return false;
+      }
+      phrases->push_back(phrase);
+      depths->push_back(depth);
+      return true;
+    }
+    case Core::VT_TRIE: {
+      const Primitives::TrieValidator* trie =
+            static_cast<const Primitives::TrieValidator*>(validator);
+      for (size_t i = 0; i < trie->Phrases().size(); i++) {
+        phrases->push_back(trie->Phrases()[i]);
+        depths->push_back(depth + trie->Depths()[i]);
+      }
+      return true;
+    }
+    case Core::VT_PROGRAM:
+      return CollectPhrases(static_cast<const Engine::ProgramValidator*>(
+            validator)->Root(), depth, phrases, depths);
+    case Core::VT_AUTOMATON:
+      return CollectPhrases(static_cast<const Engine::AutomatonValidator*>(
+            validator)->Root(), depth, phrases, depths);
+    default:
+      return false;
+  }
+}
+
+DLL_PUBLIC Rule Literals(const Rule &choice) {
+  vector<vector<SChar> > phrases;
+  vector<unsigned int> depths;
+  if (choice.Get()->Type() != Core::VT_OR
+      || !CollectPhrases(choice.Get(), 0, &phrases, &depths))
+    return choice;
+  return new Primitives::TrieValidator(phrases, depths);
+}
+
+// the Unicode loose matching of property names, the case, spaces, '-' and
+// '_' are ignored
+static bool SameName(const char* name, const char* other) {
+  for (;;) {
+    while (*name == ' ' || *name == '-' || *name == '_')
+      name++;
+    while (*other == ' ' || *other == '-' || *other == '_')
+      other++;
+    if (Utils::CharToLower(static_cast<unsigned char>(*name))
+        != Utils::CharToLower(static_cast<unsigned char>(*other)))
+      return false;
+    if (!*name)
+      return true;
+    name++;
+    other++;
+  }
+}
+
+// the groups of the general categories and their long names, a group 
+// holds the categories whose short names start with its letter
+static const char* const CategoryGroups[][2] = {
+  {"L", "Letter"}, {"LC", "Cased_Letter"}, {"M", "Mark"}, {"N", "Number"}
+  , {"P", "Punctuation"}, {"S", "Symbol"}, {"Z", "Separator"}
+  , {"C", "Other"}
+};
+
+DLL_PUBLIC Rule Category(const char* name) {
+  ADJUST_NULL_STR(name);
+  const size_t count = sizeof(Utils::Categories) / sizeof(Utils::Property);
+  Utils::CharClass chars;
+  for (size_t i = 0; i < count; i++) {
+    const Utils::Property& category = Utils::Categories[i];
+    if (SameName(name, category.Name) || SameName(name, category.Alias))
+      return new Primitives::PropertyValidator(Utils::Characters(category));
+  }
+  for (size_t i = 0; i < sizeof(CategoryGroups) / sizeof(CategoryGroups[0])
+        ; i++) {
+    const char* group = CategoryGroups[i][0];
+    if (!SameName(name, group) && !SameName(name, CategoryGroups[i][1]))
+      continue;
+    for (size_t j = 0; j < count; j++) {
+      const char* category = Utils::Categories[j].Name;
+      // LC is Lu, Ll and Lt
+      if (category[0] == group[0] && (!group[1]
+          || category[1] == 'u' || category[1] == 'l' || category[1] == 't'))
+        chars.Unite(Utils::Characters(Utils::Categories[j]));
+    }
+    break;
+  }
+  return new Primitives::PropertyValidator(chars);
+}
+
+DLL_PUBLIC Rule Script(const char* name) {
+  ADJUST_NULL_STR(name);
+  for (size_t i = 0; i < sizeof(Utils::Scripts) / sizeof(Utils::Property)
+        ; i++) {
+    const Utils::Property& script = Utils::Scripts[i];
+    if (SameName(name, script.Name) || SameName(name, script.Alias))
+      return new Primitives::PropertyValidator(Utils::Characters(script));
+  }
+  return new Primitives::PropertyValidator(Utils::CharClass());
+}
+
+// the state of an Optimize() or Share() pass, a node shared by several
+// parents is rewritten once and structurally identical nodes are merged
+struct Rewriter {
+  bool Rewrites;
+  bool Determinizes;
+  unsigned long Flags;
+  vector<string>* Report;
+  map<const Core::StringValidator*, Rule> Done;
+  map<string, Rule> Shared;
+};
+
+static void Note(Rewriter* rewriter, const string& from, const string& to) {
+  if (rewriter->Report)
+    rewriter->Report->push_back(from + " -> " + to);
+}
+
+static string Iterations(unsigned int count) {
+  if (count == static_cast<unsigned int>(-1))
+    return "inf";
+  char text[16];
+  sprintf(text, "%u", count);
+  return text;
+}
+
+static string Describe(const Core::StringValidator* validator) {
+  string text;
+  if (validator->Type() == Core::VT_IS) {
+    Utils::UTF32ToUTF8(static_cast<const Primitives::CharValidator*>(
+          validator)->Character(), text);
+    return "Is('" + text + "')";
+  }
+  const vector<SChar>& phrase =
+        static_cast<const Primitives::PhraseValidator*>(validator)->Phrase();
+  for (size_t i = 0; i < phrase.size(); i++)
+    Utils::UTF32ToUTF8(phrase[i], text);
+  return "Is(\"" + text + "\")";
+}
+
+// whether the validator is a plain phrase of characters, Is('\0') matches
+// the end of text without moving so it can not be part of a phrase
+static bool IsPhrase(const Core::StringValidator* validator) {
+  if (validator->Type() == Core::VT_IS)
+    return static_cast<const Primitives::CharValidator*>(validator)
+          ->Character() != 0;
+  if (validator->Type() != Core::VT_EXACT)
+    return false;
+  const vector<SChar>& phrase =
+        static_cast<const Primitives::PhraseValidator*>(validator)->Phrase();
+  for (size_t i = 0; i < phrase.size(); i++) {
+    if (!phrase[i])
+      return false;
+  }
+  return true;
+}
+
+static Rule Simplify(Core::StringValidator* validator, Rewriter* rewriter);
+
+template <typename __T>
+static void Append(string* key, const __T& value) {
+  key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void Append(string* key, const vector<SChar>& chars) {
+  Append(key, chars.size());
+  for (size_t i = 0; i < chars.size(); i++)
+    Append(key, chars[i]);
+}
+
+static void Append(string* key, const Utils::CharClass& set) {
+  key->append(reinterpret_cast<const char*>(set.Bits), sizeof(set.Bits));
+  Append(key, set.Ranges.size());
+  for (size_t i = 0; i < set.Ranges.size(); i++) {
+    Append(key, set.Ranges[i].first);
+    Append(key, set.Ranges[i].second);
+  }
+}
+
+// the structure of a node whose operands are already shared, so equal 
+// keys mean equal subtrees. Empty for the nodes that are never merged
+// (references, variables, compiled programs and custom validators)
+static string Key(const Core::StringValidator* validator) {
+  string key;
+  Append(&key, validator->Type());
+  switch (validator->Type()) {
+    case Core::VT_IS:
+      Append(&key, static_cast<const Primitives::CharValidator*>(validator)
+            ->Character());
+      return key;
+    case Core::VT_IN:
+      Append(&key, static_cast<const Primitives::CharSetValidator*>(
+            validator)->Characters());
+      return key;
+    case Core::VT_BETWEEN: {
+      const Primitives::CharRangeValidator* range =
+            static_cast<const Primitives::CharRangeValidator*>(validator);
+      Append(&key, range->Min());
+      Append(&key, range->Max());
+      return key;
+    }
+    case Core::VT_EXACT:
+      Append(&key, static_cast<const Primitives::PhraseValidator*>(
+            validator)->Phrase());
+      return key;
+    case Core::VT_ANY:
+    case Core::VT_BOT:
+    case Core::VT_INCHAIN:
+    case Core::VT_COMMIT:
+      return key;
+    case Core::VT_TRIE: {
+      const Primitives::TrieValidator* trie =
+            static_cast<const Primitives::TrieValidator*>(validator);
+      for (size_t i = 0; i < trie->Phrases().size(); i++) {
+        Append(&key, trie->Phrases()[i]);
+        Append(&key, trie->Depths()[i]);
+      }
+      return key;
+    }
+    case Core::VT_CLASS: {
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(validator);
+      Append(&key, fused->Sensitive());
+      Append(&key, fused->Folded());
+      Append(&key, fused->Tree());
+      return key;
+    }
+    case Core::VT_PROPERTY:
+      // the folded class follows from the sensitive one
+      Append(&key, static_cast<const Primitives::PropertyValidator*>(
+            validator)->Sensitive());
+      return key;
+    case Core::VT_CASE:
+      Append(&key, static_cast<const StateKeepers::CaseModifier*>(
+            validator)->Value());
+      return key;
+    case Core::VT_REPEAT: {
+      const Manipulators::RepeatValidator* repeat =
+            static_cast<const Manipulators::RepeatValidator*>(validator);
+      Append(&key, repeat->GetOperand());
+      Append(&key, repeat->MinIterations());
+      Append(&key, repeat->MaxIterations());
+      return key;
+    }
+    case Core::VT_EXTRACT:
+      Append(&key, static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand());
+      key += static_cast<const Manipulators::ExtractValidator*>(validator)
+            ->Key();
+      return key;
+    case Core::VT_CALLBACK: {
+      const Manipulators::CallBackValidator* callback =
+            static_cast<const Manipulators::CallBackValidator*>(validator);
+      Append(&key, callback->GetOperand());
+      Append(&key, callback->Function());
+      Append(&key, callback->CallBackContext());
+      return key;
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_MEMO:
+      Append(&key, static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand());
+      return key;
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      Append(&key, binary->GetFirstOperand());
+      Append(&key, binary->GetSecondOperand());
+      return key;
+    }
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      Append(&key, static_cast<unsigned int>(nary->Count()));
+      for (size_t i = 0; i < nary->Count(); i++)
+        Append(&key, nary->GetOperand(i));
+      return key;
+    }
+    default:
+      return string();
+  }
+}
+
+static Rule Intern(const Rule& rule, Rewriter* rewriter) {
+  string key = Key(rule.Get());
+  if (key.empty())
+    return rule;
+  map<string, Rule>::iterator found = rewriter->Shared.find(key);
+  if (found != rewriter->Shared.end())
+    return found->second;
+  rewriter->Shared.insert(make_pair(key, rule));
+  return rule;
+}
+
+static void Flatten(Core::StringValidator* validator, Rewriter* rewriter
+        , vector<Rule>* items, bool* changed) {
+  if (validator->Type() == Core::VT_SEQ) {
+    const Core::NaryValidator* seq =
+          static_cast<const Core::NaryValidator*>(validator);
+    for (size_t i = 0; i < seq->Count(); i++)
+      Flatten(seq->GetOperand(i), rewriter, items, changed);
+    return;
+  }
+  items->push_back(Simplify(validator, rewriter));
+  if (items->back().Get() != validator)
+    *changed = true;
+}
+
+static Rule SimplifySeq(Core::StringValidator* validator
+        , Rewriter* rewriter) {
+  vector<Rule> items;
+  bool changed = false;
+  Flatten(validator, rewriter, &items, &changed);
+
+  // each character skips the spaces before it under SPEG_IGNORESPACES, 
+  // a phrase only skips the spaces before its first character
+  vector<Rule> merged;
+  for (size_t i = 0; i < items.size(); i++) {
+    size_t end = i;
+    while (!(rewriter->Flags & SPEG_IGNORESPACES) && end < items.size()
+          && IsPhrase(items[end].Get()))
+      end++;
+    if (end - i < 2) {
+      merged.push_back(items[i]);
+      continue;
+    }
+
+    vector<SChar> phrase;
+    string from;
+    for (size_t j = i; j < end; j++) {
+      const Core::StringValidator* item = items[j].Get();
+      if (item->Type() == Core::VT_IS) {
+        phrase.push_back(static_cast<const Primitives::CharValidator*>(item)
+              ->Character());
+      } else {
+        const vector<SChar>& part =
+              static_cast<const Primitives::PhraseValidator*>(item)->Phrase();
+        phrase.insert(phrase.end(), part.begin(), part.end());
+      }
+      from += (j > i ? " > " : "") + Describe(item);
+    }
+    merged.push_back(new Primitives::PhraseValidator(phrase));
+    Note(rewriter, from, Describe(merged.back().Get()));
+    changed = true;
+    i = end - 1;
+  }
+
+  // the sequence is rebuilt even if unchanged, so it is shared too
+  if (merged.size() == 1)
+    return merged[0];
+  vector<Core::StringValidator*> operands;
+  for (size_t i = 0; i < merged.size(); i++)
+    operands.push_back(merged[i].Get());
+  return Intern(new Manipulators::SeqValidator(operands), rewriter);
+}
+
+static Rule SimplifyRepeat(Core::StringValidator* validator
+        , Rewriter* rewriter) {
+  const Manipulators::RepeatValidator* repeat =
+        static_cast<const Manipulators::RepeatValidator*>(validator);
+  const unsigned int infinite = static_cast<unsigned int>(-1);
+  unsigned int min = repeat->MinIterations();
+  unsigned int max = repeat->MaxIterations();
+  Rule operand = Simplify(repeat->GetOperand(), rewriter);
+
+  if (rewriter->Rewrites && operand.Get()->Type() == Core::VT_REPEAT) {
+    const Manipulators::RepeatValidator* inner =
+          static_cast<const Manipulators::RepeatValidator*>(operand.Get());
+    unsigned int innerMin = inner->MinIterations();
+    unsigned int innerMax = inner->MaxIterations();
+    string from = "Repeat(Repeat(x, " + Iterations(innerMin) + ", "
+          + Iterations(innerMax) + "), " + Iterations(min) + ", "
+          + Iterations(max) + ")";
+    bool folded = true;
+    if (innerMin == 0) {
+      // the inner repetition never fails, so the outer one just keeps 
+      // consuming where the inner one stopped
+      if (innerMax && max > infinite / innerMax)
+        max = infinite;
+      else
+        max = max * innerMax;
+      min = 0;
+    } else if (innerMin == innerMax && min == max && innerMax != infinite
+          && max != infinite && (!innerMax || max <= infinite / innerMax)) {
+      min = max = min * innerMax;
+    } else if (innerMin == 1 && innerMax == infinite && min <= 1 && max) {
+      // the inner repetition consumes the whole run, the next one fails
+      max = infinite;
+    } else {
+      folded = false;
+    }
+
+    if (folded) {
+      Rule rule = new Manipulators::RepeatValidator(inner->GetOperand()
+            , min, max);
+      Note(rewriter, from, "Repeat(x, " + Iterations(min) + ", "
+            + Iterations(max) + ")");
+      return rule;
+    }
+  }
+
+  if (rewriter->Rewrites && min == 1 && max == 1) {
+    Note(rewriter, "Repeat(x, 1, 1)", "x");
+    return operand;
+  }
+  if (operand.Get() == repeat->GetOperand())
+    return validator;
+  return new Manipulators::RepeatValidator(operand.Get(), min, max);
+}
+
+static Rule SimplifyLook(Core::StringValidator* validator
+        , Rewriter* rewriter) {
+  Core::StringValidator* operand =
+        static_cast<const Core::UnaryValidator*>(validator)->GetOperand();
+  bool negate = validator->Type() == Core::VT_NOT;
+  const char* name = negate ? "Not" : "LookAhead";
+  Rule inner = Simplify(operand, rewriter);
+
+  // both restore the position, only the outcome is negated or not
+  Core::ValidatorType type = inner.Get()->Type();
+  if (rewriter->Rewrites
+      && (type == Core::VT_NOT || type == Core::VT_LOOKAHEAD)) {
+    Rule rule = static_cast<const Core::UnaryValidator*>(inner.Get())
+          ->GetOperand();
+    bool innerNegate = type == Core::VT_NOT;
+    Note(rewriter, string(name) + (innerNegate ? "(Not(x))" : "(LookAhead(x))")
+          , (negate != innerNegate) ? "Not(x)" : "LookAhead(x)");
+    if (negate != innerNegate)
+      return Intern(Not(rule), rewriter);
+    return Intern(LookAhead(rule), rewriter);
+  }
+
+  if (inner.Get() == operand)
+    return validator;
+  return negate ? Not(inner) : LookAhead(inner);
+}
+
+static Rule Rewrite(Core::StringValidator* validator, Rewriter* rewriter) {
+  switch (validator->Type()) {
+    case Core::VT_REPEAT:
+      return SimplifyRepeat(validator, rewriter);
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+      return SimplifyLook(validator, rewriter);
+    case Core::VT_CLASS: {
+      const Primitives::CharClassValidator* fused =
+            static_cast<const Primitives::CharClassValidator*>(validator);
+      Rule tree = Simplify(fused->Tree(), rewriter);
+      if (tree.Get() == fused->Tree())
+        return validator;
+      return new Primitives::CharClassValidator(fused->Sensitive()
+            , fused->Folded(), tree.Get());
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      Rule first = Simplify(binary->GetFirstOperand(), rewriter);
+      Rule second = Simplify(binary->GetSecondOperand(), rewriter);
+      if (first.Get() == binary->GetFirstOperand()
+          && second.Get() == binary->GetSecondOperand())
+        return validator;
+      return new Manipulators::AndValidator(first.Get(), second.Get());
+    }
+    case Core::VT_SEQ:
+      if (rewriter->Rewrites)
+        return SimplifySeq(validator, rewriter);
+      // fall through
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      vector<Rule> simplified;
+      vector<Core::StringValidator*> operands;
+      bool changed = false;
+      for (size_t i = 0; i < nary->Count(); i++) {
+        simplified.push_back(Simplify(nary->GetOperand(i), rewriter));
+        operands.push_back(simplified.back().Get());
+        changed = changed || operands.back() != nary->GetOperand(i);
+      }
+      if (!changed
+          && (validator->Type() != Core::VT_OR || !rewriter->Rewrites))
+        return validator;
+      if (validator->Type() == Core::VT_SEQ)
+        return new Manipulators::SeqValidator(operands);
+      if (validator->Type() == Core::VT_GREEDYOR)
+        return new Manipulators::GreedyOrValidator(operands);
+
+      Rule choice = validator;
+      if (changed)
+        choice = new Manipulators::OrValidator(operands);
+      if (!rewriter->Rewrites)
+        return choice;
+      Rule trie = Literals(choice);
+      if (trie.Get() != choice.Get())
+        Note(rewriter, "Or(phrases)", "Literals(phrases)");
+      return trie;
+    }
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_MEMO: {
+      Core::StringValidator* operand =
+            static_cast<const Core::UnaryValidator*>(validator)->GetOperand();
+      Rule inner = Simplify(operand, rewriter);
+      if (inner.Get() == operand)
+        return validator;
+
+      switch (validator->Type()) {
+        case Core::VT_LOOKBACK:
+          return LookBack(inner);
+        case Core::VT_UNTIL:
+          return Until(inner);
+        case Core::VT_EXTRACT:
+          return new Manipulators::ExtractValidator(inner.Get()
+                , static_cast<const Manipulators::ExtractValidator*>(
+                    validator)->Key());
+        case Core::VT_CALLBACK: {
+          const Manipulators::CallBackValidator* callback =
+                static_cast<const Manipulators::CallBackValidator*>(validator);
+          return new Manipulators::CallBackValidator(inner.Get()
+                , callback->Function(), callback->CallBackContext());
+        }
+        default:
+          return Memoize(inner);
+      }
+    }
+    case Core::VT_PROGRAM: {
+      Core::StringValidator* root =
+            static_cast<const Engine::ProgramValidator*>(validator)->Root();
+      Rule inner = Simplify(root, rewriter);
+      if (inner.Get() == root)
+        return validator;
+      return inner.Compile();
+    }
+    case Core::VT_AUTOMATON: {
+      Core::StringValidator* root =
+            static_cast<const Engine::AutomatonValidator*>(validator)
+              ->Root();
+      if (rewriter->Determinizes)
+        return validator;
+      Rule inner = Simplify(root, rewriter);
+      if (inner.Get() == root)
+        return validator;
+      return new Engine::AutomatonValidator(inner.Get());
+    }
+    default:
+      // references are left alone, their targets may still be injected
+      return validator;
+  }
+}
+
+// whether the tree has choices, sequences or repetitions the tree parser
+// would backtrack over, a repeated character class is a single span
+static bool Backtracks(const Core::StringValidator* validator) {
+  switch (validator->Type()) {
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_UNTIL:
+      return true;
+    case Core::VT_REPEAT: {
+      Utils::CharClass sensitive;
+      Utils::CharClass folded;
+      return !Primitives::Classify(static_cast<const Core::UnaryValidator*>(
+            validator)->GetOperand(), &sensitive, &folded);
+    }
+    case Core::VT_AND: {
+      const Core::BinaryValidator* binary =
+            static_cast<const Core::BinaryValidator*>(validator);
+      return Backtracks(binary->GetFirstOperand())
+            || Backtracks(binary->GetSecondOperand());
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_EXTRACT:
+    case Core::VT_MEMO:
+      return Backtracks(static_cast<const Core::UnaryValidator*>(validator)
+            ->GetOperand());
+    case Core::VT_PROGRAM:
+      return Backtracks(static_cast<const Engine::ProgramValidator*>(
+            validator)->Root());
+    default:
+      return false;
+  }
+}
+
+static Rule Simplify(Core::StringValidator* validator, Rewriter* rewriter) {
+  map<const Core::StringValidator*, Rule>::iterator found =
+        rewriter->Done.find(validator);
+  if (found != rewriter->Done.end())
+    return found->second;
+
+  Rule rule = validator;
+  if (rewriter->Determinizes && Backtracks(validator)
+      && Engine::AutomatonValidator::Regular(validator))
+    rule = new Engine::AutomatonValidator(validator);
+  else
+    rule = Intern(Rewrite(validator, rewriter), rewriter);
+  rewriter->Done.insert(make_pair(validator, rule));
+  return rule;
+}
+
+DLL_PUBLIC Rule Optimize(const Rule& rule, unsigned long flags
+        , vector<string>* report) {
+  Rewriter rewriter;
+  // the removed nodes would have added unnamed matches
+  rewriter.Rewrites = !(flags & SPEG_MATCHUNNAMED);
+  rewriter.Determinizes = false;
+  rewriter.Flags = flags;
+  rewriter.Report = report;
+  return Simplify(rule.Get(), &rewriter);
+}
+
+DLL_PUBLIC Rule Share(const Rule& rule) {
+  Rewriter rewriter;
+  rewriter.Rewrites = false;
+  rewriter.Determinizes = false;
+  rewriter.Flags = 0;
+  rewriter.Report = NULL;
+  return Simplify(rule.Get(), &rewriter);
+}
+
+DLL_PUBLIC Rule Determinize(const Rule& rule) {
+  Rewriter rewriter;
+  rewriter.Rewrites = false;
+  rewriter.Determinizes = true;
+  rewriter.Flags = 0;
+  rewriter.Report = NULL;
+  return Simplify(rule.Get(), &rewriter);
+}
+
 DLL_PUBLIC const Rule Any() 
 { 
 	static Rule rule = new Primitives::AnyValidator();
 	return rule;
 }
 
-DLL_PUBLIC const Rule Digit() { return Between("09"); }
+DLL_PUBLIC const Rule Digit() {
+  static Rule rule = Share(Between("09"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule SmallAlphabet() { return  Between("az"); }
+DLL_PUBLIC const Rule SmallAlphabet() {
+  static Rule rule = Share(Between("az"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule CapitalAlphabet() { return  Between("AZ"); }
+DLL_PUBLIC const Rule CapitalAlphabet() {
+  static Rule rule = Share(Between("AZ"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule Alphabet() { return CapitalAlphabet() | SmallAlphabet(); }
+DLL_PUBLIC const Rule Alphabet() {
+  static Rule rule = Share(CapitalAlphabet() | SmallAlphabet());
+  return rule;
+}
 
-DLL_PUBLIC const Rule Alphanumeric() { return Digit() | Alphabet(); }
+DLL_PUBLIC const Rule Alphanumeric() {
+  static Rule rule = Share(Digit() | Alphabet());
+  return rule;
+}
 
-DLL_PUBLIC const Rule End() { return Is('\0'); }
+DLL_PUBLIC const Rule End() {
+  static Rule rule = Share(Is('\0'));
+  return rule;
+}
 
 DLL_PUBLIC const Rule Beginning() { 
 	static Rule rule = new Primitives::BOTValidator();
 	return rule;
 }
 
-DLL_PUBLIC const Rule Symbol() { return Any() & !Alphanumeric(); }
+DLL_PUBLIC const Rule Commit() {
+  static Rule rule = new Primitives::CommitValidator();
+  return rule;
+}
+
+DLL_PUBLIC const Rule Symbol() {
+  static Rule rule = Share(Any() & !Alphanumeric());
+  return rule;
+}
+
+DLL_PUBLIC const Rule Hex() {
+  static Rule rule = Share(Digit() | Between("af") | Between("AF"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule Hex() { return Digit() | Between("af") | Between("AF"); }
+DLL_PUBLIC const Rule Octet() {
+  static Rule rule = Share(Between("07"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule Octet() { return Between("07"); }
+DLL_PUBLIC const Rule EndOfLine() {
+  static Rule rule = Share(Is("\r\n") | In("\n\r"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule EndOfLine() { return Is("\r\n") | In("\n\r"); }
+DLL_PUBLIC const Rule BeginningOfLine() {
+  static Rule rule = Share(Beginning() | LookBack(EndOfLine()));
+  return rule;
+}
 
-DLL_PUBLIC const Rule BeginningOfLine() { return Beginning() | LookBack(EndOfLine()); }
+DLL_PUBLIC const Rule WhiteSpace() {
+  static Rule rule = Share(In(" \t\r\n"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule WhiteSpace() { return In(" \t\r\n"); }
+DLL_PUBLIC const Rule UnicodeWhiteSpace() {
+  static Rule rule = Share(new Primitives::PropertyValidator(
+        Utils::Characters(Utils::WhiteSpaceProperty)));
+  return rule;
+}
 
-DLL_PUBLIC const Rule WhiteSpaces() { return +WhiteSpace(); }
+DLL_PUBLIC const Rule WhiteSpaces() {
+  static Rule rule = Share(+WhiteSpace());
+  return rule;
+}
 
-DLL_PUBLIC const Rule Binary() { return In("01"); }
+DLL_PUBLIC const Rule Binary() {
+  static Rule rule = Share(In("01"));
+  return rule;
+}
 
-DLL_PUBLIC const Rule WordEnd() { return LookAhead(!Alphanumeric()); }
+DLL_PUBLIC const Rule WordEnd() {
+  static Rule rule = Share(LookAhead(!Alphanumeric()));
+  return rule;
+}
 
-DLL_PUBLIC const Rule WordStart() { return LookBack(!Alphanumeric()); }
+DLL_PUBLIC const Rule WordStart() {
+  static Rule rule = Share(LookBack(!Alphanumeric()));
+  return rule;
+}
 
-DLL_PUBLIC const Rule Natural() { return +Digit(); }
+DLL_PUBLIC const Rule Natural() {
+  static Rule rule = Share(+Digit());
+  return rule;
+}
 
-DLL_PUBLIC const Rule Integer() { return  ~In("+-") > Natural(); }
+DLL_PUBLIC const Rule Integer() {
+  static Rule rule = Share(~In("+-") > Natural());
+  return rule;
+}
 
-DLL_PUBLIC const Rule Rational() { return Integer() > ~(Is('.') > Natural()); }
+DLL_PUBLIC const Rule Rational() {
+  static Rule rule = Share(Integer() > ~(Is('.') > Natural()));
+  return rule;
+}
 
 DLL_PUBLIC const Rule Scientific() {
-	return Rational() > ~(In("Ee") > In("+-") > Natural());
+	static Rule rule = Share(Rational() > ~(In("Ee") > In("+-") > Natural()));
+	return rule;
 }
 
 DLL_PUBLIC const Rule InChain() { 
@@ -618,8 +5898,7 @@ DLL_PUBLIC const Rule InChain() {
 }
 
 
-DLL_PUBLIC const Rule IPv4() {
-
+static Rule BuildIPv4() {
 	const Rule DecOctet = (Is("25") > Between("05")) |
 		(Is('2') > Between("04") > Digit()) |
 		(Is('1') > (2 * Digit())) |
@@ -629,9 +5908,14 @@ DLL_PUBLIC const Rule IPv4() {
 	return DecOctet > ((Is('.') > DecOctet) * 3);
 }
 
+DLL_PUBLIC const Rule IPv4() {
+	static Rule rule = Share(BuildIPv4());
+	return rule;
+}
 
 
-DLL_PUBLIC const Rule IPv6() {
+
+static Rule BuildIPv6() {
 	const Rule h16 = Utils::Range(1, 4) * Hex();
 
 	const Rule COLON = Is(':');
@@ -653,15 +5937,21 @@ DLL_PUBLIC const Rule IPv6() {
 		|| (~((6 * (h16Colon)) > h16) > DBLCOLON);
 }
 
+DLL_PUBLIC const Rule IPv6() {
+	static Rule rule = Share(BuildIPv6());
+	return rule;
+}
+
 
 
 
 DLL_PUBLIC const Rule Host() {
-	return (+((Is('%') > Hex() > Hex())
+	static Rule rule = Share((+((Is('%') > Hex() > Hex())
 		| Alphanumeric()
 		| In("-_.~!$&'()*+,;=")))
 		|| IPv4()
-		|| IPv6();
+		|| IPv6());
+	return rule;
 }
 
 
@@ -674,6 +5964,16 @@ DLL_PUBLIC Rule SkipTo(const unsigned long count) {
 }
 
 DLL_PUBLIC Rule Until(const Rule &rule) {
+  // the search runs through the automaton too, it reads the text once
+  if (rule.Get()->Type() == Core::VT_AUTOMATON)
+    return new Engine::AutomatonValidator(new Manipulators::UntilValidator(
+          static_cast<const Engine::AutomatonValidator*>(rule.Get())
+            ->Root()));
+  // and through the program, with no virtual call per position
+  if (rule.Get()->Type() == Core::VT_PROGRAM)
+    return new Engine::ProgramValidator(new Manipulators::UntilValidator(
+          static_cast<const Engine::ProgramValidator*>(rule.Get())
+            ->Root()));
   return new Manipulators::UntilValidator(rule.Get());
 }
 
@@ -707,11 +6007,13 @@ DLL_PUBLIC Rule Enclosed(const Rule &rule, const char *open
 }
 
 DLL_PUBLIC const Rule CaseSensitive() {
-	return new StateKeepers::CaseModifier(false);
+	static Rule rule = new StateKeepers::CaseModifier(false);
+	return rule;
 }
 
 DLL_PUBLIC const Rule CaseInsensitive() {
-	return new StateKeepers::CaseModifier(true);
+	static Rule rule = new StateKeepers::CaseModifier(true);
+	return rule;
 }
 
 DLL_PUBLIC Rule Set(const char *flag) {
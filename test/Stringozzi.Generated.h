@@ -0,0 +1,4058 @@
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDREQUESTLINE_H_
+#define STRINGOZZI_GENERATED_GENERATEDREQUESTLINE_H_
+#include "Stringozzi.h"
+
+namespace GeneratedRequestLine {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node16(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node17(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node4(context))
+      && (context->AdjustPosition(), Node5(context))
+      && (context->AdjustPosition(), Node12(context))
+      && (context->AdjustPosition(), Node13(context))
+      && (context->AdjustPosition(), Node14(context))
+      && (context->AdjustPosition(), Node16(context))
+      && (context->AdjustPosition(), Node14(context))
+      && (context->AdjustPosition(), Node17(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'A', 'Z'} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 1);
+  static const SPEG::SChar foldedRanges[][2] = { {'A', 'Z'}, {'a', 'z'}, {0x17FUL, 0x17FUL}, {0x212AUL, 0x212AUL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 4);
+  Position start = context->GetPosition();
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES) && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    size_t count = context->Span(
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive, 4294967295U);
+    if (count < 1U) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < 4294967295U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node2(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node3(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z') || chr == 0x17FUL || chr == 0x212AUL) && context->Forward();
+  return ((chr >= 'A' && chr <= 'Z')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  bool fold = context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);
+  SPEG::SChar chr = context->Get();
+  if (chr < (fold ? 'a' : 'A')
+      || chr > (fold ? 'z' : 'Z')
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(" ", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {0x1UL, 0x9UL}, {0xBUL, 0xCUL}, {0xEUL, 0x1FUL}, {'!', 0xFFFFFFFFFFFFFFFFUL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 4);
+  static const SPEG::SChar foldedRanges[][2] = { {0x1UL, 0x9UL}, {0xBUL, 0xCUL}, {0xEUL, 0x1FUL}, {'!', 0xFFFFFFFFFFFFFFFFUL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 4);
+  Position start = context->GetPosition();
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES) && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    size_t count = context->Span(
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive, 4294967295U);
+    if (count < 1U) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < 4294967295U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node6(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node7(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 0x1UL && chr <= 0x9UL) || (chr >= 0xBUL && chr <= 0xCUL) || (chr >= 0xEUL && chr <= 0x1FUL) || chr >= '!') && context->Forward();
+  return ((chr >= 0x1UL && chr <= 0x9UL) || (chr >= 0xBUL && chr <= 0xCUL) || (chr >= 0xEUL && chr <= 0x1FUL) || chr >= '!') && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node8(context)) {
+    Position frst = context->GetPosition();
+    context->SetPosition(start);
+    if (Node9(context)) {
+      if (frst > context->GetPosition())
+        context->SetPosition(frst);
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node10(context)) {
+    context->SetPosition(start);
+    return false;
+  }
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node11(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return (chr == 0xAUL || chr == 0xDUL || chr == ' ') && context->Forward();
+  return (chr == 0xAUL || chr == 0xDUL || chr == ' ') && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr != ' '
+      && chr != 0xDUL
+      && chr != 0xAUL)
+    return false;
+  context->Forward();
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(" ", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("HTTP/", 5))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node15(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '9')) && context->Forward();
+  return ((chr >= '0' && chr <= '9')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < '0'
+      || chr > '9'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node16(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(".", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node17(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("\015\012", 2))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedRequestLine
+#endif  // STRINGOZZI_GENERATED_GENERATEDREQUESTLINE_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDHOST_H_
+#define STRINGOZZI_GENERATED_GENERATEDHOST_H_
+#include "Stringozzi.h"
+
+namespace GeneratedHost {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node16(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node17(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node18(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node19(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node20(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node21(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node22(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node23(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node24(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node25(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node26(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node27(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node28(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node29(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node30(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node31(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node32(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node33(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node34(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node35(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node36(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node37(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node38(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node39(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node40(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node41(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node42(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node43(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node44(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node45(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node46(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node47(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node48(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node49(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node50(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node51(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node52(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node53(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node54(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node55(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node56(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node57(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node58(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node59(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node60(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node61(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node62(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node63(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node64(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node65(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node66(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node67(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node68(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node69(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node70(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node71(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node72(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node73(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node74(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node75(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node76(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node77(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Evaluate0(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x1U, 0x0U, 0x0U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x0U,
+        0x7F7U, 0x7F7U, 0x7F7U, 0x7F7U, 0x7F7U, 0x7F7U, 0x7F7U, 0x7F7U,
+        0x7F7U, 0x7F7U, 0x7F8U, 0x1U, 0x0U, 0x1U, 0x0U, 0x0U,
+        0x0U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x0U, 0x0U, 0x0U, 0x0U, 0x1U,
+        0x0U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x7F5U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x1U, 0x0U, 0x0U, 0x0U, 0x1U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x1U;
+  }
+  bool success = false;
+  Position longest = start;
+
+  context->SetPosition(start);
+  if ((candidates & 0x1U) && Node1(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x2U) && Node25(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x4U) && Node44(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x8U) && Node51(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x10U) && Node54(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x20U) && Node57(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x40U) && Node62(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x80U) && Node66(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x100U) && Node69(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x200U) && Node72(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x400U) && Node75(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  if (!success)
+    return false;
+  context->SetPosition(longest);
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate0(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate0(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 4294967295U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node2(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate2(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x4U, 0x0U, 0x0U, 0x4U, 0x1U, 0x4U, 0x4U,
+        0x4U, 0x4U, 0x4U, 0x4U, 0x4U, 0x4U, 0x4U, 0x0U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x0U, 0x4U, 0x0U, 0x4U, 0x0U, 0x0U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x4U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x0U, 0x0U, 0x0U, 0x4U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x2U;
+  }
+  if (((candidates & 0x1U) && Node3(context))
+      || ((candidates & 0x2U) && Node15(context))
+      || ((candidates & 0x4U) && Node23(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate2(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate2(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node4(context)
+      && (context->AdjustPosition(), Node5(context))
+      && (context->AdjustPosition(), Node5(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("%", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node6(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+  return ((chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate6(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  if (((candidates & 0x1U) && Node7(context))
+      || ((candidates & 0x2U) && Node13(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate6(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate6(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node8(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+  return ((chr >= '0' && chr <= '9') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate8(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  if (((candidates & 0x1U) && Node9(context))
+      || ((candidates & 0x2U) && Node11(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate8(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate8(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node10(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '9')) && context->Forward();
+  return ((chr >= '0' && chr <= '9')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < '0'
+      || chr > '9'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node12(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+  return ((chr >= 'a' && chr <= 'f')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < 'a'
+      || chr > 'f'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node14(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f')) && context->Forward();
+  return ((chr >= 'A' && chr <= 'F')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  bool fold = context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);
+  SPEG::SChar chr = context->Get();
+  if (chr < (fold ? 'a' : 'A')
+      || chr > (fold ? 'f' : 'F')
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context) {
+  static const unsigned char folded[32] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+        0xFE, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0x07,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node16(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr < 256 ? ((folded[chr >> 3] >> (chr & 7)) & 1) != 0 : (chr == 0x17FUL || chr == 0x212AUL))) && context->Forward();
+  return ((chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate16(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U,
+        0x1U, 0x1U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x2U;
+  }
+  if (((candidates & 0x1U) && Node9(context))
+      || ((candidates & 0x2U) && Node17(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node16(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate16(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate16(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node17(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node18(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z') || chr == 0x17FUL || chr == 0x212AUL) && context->Forward();
+  return ((chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate18(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x3U;
+  }
+  if (((candidates & 0x1U) && Node19(context))
+      || ((candidates & 0x2U) && Node21(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node18(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate18(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate18(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node19(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node20(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z') || chr == 0x17FUL || chr == 0x212AUL) && context->Forward();
+  return ((chr >= 'A' && chr <= 'Z')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node20(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  bool fold = context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE);
+  SPEG::SChar chr = context->Get();
+  if (chr < (fold ? 'a' : 'A')
+      || chr > (fold ? 'z' : 'Z')
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node21(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node22(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z') || chr == 0x17FUL || chr == 0x212AUL) && context->Forward();
+  return ((chr >= 'a' && chr <= 'z')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node22(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < 'a'
+      || chr > 'z'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node23(__CONTEXT* context) {
+  static const unsigned char sensitive[32] = {
+        0x00, 0x00, 0x00, 0x00, 0xD2, 0x7F, 0x00, 0x28,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  static const unsigned char folded[32] = {
+        0x00, 0x00, 0x00, 0x00, 0xD2, 0x7F, 0x00, 0x28,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node24(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr < 256 ? ((folded[chr >> 3] >> (chr & 7)) & 1) != 0 : (false))) && context->Forward();
+  return ((chr < 256 ? ((sensitive[chr >> 3] >> (chr & 7)) & 1) != 0 : (false))) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node24(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr != '-'
+      && chr != '_'
+      && chr != '.'
+      && chr != '~'
+      && chr != '!'
+      && chr != '$'
+      && chr != '&'
+      && chr != 0x27UL
+      && chr != '('
+      && chr != ')'
+      && chr != '*'
+      && chr != '+'
+      && chr != ','
+      && chr != ';'
+      && chr != '=')
+    return false;
+  context->Forward();
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node25(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node26(context)
+      && (context->AdjustPosition(), Node41(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate26(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x10U, 0x1CU, 0x1BU, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U,
+        0x18U, 0x18U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  if (((candidates & 0x1U) && Node27(context))
+      || ((candidates & 0x2U) && Node31(context))
+      || ((candidates & 0x4U) && Node35(context))
+      || ((candidates & 0x8U) && Node38(context))
+      || ((candidates & 0x10U) && Node9(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node26(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate26(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate26(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node27(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node28(context)
+      && (context->AdjustPosition(), Node29(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node28(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("25", 2))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node29(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node30(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '5')) && context->Forward();
+  return ((chr >= '0' && chr <= '5')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node30(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < '0'
+      || chr > '5'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node31(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node32(context)
+      && (context->AdjustPosition(), Node33(context))
+      && (context->AdjustPosition(), Node9(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node32(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("2", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node33(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node34(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '0' && chr <= '4')) && context->Forward();
+  return ((chr >= '0' && chr <= '4')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node34(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < '0'
+      || chr > '4'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node35(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node36(context)
+      && (context->AdjustPosition(), Node37(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node36(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("1", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node37(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'0', '9'} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 1);
+  static const SPEG::SChar foldedRanges[][2] = { {'0', '9'} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 1);
+  Position start = context->GetPosition();
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES) && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    size_t count = context->Span(
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive, 2U);
+    if (count < 2U) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < 2U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node9(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 2U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node38(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node39(context)
+      && (context->AdjustPosition(), Node9(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node39(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node40(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '1' && chr <= '9')) && context->Forward();
+  return ((chr >= '1' && chr <= '9')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node40(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr < '1'
+      || chr > '9'
+      || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node41(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 3U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node42(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 3U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node42(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node43(context)
+      && (context->AdjustPosition(), Node26(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node43(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(".", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node44(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node45(context)
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node45(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 6U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 6U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node46(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node47(context)
+      && (context->AdjustPosition(), Node48(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node47(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'0', '9'}, {'A', 'F'}, {'a', 'f'} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 3);
+  static const SPEG::SChar foldedRanges[][2] = { {'0', '9'}, {'A', 'F'}, {'a', 'f'} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 3);
+  Position start = context->GetPosition();
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES) && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    size_t count = context->Span(
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive, 4U);
+    if (count < 1U) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < 4U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node5(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node48(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(":", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate49(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  if (((candidates & 0x1U) && Node50(context))
+      || ((candidates & 0x2U) && Node25(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node49(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate49(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate49(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node50(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node47(context)
+      && (context->AdjustPosition(), Node48(context))
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node51(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node52(context)
+      && (context->AdjustPosition(), Node53(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node52(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("::", 2))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node53(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 5U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 5U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node54(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node55(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node56(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node55(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node47(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node56(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 4U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 4U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node57(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node58(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node61(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node58(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node59(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node59(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node60(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node60(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node61(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 3U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 3U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node62(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node63(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node65(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node63(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node64(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node64(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node65(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node65(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 2U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node46(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 2U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node66(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node67(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node60(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node67(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node68(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node68(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node61(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node69(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node70(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node49(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node70(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node71(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node71(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node56(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node72(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node73(context)
+      && (context->AdjustPosition(), Node52(context))
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node73(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node74(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node74(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node53(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node75(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node76(context)
+      && (context->AdjustPosition(), Node52(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node76(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 1U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node77(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node77(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node45(context)
+      && (context->AdjustPosition(), Node47(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedHost
+#endif  // STRINGOZZI_GENERATED_GENERATEDHOST_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDNESTED_H_
+#define STRINGOZZI_GENERATED_GENERATEDNESTED_H_
+#include "Stringozzi.h"
+
+namespace GeneratedNested {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node2(context))
+      && (context->AdjustPosition(), Node11(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("(", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  for (unsigned int counter = 0; counter < 4294967295U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node3(context)
+        || (context->GetPosition() == before && !context->Step()))
+      break;
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate3(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x2U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x2U, 0x2U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x3U;
+  }
+  if (((candidates & 0x1U) && Node4(context))
+      || ((candidates & 0x2U) && Node10(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate3(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate3(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node5(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= 0x1UL && chr <= 0x27UL) || chr >= '*') && context->Forward();
+  return ((chr >= 0x1UL && chr <= 0x27UL) || chr >= '*') && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node6(context)) {
+    Position frst = context->GetPosition();
+    context->SetPosition(start);
+    if (Node7(context)) {
+      if (frst > context->GetPosition())
+        context->SetPosition(frst);
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node8(context)) {
+    context->SetPosition(start);
+    return false;
+  }
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node9(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr >= '(' && chr <= ')')) && context->Forward();
+  return ((chr >= '(' && chr <= ')')) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  SPEG::SChar chr = context->Get();
+  if (chr != '('
+      && chr != ')')
+    return false;
+  context->Forward();
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate10(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!Node0(context))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate10(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate10(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(")", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedNested
+#endif  // STRINGOZZI_GENERATED_GENERATEDNESTED_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDMETHODS_H_
+#define STRINGOZZI_GENERATED_GENERATEDMETHODS_H_
+#include "Stringozzi.h"
+
+namespace GeneratedMethods {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node2(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  static const unsigned int depths[] = { 1, 1, 1, 1 };
+  Position entry = context->GetPosition();
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  Position end = start;
+  unsigned int best = 4;
+  // Get() returns the lower case character in case insensitive mode
+  if (context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE))
+    goto folded0;
+  goto sensitive0;
+
+sensitive0:
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 'G': goto sensitive1;
+    case 'P': goto sensitive5;
+    default: goto done;
+  }
+sensitive1:
+  if (!context->Forward())
+    goto done;
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 'E': goto sensitive2;
+    default: goto done;
+  }
+sensitive2:
+  if (!context->Forward())
+    goto done;
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 'T': goto sensitive3;
+    default: goto done;
+  }
+sensitive3:
+  if (!context->Forward())
+    goto done;
+  if (best > 0) {
+    best = 0;
+    end = context->GetPosition();
+  }
+  if (best <= 1)
+    goto done;
+  switch (context->Get()) {
+    case 'S': goto sensitive4;
+    default: goto done;
+  }
+sensitive4:
+  if (!context->Forward())
+    goto done;
+  if (best > 1) {
+    best = 1;
+    end = context->GetPosition();
+  }
+  goto done;
+sensitive5:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 'O': goto sensitive6;
+    case 'U': goto sensitive9;
+    default: goto done;
+  }
+sensitive6:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 'S': goto sensitive7;
+    default: goto done;
+  }
+sensitive7:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 'T': goto sensitive8;
+    default: goto done;
+  }
+sensitive8:
+  if (!context->Forward())
+    goto done;
+  if (best > 2) {
+    best = 2;
+    end = context->GetPosition();
+  }
+  goto done;
+sensitive9:
+  if (!context->Forward())
+    goto done;
+  if (best <= 3)
+    goto done;
+  switch (context->Get()) {
+    case 'T': goto sensitive10;
+    default: goto done;
+  }
+sensitive10:
+  if (!context->Forward())
+    goto done;
+  if (best > 3) {
+    best = 3;
+    end = context->GetPosition();
+  }
+  goto done;
+
+folded0:
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 'g': goto folded1;
+    case 'p': goto folded5;
+    default: goto done;
+  }
+folded1:
+  if (!context->Forward())
+    goto done;
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 'e': goto folded2;
+    default: goto done;
+  }
+folded2:
+  if (!context->Forward())
+    goto done;
+  if (best <= 0)
+    goto done;
+  switch (context->Get()) {
+    case 't': goto folded3;
+    default: goto done;
+  }
+folded3:
+  if (!context->Forward())
+    goto done;
+  if (best > 0) {
+    best = 0;
+    end = context->GetPosition();
+  }
+  if (best <= 1)
+    goto done;
+  switch (context->Get()) {
+    case 's': goto folded4;
+    default: goto done;
+  }
+folded4:
+  if (!context->Forward())
+    goto done;
+  if (best > 1) {
+    best = 1;
+    end = context->GetPosition();
+  }
+  goto done;
+folded5:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 'o': goto folded6;
+    case 'u': goto folded9;
+    default: goto done;
+  }
+folded6:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 's': goto folded7;
+    default: goto done;
+  }
+folded7:
+  if (!context->Forward())
+    goto done;
+  if (best <= 2)
+    goto done;
+  switch (context->Get()) {
+    case 't': goto folded8;
+    default: goto done;
+  }
+folded8:
+  if (!context->Forward())
+    goto done;
+  if (best > 2) {
+    best = 2;
+    end = context->GetPosition();
+  }
+  goto done;
+folded9:
+  if (!context->Forward())
+    goto done;
+  if (best <= 3)
+    goto done;
+  switch (context->Get()) {
+    case 't': goto folded10;
+    default: goto done;
+  }
+folded10:
+  if (!context->Forward())
+    goto done;
+  if (best > 3) {
+    best = 3;
+    end = context->GetPosition();
+  }
+  goto done;
+
+done:
+  if (best == 4) {
+    context->SetPosition(start);
+    return false;
+  }
+  context->SetPosition(end);
+  context->AddMatch(start);
+  for (unsigned int i = 0; i < depths[best]; i++)
+    context->AddMatch(entry);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (context->Get() != 0x0UL)
+    return false;
+  context->Forward();
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedMethods
+#endif  // STRINGOZZI_GENERATED_GENERATEDMETHODS_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDSCAN_H_
+#define STRINGOZZI_GENERATED_GENERATEDSCAN_H_
+#include "Stringozzi.h"
+
+namespace GeneratedScan {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Evaluate0(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x1U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U,
+        0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U, 0x3U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x3U;
+  }
+  bool success = false;
+  Position longest = start;
+
+  context->SetPosition(start);
+  if ((candidates & 0x1U) && Node1(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  context->SetPosition(start);
+  if ((candidates & 0x2U) && Node5(context))
+    success = true;
+  if (context->GetPosition() > longest)
+    longest = context->GetPosition();
+
+  if (!success)
+    return false;
+  context->SetPosition(longest);
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate0(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate0(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node2(context)
+      && (context->AdjustPosition(), Node4(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  static const SPEG::SChar prefixChars[] = { 'H', 'T', 'T', 'P' };
+  static const SPEG::Utils::Literal prefix(std::vector<SPEG::SChar>(prefixChars, prefixChars + 4));
+  static const SPEG::SChar leadingChars[] = { 'H', 'T', 'T', 'P' };
+  static const SPEG::Utils::Literal leading(std::vector<SPEG::SChar>(leadingChars, leadingChars + 4));
+  SPEG::Utils::Flags& flags = context->Flags();
+  Position start = context->GetPosition();
+  do {
+    if (!flags.IsFlagSet(SPEG_CASEINSENSITIVE)
+        && !flags.IsFlagSet(SPEG_IGNORESPACES)
+        && !context->Seek(flags.IsFlagSet(SPEG_MATCHUNNAMED) ? leading : prefix))
+      break;
+    Position before = context->GetPosition();
+    if (Node3(context)) {
+      context->SetPosition(before);
+      context->AddMatch(start);
+      return true;
+    }
+  } while (context->Forward());
+
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("HTTP", 4))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("HTTP", 4))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate5(__CONTEXT* context) {
+  return Node6(context);
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate5(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node7(context)
+      && (context->AdjustPosition(), Node8(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  SPEG::SChar curr = context->Get();
+  if (context->Backward()) {
+    SPEG::SChar prev = context->Get();
+    context->Forward();
+    if (prev == curr - 1 && context->Forward()) {
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedScan
+#endif  // STRINGOZZI_GENERATED_GENERATEDSCAN_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDLOOKBACK_H_
+#define STRINGOZZI_GENERATED_GENERATEDLOOKBACK_H_
+#include "Stringozzi.h"
+
+namespace GeneratedLookBack {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)) {
+    Position frst = context->GetPosition();
+    context->SetPosition(start);
+    if (Node2(context)) {
+      if (frst > context->GetPosition())
+        context->SetPosition(frst);
+      context->AddMatch(start);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(":", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  while (context->Backward()) {
+    Position newStart = context->GetPosition();
+    if (Node3(context)
+        && context->GetPosition() == start)
+      return true;
+    context->SetPosition(newStart);
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("aaa", 3))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedLookBack
+#endif  // STRINGOZZI_GENERATED_GENERATEDLOOKBACK_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDSTATE_H_
+#define STRINGOZZI_GENERATED_GENERATEDSTATE_H_
+#include "Stringozzi.h"
+
+namespace GeneratedState {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node2(context))
+      && (context->AdjustPosition(), Node3(context))
+      && (context->AdjustPosition(), Node4(context))
+      && (context->AdjustPosition(), Node6(context))
+      && (context->AdjustPosition(), Node7(context))
+      && (context->AdjustPosition(), Node8(context))
+      && (context->AdjustPosition(), Node9(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  context->SetVar("V", "x\042y");
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  const char* value = NULL;
+  if (context->GetVar("V", &value))
+    return strcmp("x\042y", value) == 0;
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  context->DelVar("V");
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!Node5(context))
+    return false;
+  context->AddMatch("O", start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("O", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  context->Flags().SetFlag(SPEG_CASEINSENSITIVE, true);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("o", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  context->Flags().SetFlag(SPEG_CASEINSENSITIVE, false);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context) {
+  unsigned long num = context->NumberOfMatches("O");
+  return num >= 1UL && num <= 18446744073709551615UL;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedState
+#endif  // STRINGOZZI_GENERATED_GENERATEDSTATE_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDCOMMIT_H_
+#define STRINGOZZI_GENERATED_GENERATEDCOMMIT_H_
+#include "Stringozzi.h"
+
+namespace GeneratedCommit {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node9(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate1(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x1U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x1U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  bool success;
+  bool cut;
+
+  if (candidates & 0x1U) {
+    unsigned int state = context->BeginCut();
+    success = Node2(context);
+    cut = context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      return false;
+  }
+
+  if (candidates & 0x2U) {
+    unsigned int state = context->BeginCut();
+    success = Node8(context);
+    cut = context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      return false;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate1(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate1(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate2(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x3U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x3U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  bool success;
+  bool cut;
+
+  if (candidates & 0x1U) {
+    unsigned int state = context->BeginCut();
+    success = Node3(context);
+    cut = context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      return false;
+  }
+
+  if (candidates & 0x2U) {
+    unsigned int state = context->BeginCut();
+    success = Node7(context);
+    cut = context->EndCut(state);
+    if (success) {
+      context->AddMatch(start);
+      return true;
+    }
+    if (cut)
+      return false;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate2(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate2(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node4(context)
+      && (context->AdjustPosition(), Node5(context))
+      && (context->AdjustPosition(), Node6(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("GET", 3))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  context->Commit();
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip(" ", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("GETS", 4))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node8(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("PUT", 3))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate9(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x3U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x3U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x2U;
+  }
+  bool success = false;
+  Position longest = start;
+  bool matched = false;
+  bool cut;
+
+  context->SetPosition(start);
+  if (candidates & 0x1U) {
+    unsigned int state = context->BeginCut();
+    success = Node10(context);
+    cut = context->EndCut(state);
+    matched = matched || success;
+    if (context->GetPosition() > longest)
+      longest = context->GetPosition();
+    if (cut)
+      goto done;
+  }
+
+  context->SetPosition(start);
+  if (candidates & 0x2U) {
+    unsigned int state = context->BeginCut();
+    success = Node15(context);
+    cut = context->EndCut(state);
+    matched = matched || success;
+    if (context->GetPosition() > longest)
+      longest = context->GetPosition();
+    if (cut)
+      goto done;
+  }
+
+done:
+  success = matched;
+
+  if (!success)
+    return false;
+  context->SetPosition(longest);
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node9(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate9(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate9(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate10(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x3U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x0U;
+  }
+  bool success = false;
+  Position longest = start;
+  bool matched = false;
+  bool cut;
+
+  context->SetPosition(start);
+  if (candidates & 0x1U) {
+    unsigned int state = context->BeginCut();
+    success = Node11(context);
+    cut = context->EndCut(state);
+    matched = matched || success;
+    if (context->GetPosition() > longest)
+      longest = context->GetPosition();
+    if (cut)
+      goto done;
+  }
+
+  context->SetPosition(start);
+  if (candidates & 0x2U) {
+    unsigned int state = context->BeginCut();
+    success = Node14(context);
+    cut = context->EndCut(state);
+    matched = matched || success;
+    if (context->GetPosition() > longest)
+      longest = context->GetPosition();
+    if (cut)
+      goto done;
+  }
+
+done:
+  success = matched;
+
+  if (!success)
+    return false;
+  context->SetPosition(longest);
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node10(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate10(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate10(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node11(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node12(context)
+      && (context->AdjustPosition(), Node5(context))
+      && (context->AdjustPosition(), Node13(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node12(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("a", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node13(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("b", 1))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node14(__CONTEXT* context) {
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  if (!context->Skip("ac", 2))
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node15(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (!context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedCommit
+#endif  // STRINGOZZI_GENERATED_GENERATEDCOMMIT_H_
+// generated by SPEG::Engine::Generate(), do not edit
+#ifndef STRINGOZZI_GENERATED_GENERATEDGREEK_H_
+#define STRINGOZZI_GENERATED_GENERATEDGREEK_H_
+#include "Stringozzi.h"
+
+namespace GeneratedGreek {
+typedef SPEG::Core::Position Position;
+
+inline SPEG::Utils::CharClass Class(const SPEG::SChar ranges[][2]
+      , size_t count) {
+  SPEG::Utils::CharClass set;
+  for (size_t i = 0; i < count; i++)
+    set.AddRange(ranges[i][0], ranges[i][1]);
+  return set;
+}
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context);
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context);
+
+template <typename __CONTEXT>
+inline bool Node0(__CONTEXT* context) {
+  Position start = context->GetPosition();
+  if (Node1(context)
+      && (context->AdjustPosition(), Node6(context))
+      && (context->AdjustPosition(), Node7(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  context->SetPosition(start);
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node1(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'0', '9'}, {0x370UL, 0x373UL}, {0x375UL, 0x377UL}, {0x37AUL, 0x37DUL}, {0x37FUL, 0x37FUL}, {0x384UL, 0x384UL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x3A1UL}, {0x3A3UL, 0x3E1UL}, {0x3F0UL, 0x3FFUL}, {0x660UL, 0x669UL}, {0x6F0UL, 0x6F9UL}, {0x7C0UL, 0x7C9UL}, {0x966UL, 0x96FUL}, {0x9E6UL, 0x9EFUL}, {0xA66UL, 0xA6FUL}, {0xAE6UL, 0xAEFUL}, {0xB66UL, 0xB6FUL}, {0xBE6UL, 0xBEFUL}, {0xC66UL, 0xC6FUL}, {0xCE6UL, 0xCEFUL}, {0xD66UL, 0xD6FUL}, {0xDE6UL, 0xDEFUL}, {0xE50UL, 0xE59UL}, {0xED0UL, 0xED9UL}, {0xF20UL, 0xF29UL}, {0x1040UL, 0x1049UL}, {0x1090UL, 0x1099UL}, {0x17E0UL, 0x17E9UL}, {0x1810UL, 0x1819UL}, {0x1946UL, 0x194FUL}, {0x19D0UL, 0x19D9UL}, {0x1A80UL, 0x1A89UL}, {0x1A90UL, 0x1A99UL}, {0x1B50UL, 0x1B59UL}, {0x1BB0UL, 0x1BB9UL}, {0x1C40UL, 0x1C49UL}, {0x1C50UL, 0x1C59UL}, {0x1D26UL, 0x1D2AUL}, {0x1D5DUL, 0x1D61UL}, {0x1D66UL, 0x1D6AUL}, {0x1DBFUL, 0x1DBFUL}, {0x1F00UL, 0x1F15UL}, {0x1F18UL, 0x1F1DUL}, {0x1F20UL, 0x1F45UL}, {0x1F48UL, 0x1F4DUL}, {0x1F50UL, 0x1F57UL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F7DUL}, {0x1F80UL, 0x1FB4UL}, {0x1FB6UL, 0x1FC4UL}, {0x1FC6UL, 0x1FD3UL}, {0x1FD6UL, 0x1FDBUL}, {0x1FDDUL, 0x1FEFUL}, {0x1FF2UL, 0x1FF4UL}, {0x1FF6UL, 0x1FFEUL}, {0x2126UL, 0x2126UL}, {0xA620UL, 0xA629UL}, {0xA8D0UL, 0xA8D9UL}, {0xA900UL, 0xA909UL}, {0xA9D0UL, 0xA9D9UL}, {0xA9F0UL, 0xA9F9UL}, {0xAA50UL, 0xAA59UL}, {0xAB65UL, 0xAB65UL}, {0xABF0UL, 0xABF9UL}, {0xFF10UL, 0xFF19UL}, {0x10140UL, 0x1018EUL}, {0x101A0UL, 0x101A0UL}, {0x104A0UL, 0x104A9UL}, {0x10D30UL, 0x10D39UL}, {0x11066UL, 0x1106FUL}, {0x110F0UL, 0x110F9UL}, {0x11136UL, 0x1113FUL}, {0x111D0UL, 0x111D9UL}, {0x112F0UL, 0x112F9UL}, {0x11450UL, 0x11459UL}, {0x114D0UL, 0x114D9UL}, {0x11650UL, 0x11659UL}, {0x116C0UL, 0x116C9UL}, {0x11730UL, 0x11739UL}, {0x118E0UL, 0x118E9UL}, {0x11950UL, 0x11959UL}, {0x11C50UL, 0x11C59UL}, {0x11D50UL, 0x11D59UL}, {0x11DA0UL, 0x11DA9UL}, {0x16A60UL, 0x16A69UL}, {0x16AC0UL, 0x16AC9UL}, {0x16B50UL, 0x16B59UL}, {0x1D200UL, 0x1D245UL}, {0x1D7CEUL, 0x1D7FFUL}, {0x1E140UL, 0x1E149UL}, {0x1E2F0UL, 0x1E2F9UL}, {0x1E950UL, 0x1E959UL}, {0x1FBF0UL, 0x1FBF9UL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 98);
+  static const SPEG::SChar foldedRanges[][2] = { {'0', '9'}, {0xB5UL, 0xB5UL}, {0x345UL, 0x345UL}, {0x370UL, 0x373UL}, {0x375UL, 0x377UL}, {0x37AUL, 0x37DUL}, {0x37FUL, 0x37FUL}, {0x384UL, 0x384UL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x3A1UL}, {0x3A3UL, 0x3E1UL}, {0x3F0UL, 0x3FFUL}, {0x660UL, 0x669UL}, {0x6F0UL, 0x6F9UL}, {0x7C0UL, 0x7C9UL}, {0x966UL, 0x96FUL}, {0x9E6UL, 0x9EFUL}, {0xA66UL, 0xA6FUL}, {0xAE6UL, 0xAEFUL}, {0xB66UL, 0xB6FUL}, {0xBE6UL, 0xBEFUL}, {0xC66UL, 0xC6FUL}, {0xCE6UL, 0xCEFUL}, {0xD66UL, 0xD6FUL}, {0xDE6UL, 0xDEFUL}, {0xE50UL, 0xE59UL}, {0xED0UL, 0xED9UL}, {0xF20UL, 0xF29UL}, {0x1040UL, 0x1049UL}, {0x1090UL, 0x1099UL}, {0x17E0UL, 0x17E9UL}, {0x1810UL, 0x1819UL}, {0x1946UL, 0x194FUL}, {0x19D0UL, 0x19D9UL}, {0x1A80UL, 0x1A89UL}, {0x1A90UL, 0x1A99UL}, {0x1B50UL, 0x1B59UL}, {0x1BB0UL, 0x1BB9UL}, {0x1C40UL, 0x1C49UL}, {0x1C50UL, 0x1C59UL}, {0x1D26UL, 0x1D2AUL}, {0x1D5DUL, 0x1D61UL}, {0x1D66UL, 0x1D6AUL}, {0x1DBFUL, 0x1DBFUL}, {0x1F00UL, 0x1F15UL}, {0x1F18UL, 0x1F1DUL}, {0x1F20UL, 0x1F45UL}, {0x1F48UL, 0x1F4DUL}, {0x1F50UL, 0x1F57UL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F7DUL}, {0x1F80UL, 0x1FB4UL}, {0x1FB6UL, 0x1FC4UL}, {0x1FC6UL, 0x1FD3UL}, {0x1FD6UL, 0x1FDBUL}, {0x1FDDUL, 0x1FEFUL}, {0x1FF2UL, 0x1FF4UL}, {0x1FF6UL, 0x1FFEUL}, {0x2126UL, 0x2126UL}, {0xA620UL, 0xA629UL}, {0xA8D0UL, 0xA8D9UL}, {0xA900UL, 0xA909UL}, {0xA9D0UL, 0xA9D9UL}, {0xA9F0UL, 0xA9F9UL}, {0xAA50UL, 0xAA59UL}, {0xAB65UL, 0xAB65UL}, {0xABF0UL, 0xABF9UL}, {0xFF10UL, 0xFF19UL}, {0x10140UL, 0x1018EUL}, {0x101A0UL, 0x101A0UL}, {0x104A0UL, 0x104A9UL}, {0x10D30UL, 0x10D39UL}, {0x11066UL, 0x1106FUL}, {0x110F0UL, 0x110F9UL}, {0x11136UL, 0x1113FUL}, {0x111D0UL, 0x111D9UL}, {0x112F0UL, 0x112F9UL}, {0x11450UL, 0x11459UL}, {0x114D0UL, 0x114D9UL}, {0x11650UL, 0x11659UL}, {0x116C0UL, 0x116C9UL}, {0x11730UL, 0x11739UL}, {0x118E0UL, 0x118E9UL}, {0x11950UL, 0x11959UL}, {0x11C50UL, 0x11C59UL}, {0x11D50UL, 0x11D59UL}, {0x11DA0UL, 0x11DA9UL}, {0x16A60UL, 0x16A69UL}, {0x16AC0UL, 0x16AC9UL}, {0x16B50UL, 0x16B59UL}, {0x1D200UL, 0x1D245UL}, {0x1D7CEUL, 0x1D7FFUL}, {0x1E140UL, 0x1E149UL}, {0x1E2F0UL, 0x1E2F9UL}, {0x1E950UL, 0x1E959UL}, {0x1FBF0UL, 0x1FBF9UL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 100);
+  Position start = context->GetPosition();
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (!flags.IsFlagSet(SPEG_IGNORESPACES) && !flags.IsFlagSet(SPEG_MATCHUNNAMED)) {
+    size_t count = context->Span(
+          flags.IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive, 4294967295U);
+    if (count < 1U) {
+      context->SetPosition(start);
+      return false;
+    }
+    context->AddMatch(start);
+    return true;
+  }
+
+  for (unsigned int counter = 0; counter < 4294967295U; counter++) {
+    Position before = context->GetPosition();
+    if (!Node2(context)
+        || (context->GetPosition() == before && !context->Step())) {
+      if (counter >= 1U)
+        break;
+      context->SetPosition(start);
+      return false;
+    }
+  }
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node2(__CONTEXT* context) {
+  static const unsigned char sensitive[32] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  static const unsigned char folded[32] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  SPEG::Utils::Flags& flags = context->Flags();
+  if (flags.IsFlagSet(SPEG_IGNORESPACES) || flags.IsFlagSet(SPEG_MATCHUNNAMED))
+    return Node3(context);
+
+  // Get() returns the lower case character in case insensitive mode
+  SPEG::SChar chr = context->Get();
+  if (flags.IsFlagSet(SPEG_CASEINSENSITIVE))
+    return ((chr < 256 ? ((folded[chr >> 3] >> (chr & 7)) & 1) != 0 : (chr == 0x345UL || (chr >= 0x370UL && chr <= 0x373UL) || (chr >= 0x375UL && chr <= 0x377UL) || (chr >= 0x37AUL && chr <= 0x37DUL) || chr == 0x37FUL || chr == 0x384UL || chr == 0x386UL || (chr >= 0x388UL && chr <= 0x38AUL) || chr == 0x38CUL || (chr >= 0x38EUL && chr <= 0x3A1UL) || (chr >= 0x3A3UL && chr <= 0x3E1UL) || (chr >= 0x3F0UL && chr <= 0x3FFUL) || (chr >= 0x660UL && chr <= 0x669UL) || (chr >= 0x6F0UL && chr <= 0x6F9UL) || (chr >= 0x7C0UL && chr <= 0x7C9UL) || (chr >= 0x966UL && chr <= 0x96FUL) || (chr >= 0x9E6UL && chr <= 0x9EFUL) || (chr >= 0xA66UL && chr <= 0xA6FUL) || (chr >= 0xAE6UL && chr <= 0xAEFUL) || (chr >= 0xB66UL && chr <= 0xB6FUL) || (chr >= 0xBE6UL && chr <= 0xBEFUL) || (chr >= 0xC66UL && chr <= 0xC6FUL) || (chr >= 0xCE6UL && chr <= 0xCEFUL) || (chr >= 0xD66UL && chr <= 0xD6FUL) || (chr >= 0xDE6UL && chr <= 0xDEFUL) || (chr >= 0xE50UL && chr <= 0xE59UL) || (chr >= 0xED0UL && chr <= 0xED9UL) || (chr >= 0xF20UL && chr <= 0xF29UL) || (chr >= 0x1040UL && chr <= 0x1049UL) || (chr >= 0x1090UL && chr <= 0x1099UL) || (chr >= 0x17E0UL && chr <= 0x17E9UL) || (chr >= 0x1810UL && chr <= 0x1819UL) || (chr >= 0x1946UL && chr <= 0x194FUL) || (chr >= 0x19D0UL && chr <= 0x19D9UL) || (chr >= 0x1A80UL && chr <= 0x1A89UL) || (chr >= 0x1A90UL && chr <= 0x1A99UL) || (chr >= 0x1B50UL && chr <= 0x1B59UL) || (chr >= 0x1BB0UL && chr <= 0x1BB9UL) || (chr >= 0x1C40UL && chr <= 0x1C49UL) || (chr >= 0x1C50UL && chr <= 0x1C59UL) || (chr >= 0x1D26UL && chr <= 0x1D2AUL) || (chr >= 0x1D5DUL && chr <= 0x1D61UL) || (chr >= 0x1D66UL && chr <= 0x1D6AUL) || chr == 0x1DBFUL || (chr >= 0x1F00UL && chr <= 0x1F15UL) || (chr >= 0x1F18UL && chr <= 0x1F1DUL) || (chr >= 0x1F20UL && chr <= 0x1F45UL) || (chr >= 0x1F48UL && chr <= 0x1F4DUL) || (chr >= 0x1F50UL && chr <= 0x1F57UL) || chr == 0x1F59UL || chr == 0x1F5BUL || chr == 0x1F5DUL || (chr >= 0x1F5FUL && chr <= 0x1F7DUL) || (chr >= 0x1F80UL && chr <= 0x1FB4UL) || (chr >= 0x1FB6UL && chr <= 0x1FC4UL) || (chr >= 0x1FC6UL && chr <= 0x1FD3UL) || (chr >= 0x1FD6UL && chr <= 0x1FDBUL) || (chr >= 0x1FDDUL && chr <= 0x1FEFUL) || (chr >= 0x1FF2UL && chr <= 0x1FF4UL) || (chr >= 0x1FF6UL && chr <= 0x1FFEUL) || chr == 0x2126UL || (chr >= 0xA620UL && chr <= 0xA629UL) || (chr >= 0xA8D0UL && chr <= 0xA8D9UL) || (chr >= 0xA900UL && chr <= 0xA909UL) || (chr >= 0xA9D0UL && chr <= 0xA9D9UL) || (chr >= 0xA9F0UL && chr <= 0xA9F9UL) || (chr >= 0xAA50UL && chr <= 0xAA59UL) || chr == 0xAB65UL || (chr >= 0xABF0UL && chr <= 0xABF9UL) || (chr >= 0xFF10UL && chr <= 0xFF19UL) || (chr >= 0x10140UL && chr <= 0x1018EUL) || chr == 0x101A0UL || (chr >= 0x104A0UL && chr <= 0x104A9UL) || (chr >= 0x10D30UL && chr <= 0x10D39UL) || (chr >= 0x11066UL && chr <= 0x1106FUL) || (chr >= 0x110F0UL && chr <= 0x110F9UL) || (chr >= 0x11136UL && chr <= 0x1113FUL) || (chr >= 0x111D0UL && chr <= 0x111D9UL) || (chr >= 0x112F0UL && chr <= 0x112F9UL) || (chr >= 0x11450UL && chr <= 0x11459UL) || (chr >= 0x114D0UL && chr <= 0x114D9UL) || (chr >= 0x11650UL && chr <= 0x11659UL) || (chr >= 0x116C0UL && chr <= 0x116C9UL) || (chr >= 0x11730UL && chr <= 0x11739UL) || (chr >= 0x118E0UL && chr <= 0x118E9UL) || (chr >= 0x11950UL && chr <= 0x11959UL) || (chr >= 0x11C50UL && chr <= 0x11C59UL) || (chr >= 0x11D50UL && chr <= 0x11D59UL) || (chr >= 0x11DA0UL && chr <= 0x11DA9UL) || (chr >= 0x16A60UL && chr <= 0x16A69UL) || (chr >= 0x16AC0UL && chr <= 0x16AC9UL) || (chr >= 0x16B50UL && chr <= 0x16B59UL) || (chr >= 0x1D200UL && chr <= 0x1D245UL) || (chr >= 0x1D7CEUL && chr <= 0x1D7FFUL) || (chr >= 0x1E140UL && chr <= 0x1E149UL) || (chr >= 0x1E2F0UL && chr <= 0x1E2F9UL) || (chr >= 0x1E950UL && chr <= 0x1E959UL) || (chr >= 0x1FBF0UL && chr <= 0x1FBF9UL)))) && context->Forward();
+  return ((chr < 256 ? ((sensitive[chr >> 3] >> (chr & 7)) & 1) != 0 : ((chr >= 0x370UL && chr <= 0x373UL) || (chr >= 0x375UL && chr <= 0x377UL) || (chr >= 0x37AUL && chr <= 0x37DUL) || chr == 0x37FUL || chr == 0x384UL || chr == 0x386UL || (chr >= 0x388UL && chr <= 0x38AUL) || chr == 0x38CUL || (chr >= 0x38EUL && chr <= 0x3A1UL) || (chr >= 0x3A3UL && chr <= 0x3E1UL) || (chr >= 0x3F0UL && chr <= 0x3FFUL) || (chr >= 0x660UL && chr <= 0x669UL) || (chr >= 0x6F0UL && chr <= 0x6F9UL) || (chr >= 0x7C0UL && chr <= 0x7C9UL) || (chr >= 0x966UL && chr <= 0x96FUL) || (chr >= 0x9E6UL && chr <= 0x9EFUL) || (chr >= 0xA66UL && chr <= 0xA6FUL) || (chr >= 0xAE6UL && chr <= 0xAEFUL) || (chr >= 0xB66UL && chr <= 0xB6FUL) || (chr >= 0xBE6UL && chr <= 0xBEFUL) || (chr >= 0xC66UL && chr <= 0xC6FUL) || (chr >= 0xCE6UL && chr <= 0xCEFUL) || (chr >= 0xD66UL && chr <= 0xD6FUL) || (chr >= 0xDE6UL && chr <= 0xDEFUL) || (chr >= 0xE50UL && chr <= 0xE59UL) || (chr >= 0xED0UL && chr <= 0xED9UL) || (chr >= 0xF20UL && chr <= 0xF29UL) || (chr >= 0x1040UL && chr <= 0x1049UL) || (chr >= 0x1090UL && chr <= 0x1099UL) || (chr >= 0x17E0UL && chr <= 0x17E9UL) || (chr >= 0x1810UL && chr <= 0x1819UL) || (chr >= 0x1946UL && chr <= 0x194FUL) || (chr >= 0x19D0UL && chr <= 0x19D9UL) || (chr >= 0x1A80UL && chr <= 0x1A89UL) || (chr >= 0x1A90UL && chr <= 0x1A99UL) || (chr >= 0x1B50UL && chr <= 0x1B59UL) || (chr >= 0x1BB0UL && chr <= 0x1BB9UL) || (chr >= 0x1C40UL && chr <= 0x1C49UL) || (chr >= 0x1C50UL && chr <= 0x1C59UL) || (chr >= 0x1D26UL && chr <= 0x1D2AUL) || (chr >= 0x1D5DUL && chr <= 0x1D61UL) || (chr >= 0x1D66UL && chr <= 0x1D6AUL) || chr == 0x1DBFUL || (chr >= 0x1F00UL && chr <= 0x1F15UL) || (chr >= 0x1F18UL && chr <= 0x1F1DUL) || (chr >= 0x1F20UL && chr <= 0x1F45UL) || (chr >= 0x1F48UL && chr <= 0x1F4DUL) || (chr >= 0x1F50UL && chr <= 0x1F57UL) || chr == 0x1F59UL || chr == 0x1F5BUL || chr == 0x1F5DUL || (chr >= 0x1F5FUL && chr <= 0x1F7DUL) || (chr >= 0x1F80UL && chr <= 0x1FB4UL) || (chr >= 0x1FB6UL && chr <= 0x1FC4UL) || (chr >= 0x1FC6UL && chr <= 0x1FD3UL) || (chr >= 0x1FD6UL && chr <= 0x1FDBUL) || (chr >= 0x1FDDUL && chr <= 0x1FEFUL) || (chr >= 0x1FF2UL && chr <= 0x1FF4UL) || (chr >= 0x1FF6UL && chr <= 0x1FFEUL) || chr == 0x2126UL || (chr >= 0xA620UL && chr <= 0xA629UL) || (chr >= 0xA8D0UL && chr <= 0xA8D9UL) || (chr >= 0xA900UL && chr <= 0xA909UL) || (chr >= 0xA9D0UL && chr <= 0xA9D9UL) || (chr >= 0xA9F0UL && chr <= 0xA9F9UL) || (chr >= 0xAA50UL && chr <= 0xAA59UL) || chr == 0xAB65UL || (chr >= 0xABF0UL && chr <= 0xABF9UL) || (chr >= 0xFF10UL && chr <= 0xFF19UL) || (chr >= 0x10140UL && chr <= 0x1018EUL) || chr == 0x101A0UL || (chr >= 0x104A0UL && chr <= 0x104A9UL) || (chr >= 0x10D30UL && chr <= 0x10D39UL) || (chr >= 0x11066UL && chr <= 0x1106FUL) || (chr >= 0x110F0UL && chr <= 0x110F9UL) || (chr >= 0x11136UL && chr <= 0x1113FUL) || (chr >= 0x111D0UL && chr <= 0x111D9UL) || (chr >= 0x112F0UL && chr <= 0x112F9UL) || (chr >= 0x11450UL && chr <= 0x11459UL) || (chr >= 0x114D0UL && chr <= 0x114D9UL) || (chr >= 0x11650UL && chr <= 0x11659UL) || (chr >= 0x116C0UL && chr <= 0x116C9UL) || (chr >= 0x11730UL && chr <= 0x11739UL) || (chr >= 0x118E0UL && chr <= 0x118E9UL) || (chr >= 0x11950UL && chr <= 0x11959UL) || (chr >= 0x11C50UL && chr <= 0x11C59UL) || (chr >= 0x11D50UL && chr <= 0x11D59UL) || (chr >= 0x11DA0UL && chr <= 0x11DA9UL) || (chr >= 0x16A60UL && chr <= 0x16A69UL) || (chr >= 0x16AC0UL && chr <= 0x16AC9UL) || (chr >= 0x16B50UL && chr <= 0x16B59UL) || (chr >= 0x1D200UL && chr <= 0x1D245UL) || (chr >= 0x1D7CEUL && chr <= 0x1D7FFUL) || (chr >= 0x1E140UL && chr <= 0x1E149UL) || (chr >= 0x1E2F0UL && chr <= 0x1E2F9UL) || (chr >= 0x1E950UL && chr <= 0x1E959UL) || (chr >= 0x1FBF0UL && chr <= 0x1FBF9UL)))) && context->Forward();
+}
+
+template <typename __CONTEXT>
+inline bool Evaluate3(__CONTEXT* context) {
+  static const unsigned int table[256] = {
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U,
+        0x2U, 0x2U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x1U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U,
+        0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U };
+  Position start = context->GetPosition();
+  unsigned int candidates = SPEG_CHOICE_ALL;
+  if (!context->Flags().IsFlagSet(SPEG_IGNORESPACES)) {
+    SPEG::SChar chr = context->Get();
+    candidates = chr < 256 ? table[chr] : 0x3U;
+  }
+  if (((candidates & 0x1U) && Node4(context))
+      || ((candidates & 0x2U) && Node5(context))) {
+    context->AddMatch(start);
+    return true;
+  }
+  return false;
+}
+
+template <typename __CONTEXT>
+inline bool Node3(__CONTEXT* context) {
+  if (!context->Flags().IsFlagSet(SPEG_MEMOIZE))
+    return Evaluate3(context);
+  static const char key = 0;
+  bool result;
+  if (context->Recall(&key, &result))
+    return result;
+
+  Position start = context->GetPosition();
+  unsigned long flags = context->Flags()._flags;
+  size_t mark = context->BeginMemo();
+  result = Evaluate3(context);
+  context->Memorize(&key, start, flags, mark, result);
+  return result;
+}
+
+template <typename __CONTEXT>
+inline bool Node4(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {0x370UL, 0x373UL}, {0x375UL, 0x377UL}, {0x37AUL, 0x37DUL}, {0x37FUL, 0x37FUL}, {0x384UL, 0x384UL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x3A1UL}, {0x3A3UL, 0x3E1UL}, {0x3F0UL, 0x3FFUL}, {0x1D26UL, 0x1D2AUL}, {0x1D5DUL, 0x1D61UL}, {0x1D66UL, 0x1D6AUL}, {0x1DBFUL, 0x1DBFUL}, {0x1F00UL, 0x1F15UL}, {0x1F18UL, 0x1F1DUL}, {0x1F20UL, 0x1F45UL}, {0x1F48UL, 0x1F4DUL}, {0x1F50UL, 0x1F57UL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F7DUL}, {0x1F80UL, 0x1FB4UL}, {0x1FB6UL, 0x1FC4UL}, {0x1FC6UL, 0x1FD3UL}, {0x1FD6UL, 0x1FDBUL}, {0x1FDDUL, 0x1FEFUL}, {0x1FF2UL, 0x1FF4UL}, {0x1FF6UL, 0x1FFEUL}, {0x2126UL, 0x2126UL}, {0xAB65UL, 0xAB65UL}, {0x10140UL, 0x1018EUL}, {0x101A0UL, 0x101A0UL}, {0x1D200UL, 0x1D245UL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 36);
+  static const SPEG::SChar foldedRanges[][2] = { {0xB5UL, 0xB5UL}, {0x345UL, 0x345UL}, {0x370UL, 0x373UL}, {0x375UL, 0x377UL}, {0x37AUL, 0x37DUL}, {0x37FUL, 0x37FUL}, {0x384UL, 0x384UL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x3A1UL}, {0x3A3UL, 0x3E1UL}, {0x3F0UL, 0x3FFUL}, {0x1D26UL, 0x1D2AUL}, {0x1D5DUL, 0x1D61UL}, {0x1D66UL, 0x1D6AUL}, {0x1DBFUL, 0x1DBFUL}, {0x1F00UL, 0x1F15UL}, {0x1F18UL, 0x1F1DUL}, {0x1F20UL, 0x1F45UL}, {0x1F48UL, 0x1F4DUL}, {0x1F50UL, 0x1F57UL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F7DUL}, {0x1F80UL, 0x1FB4UL}, {0x1FB6UL, 0x1FC4UL}, {0x1FC6UL, 0x1FD3UL}, {0x1FD6UL, 0x1FDBUL}, {0x1FDDUL, 0x1FEFUL}, {0x1FF2UL, 0x1FF4UL}, {0x1FF6UL, 0x1FFEUL}, {0x2126UL, 0x2126UL}, {0xAB65UL, 0xAB65UL}, {0x10140UL, 0x1018EUL}, {0x101A0UL, 0x101A0UL}, {0x1D200UL, 0x1D245UL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 38);
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  // Get() returns the lower case character in case insensitive mode
+  const SPEG::Utils::CharClass& set =
+        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive;
+  if (!set.Contains(context->Get()) || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node5(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'0', '9'}, {0x660UL, 0x669UL}, {0x6F0UL, 0x6F9UL}, {0x7C0UL, 0x7C9UL}, {0x966UL, 0x96FUL}, {0x9E6UL, 0x9EFUL}, {0xA66UL, 0xA6FUL}, {0xAE6UL, 0xAEFUL}, {0xB66UL, 0xB6FUL}, {0xBE6UL, 0xBEFUL}, {0xC66UL, 0xC6FUL}, {0xCE6UL, 0xCEFUL}, {0xD66UL, 0xD6FUL}, {0xDE6UL, 0xDEFUL}, {0xE50UL, 0xE59UL}, {0xED0UL, 0xED9UL}, {0xF20UL, 0xF29UL}, {0x1040UL, 0x1049UL}, {0x1090UL, 0x1099UL}, {0x17E0UL, 0x17E9UL}, {0x1810UL, 0x1819UL}, {0x1946UL, 0x194FUL}, {0x19D0UL, 0x19D9UL}, {0x1A80UL, 0x1A89UL}, {0x1A90UL, 0x1A99UL}, {0x1B50UL, 0x1B59UL}, {0x1BB0UL, 0x1BB9UL}, {0x1C40UL, 0x1C49UL}, {0x1C50UL, 0x1C59UL}, {0xA620UL, 0xA629UL}, {0xA8D0UL, 0xA8D9UL}, {0xA900UL, 0xA909UL}, {0xA9D0UL, 0xA9D9UL}, {0xA9F0UL, 0xA9F9UL}, {0xAA50UL, 0xAA59UL}, {0xABF0UL, 0xABF9UL}, {0xFF10UL, 0xFF19UL}, {0x104A0UL, 0x104A9UL}, {0x10D30UL, 0x10D39UL}, {0x11066UL, 0x1106FUL}, {0x110F0UL, 0x110F9UL}, {0x11136UL, 0x1113FUL}, {0x111D0UL, 0x111D9UL}, {0x112F0UL, 0x112F9UL}, {0x11450UL, 0x11459UL}, {0x114D0UL, 0x114D9UL}, {0x11650UL, 0x11659UL}, {0x116C0UL, 0x116C9UL}, {0x11730UL, 0x11739UL}, {0x118E0UL, 0x118E9UL}, {0x11950UL, 0x11959UL}, {0x11C50UL, 0x11C59UL}, {0x11D50UL, 0x11D59UL}, {0x11DA0UL, 0x11DA9UL}, {0x16A60UL, 0x16A69UL}, {0x16AC0UL, 0x16AC9UL}, {0x16B50UL, 0x16B59UL}, {0x1D7CEUL, 0x1D7FFUL}, {0x1E140UL, 0x1E149UL}, {0x1E2F0UL, 0x1E2F9UL}, {0x1E950UL, 0x1E959UL}, {0x1FBF0UL, 0x1FBF9UL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 62);
+  static const SPEG::SChar foldedRanges[][2] = { {'0', '9'}, {0x660UL, 0x669UL}, {0x6F0UL, 0x6F9UL}, {0x7C0UL, 0x7C9UL}, {0x966UL, 0x96FUL}, {0x9E6UL, 0x9EFUL}, {0xA66UL, 0xA6FUL}, {0xAE6UL, 0xAEFUL}, {0xB66UL, 0xB6FUL}, {0xBE6UL, 0xBEFUL}, {0xC66UL, 0xC6FUL}, {0xCE6UL, 0xCEFUL}, {0xD66UL, 0xD6FUL}, {0xDE6UL, 0xDEFUL}, {0xE50UL, 0xE59UL}, {0xED0UL, 0xED9UL}, {0xF20UL, 0xF29UL}, {0x1040UL, 0x1049UL}, {0x1090UL, 0x1099UL}, {0x17E0UL, 0x17E9UL}, {0x1810UL, 0x1819UL}, {0x1946UL, 0x194FUL}, {0x19D0UL, 0x19D9UL}, {0x1A80UL, 0x1A89UL}, {0x1A90UL, 0x1A99UL}, {0x1B50UL, 0x1B59UL}, {0x1BB0UL, 0x1BB9UL}, {0x1C40UL, 0x1C49UL}, {0x1C50UL, 0x1C59UL}, {0xA620UL, 0xA629UL}, {0xA8D0UL, 0xA8D9UL}, {0xA900UL, 0xA909UL}, {0xA9D0UL, 0xA9D9UL}, {0xA9F0UL, 0xA9F9UL}, {0xAA50UL, 0xAA59UL}, {0xABF0UL, 0xABF9UL}, {0xFF10UL, 0xFF19UL}, {0x104A0UL, 0x104A9UL}, {0x10D30UL, 0x10D39UL}, {0x11066UL, 0x1106FUL}, {0x110F0UL, 0x110F9UL}, {0x11136UL, 0x1113FUL}, {0x111D0UL, 0x111D9UL}, {0x112F0UL, 0x112F9UL}, {0x11450UL, 0x11459UL}, {0x114D0UL, 0x114D9UL}, {0x11650UL, 0x11659UL}, {0x116C0UL, 0x116C9UL}, {0x11730UL, 0x11739UL}, {0x118E0UL, 0x118E9UL}, {0x11950UL, 0x11959UL}, {0x11C50UL, 0x11C59UL}, {0x11D50UL, 0x11D59UL}, {0x11DA0UL, 0x11DA9UL}, {0x16A60UL, 0x16A69UL}, {0x16AC0UL, 0x16AC9UL}, {0x16B50UL, 0x16B59UL}, {0x1D7CEUL, 0x1D7FFUL}, {0x1E140UL, 0x1E149UL}, {0x1E2F0UL, 0x1E2F9UL}, {0x1E950UL, 0x1E959UL}, {0x1FBF0UL, 0x1FBF9UL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 62);
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  // Get() returns the lower case character in case insensitive mode
+  const SPEG::Utils::CharClass& set =
+        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive;
+  if (!set.Contains(context->Get()) || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node6(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {0x9UL, 0xDUL}, {' ', ' '}, {0x85UL, 0x85UL}, {0xA0UL, 0xA0UL}, {0x1680UL, 0x1680UL}, {0x2000UL, 0x200AUL}, {0x2028UL, 0x2029UL}, {0x202FUL, 0x202FUL}, {0x205FUL, 0x205FUL}, {0x3000UL, 0x3000UL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 10);
+  static const SPEG::SChar foldedRanges[][2] = { {0x9UL, 0xDUL}, {' ', ' '}, {0x85UL, 0x85UL}, {0xA0UL, 0xA0UL}, {0x1680UL, 0x1680UL}, {0x2000UL, 0x200AUL}, {0x2028UL, 0x2029UL}, {0x202FUL, 0x202FUL}, {0x205FUL, 0x205FUL}, {0x3000UL, 0x3000UL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 10);
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  // Get() returns the lower case character in case insensitive mode
+  const SPEG::Utils::CharClass& set =
+        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive;
+  if (!set.Contains(context->Get()) || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Node7(__CONTEXT* context) {
+  static const SPEG::SChar sensitiveRanges[][2] = { {'A', 'Z'}, {0xC0UL, 0xD6UL}, {0xD8UL, 0xDEUL}, {0x100UL, 0x100UL}, {0x102UL, 0x102UL}, {0x104UL, 0x104UL}, {0x106UL, 0x106UL}, {0x108UL, 0x108UL}, {0x10AUL, 0x10AUL}, {0x10CUL, 0x10CUL}, {0x10EUL, 0x10EUL}, {0x110UL, 0x110UL}, {0x112UL, 0x112UL}, {0x114UL, 0x114UL}, {0x116UL, 0x116UL}, {0x118UL, 0x118UL}, {0x11AUL, 0x11AUL}, {0x11CUL, 0x11CUL}, {0x11EUL, 0x11EUL}, {0x120UL, 0x120UL}, {0x122UL, 0x122UL}, {0x124UL, 0x124UL}, {0x126UL, 0x126UL}, {0x128UL, 0x128UL}, {0x12AUL, 0x12AUL}, {0x12CUL, 0x12CUL}, {0x12EUL, 0x12EUL}, {0x130UL, 0x130UL}, {0x132UL, 0x132UL}, {0x134UL, 0x134UL}, {0x136UL, 0x136UL}, {0x139UL, 0x139UL}, {0x13BUL, 0x13BUL}, {0x13DUL, 0x13DUL}, {0x13FUL, 0x13FUL}, {0x141UL, 0x141UL}, {0x143UL, 0x143UL}, {0x145UL, 0x145UL}, {0x147UL, 0x147UL}, {0x14AUL, 0x14AUL}, {0x14CUL, 0x14CUL}, {0x14EUL, 0x14EUL}, {0x150UL, 0x150UL}, {0x152UL, 0x152UL}, {0x154UL, 0x154UL}, {0x156UL, 0x156UL}, {0x158UL, 0x158UL}, {0x15AUL, 0x15AUL}, {0x15CUL, 0x15CUL}, {0x15EUL, 0x15EUL}, {0x160UL, 0x160UL}, {0x162UL, 0x162UL}, {0x164UL, 0x164UL}, {0x166UL, 0x166UL}, {0x168UL, 0x168UL}, {0x16AUL, 0x16AUL}, {0x16CUL, 0x16CUL}, {0x16EUL, 0x16EUL}, {0x170UL, 0x170UL}, {0x172UL, 0x172UL}, {0x174UL, 0x174UL}, {0x176UL, 0x176UL}, {0x178UL, 0x179UL}, {0x17BUL, 0x17BUL}, {0x17DUL, 0x17DUL}, {0x181UL, 0x182UL}, {0x184UL, 0x184UL}, {0x186UL, 0x187UL}, {0x189UL, 0x18BUL}, {0x18EUL, 0x191UL}, {0x193UL, 0x194UL}, {0x196UL, 0x198UL}, {0x19CUL, 0x19DUL}, {0x19FUL, 0x1A0UL}, {0x1A2UL, 0x1A2UL}, {0x1A4UL, 0x1A4UL}, {0x1A6UL, 0x1A7UL}, {0x1A9UL, 0x1A9UL}, {0x1ACUL, 0x1ACUL}, {0x1AEUL, 0x1AFUL}, {0x1B1UL, 0x1B3UL}, {0x1B5UL, 0x1B5UL}, {0x1B7UL, 0x1B8UL}, {0x1BCUL, 0x1BCUL}, {0x1C4UL, 0x1C4UL}, {0x1C7UL, 0x1C7UL}, {0x1CAUL, 0x1CAUL}, {0x1CDUL, 0x1CDUL}, {0x1CFUL, 0x1CFUL}, {0x1D1UL, 0x1D1UL}, {0x1D3UL, 0x1D3UL}, {0x1D5UL, 0x1D5UL}, {0x1D7UL, 0x1D7UL}, {0x1D9UL, 0x1D9UL}, {0x1DBUL, 0x1DBUL}, {0x1DEUL, 0x1DEUL}, {0x1E0UL, 0x1E0UL}, {0x1E2UL, 0x1E2UL}, {0x1E4UL, 0x1E4UL}, {0x1E6UL, 0x1E6UL}, {0x1E8UL, 0x1E8UL}, {0x1EAUL, 0x1EAUL}, {0x1ECUL, 0x1ECUL}, {0x1EEUL, 0x1EEUL}, {0x1F1UL, 0x1F1UL}, {0x1F4UL, 0x1F4UL}, {0x1F6UL, 0x1F8UL}, {0x1FAUL, 0x1FAUL}, {0x1FCUL, 0x1FCUL}, {0x1FEUL, 0x1FEUL}, {0x200UL, 0x200UL}, {0x202UL, 0x202UL}, {0x204UL, 0x204UL}, {0x206UL, 0x206UL}, {0x208UL, 0x208UL}, {0x20AUL, 0x20AUL}, {0x20CUL, 0x20CUL}, {0x20EUL, 0x20EUL}, {0x210UL, 0x210UL}, {0x212UL, 0x212UL}, {0x214UL, 0x214UL}, {0x216UL, 0x216UL}, {0x218UL, 0x218UL}, {0x21AUL, 0x21AUL}, {0x21CUL, 0x21CUL}, {0x21EUL, 0x21EUL}, {0x220UL, 0x220UL}, {0x222UL, 0x222UL}, {0x224UL, 0x224UL}, {0x226UL, 0x226UL}, {0x228UL, 0x228UL}, {0x22AUL, 0x22AUL}, {0x22CUL, 0x22CUL}, {0x22EUL, 0x22EUL}, {0x230UL, 0x230UL}, {0x232UL, 0x232UL}, {0x23AUL, 0x23BUL}, {0x23DUL, 0x23EUL}, {0x241UL, 0x241UL}, {0x243UL, 0x246UL}, {0x248UL, 0x248UL}, {0x24AUL, 0x24AUL}, {0x24CUL, 0x24CUL}, {0x24EUL, 0x24EUL}, {0x370UL, 0x370UL}, {0x372UL, 0x372UL}, {0x376UL, 0x376UL}, {0x37FUL, 0x37FUL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x38FUL}, {0x391UL, 0x3A1UL}, {0x3A3UL, 0x3ABUL}, {0x3CFUL, 0x3CFUL}, {0x3D2UL, 0x3D4UL}, {0x3D8UL, 0x3D8UL}, {0x3DAUL, 0x3DAUL}, {0x3DCUL, 0x3DCUL}, {0x3DEUL, 0x3DEUL}, {0x3E0UL, 0x3E0UL}, {0x3E2UL, 0x3E2UL}, {0x3E4UL, 0x3E4UL}, {0x3E6UL, 0x3E6UL}, {0x3E8UL, 0x3E8UL}, {0x3EAUL, 0x3EAUL}, {0x3ECUL, 0x3ECUL}, {0x3EEUL, 0x3EEUL}, {0x3F4UL, 0x3F4UL}, {0x3F7UL, 0x3F7UL}, {0x3F9UL, 0x3FAUL}, {0x3FDUL, 0x42FUL}, {0x460UL, 0x460UL}, {0x462UL, 0x462UL}, {0x464UL, 0x464UL}, {0x466UL, 0x466UL}, {0x468UL, 0x468UL}, {0x46AUL, 0x46AUL}, {0x46CUL, 0x46CUL}, {0x46EUL, 0x46EUL}, {0x470UL, 0x470UL}, {0x472UL, 0x472UL}, {0x474UL, 0x474UL}, {0x476UL, 0x476UL}, {0x478UL, 0x478UL}, {0x47AUL, 0x47AUL}, {0x47CUL, 0x47CUL}, {0x47EUL, 0x47EUL}, {0x480UL, 0x480UL}, {0x48AUL, 0x48AUL}, {0x48CUL, 0x48CUL}, {0x48EUL, 0x48EUL}, {0x490UL, 0x490UL}, {0x492UL, 0x492UL}, {0x494UL, 0x494UL}, {0x496UL, 0x496UL}, {0x498UL, 0x498UL}, {0x49AUL, 0x49AUL}, {0x49CUL, 0x49CUL}, {0x49EUL, 0x49EUL}, {0x4A0UL, 0x4A0UL}, {0x4A2UL, 0x4A2UL}, {0x4A4UL, 0x4A4UL}, {0x4A6UL, 0x4A6UL}, {0x4A8UL, 0x4A8UL}, {0x4AAUL, 0x4AAUL}, {0x4ACUL, 0x4ACUL}, {0x4AEUL, 0x4AEUL}, {0x4B0UL, 0x4B0UL}, {0x4B2UL, 0x4B2UL}, {0x4B4UL, 0x4B4UL}, {0x4B6UL, 0x4B6UL}, {0x4B8UL, 0x4B8UL}, {0x4BAUL, 0x4BAUL}, {0x4BCUL, 0x4BCUL}, {0x4BEUL, 0x4BEUL}, {0x4C0UL, 0x4C1UL}, {0x4C3UL, 0x4C3UL}, {0x4C5UL, 0x4C5UL}, {0x4C7UL, 0x4C7UL}, {0x4C9UL, 0x4C9UL}, {0x4CBUL, 0x4CBUL}, {0x4CDUL, 0x4CDUL}, {0x4D0UL, 0x4D0UL}, {0x4D2UL, 0x4D2UL}, {0x4D4UL, 0x4D4UL}, {0x4D6UL, 0x4D6UL}, {0x4D8UL, 0x4D8UL}, {0x4DAUL, 0x4DAUL}, {0x4DCUL, 0x4DCUL}, {0x4DEUL, 0x4DEUL}, {0x4E0UL, 0x4E0UL}, {0x4E2UL, 0x4E2UL}, {0x4E4UL, 0x4E4UL}, {0x4E6UL, 0x4E6UL}, {0x4E8UL, 0x4E8UL}, {0x4EAUL, 0x4EAUL}, {0x4ECUL, 0x4ECUL}, {0x4EEUL, 0x4EEUL}, {0x4F0UL, 0x4F0UL}, {0x4F2UL, 0x4F2UL}, {0x4F4UL, 0x4F4UL}, {0x4F6UL, 0x4F6UL}, {0x4F8UL, 0x4F8UL}, {0x4FAUL, 0x4FAUL}, {0x4FCUL, 0x4FCUL}, {0x4FEUL, 0x4FEUL}, {0x500UL, 0x500UL}, {0x502UL, 0x502UL}, {0x504UL, 0x504UL}, {0x506UL, 0x506UL}, {0x508UL, 0x508UL}, {0x50AUL, 0x50AUL}, {0x50CUL, 0x50CUL}, {0x50EUL, 0x50EUL}, {0x510UL, 0x510UL}, {0x512UL, 0x512UL}, {0x514UL, 0x514UL}, {0x516UL, 0x516UL}, {0x518UL, 0x518UL}, {0x51AUL, 0x51AUL}, {0x51CUL, 0x51CUL}, {0x51EUL, 0x51EUL}, {0x520UL, 0x520UL}, {0x522UL, 0x522UL}, {0x524UL, 0x524UL}, {0x526UL, 0x526UL}, {0x528UL, 0x528UL}, {0x52AUL, 0x52AUL}, {0x52CUL, 0x52CUL}, {0x52EUL, 0x52EUL}, {0x531UL, 0x556UL}, {0x10A0UL, 0x10C5UL}, {0x10C7UL, 0x10C7UL}, {0x10CDUL, 0x10CDUL}, {0x13A0UL, 0x13F5UL}, {0x1C90UL, 0x1CBAUL}, {0x1CBDUL, 0x1CBFUL}, {0x1E00UL, 0x1E00UL}, {0x1E02UL, 0x1E02UL}, {0x1E04UL, 0x1E04UL}, {0x1E06UL, 0x1E06UL}, {0x1E08UL, 0x1E08UL}, {0x1E0AUL, 0x1E0AUL}, {0x1E0CUL, 0x1E0CUL}, {0x1E0EUL, 0x1E0EUL}, {0x1E10UL, 0x1E10UL}, {0x1E12UL, 0x1E12UL}, {0x1E14UL, 0x1E14UL}, {0x1E16UL, 0x1E16UL}, {0x1E18UL, 0x1E18UL}, {0x1E1AUL, 0x1E1AUL}, {0x1E1CUL, 0x1E1CUL}, {0x1E1EUL, 0x1E1EUL}, {0x1E20UL, 0x1E20UL}, {0x1E22UL, 0x1E22UL}, {0x1E24UL, 0x1E24UL}, {0x1E26UL, 0x1E26UL}, {0x1E28UL, 0x1E28UL}, {0x1E2AUL, 0x1E2AUL}, {0x1E2CUL, 0x1E2CUL}, {0x1E2EUL, 0x1E2EUL}, {0x1E30UL, 0x1E30UL}, {0x1E32UL, 0x1E32UL}, {0x1E34UL, 0x1E34UL}, {0x1E36UL, 0x1E36UL}, {0x1E38UL, 0x1E38UL}, {0x1E3AUL, 0x1E3AUL}, {0x1E3CUL, 0x1E3CUL}, {0x1E3EUL, 0x1E3EUL}, {0x1E40UL, 0x1E40UL}, {0x1E42UL, 0x1E42UL}, {0x1E44UL, 0x1E44UL}, {0x1E46UL, 0x1E46UL}, {0x1E48UL, 0x1E48UL}, {0x1E4AUL, 0x1E4AUL}, {0x1E4CUL, 0x1E4CUL}, {0x1E4EUL, 0x1E4EUL}, {0x1E50UL, 0x1E50UL}, {0x1E52UL, 0x1E52UL}, {0x1E54UL, 0x1E54UL}, {0x1E56UL, 0x1E56UL}, {0x1E58UL, 0x1E58UL}, {0x1E5AUL, 0x1E5AUL}, {0x1E5CUL, 0x1E5CUL}, {0x1E5EUL, 0x1E5EUL}, {0x1E60UL, 0x1E60UL}, {0x1E62UL, 0x1E62UL}, {0x1E64UL, 0x1E64UL}, {0x1E66UL, 0x1E66UL}, {0x1E68UL, 0x1E68UL}, {0x1E6AUL, 0x1E6AUL}, {0x1E6CUL, 0x1E6CUL}, {0x1E6EUL, 0x1E6EUL}, {0x1E70UL, 0x1E70UL}, {0x1E72UL, 0x1E72UL}, {0x1E74UL, 0x1E74UL}, {0x1E76UL, 0x1E76UL}, {0x1E78UL, 0x1E78UL}, {0x1E7AUL, 0x1E7AUL}, {0x1E7CUL, 0x1E7CUL}, {0x1E7EUL, 0x1E7EUL}, {0x1E80UL, 0x1E80UL}, {0x1E82UL, 0x1E82UL}, {0x1E84UL, 0x1E84UL}, {0x1E86UL, 0x1E86UL}, {0x1E88UL, 0x1E88UL}, {0x1E8AUL, 0x1E8AUL}, {0x1E8CUL, 0x1E8CUL}, {0x1E8EUL, 0x1E8EUL}, {0x1E90UL, 0x1E90UL}, {0x1E92UL, 0x1E92UL}, {0x1E94UL, 0x1E94UL}, {0x1E9EUL, 0x1E9EUL}, {0x1EA0UL, 0x1EA0UL}, {0x1EA2UL, 0x1EA2UL}, {0x1EA4UL, 0x1EA4UL}, {0x1EA6UL, 0x1EA6UL}, {0x1EA8UL, 0x1EA8UL}, {0x1EAAUL, 0x1EAAUL}, {0x1EACUL, 0x1EACUL}, {0x1EAEUL, 0x1EAEUL}, {0x1EB0UL, 0x1EB0UL}, {0x1EB2UL, 0x1EB2UL}, {0x1EB4UL, 0x1EB4UL}, {0x1EB6UL, 0x1EB6UL}, {0x1EB8UL, 0x1EB8UL}, {0x1EBAUL, 0x1EBAUL}, {0x1EBCUL, 0x1EBCUL}, {0x1EBEUL, 0x1EBEUL}, {0x1EC0UL, 0x1EC0UL}, {0x1EC2UL, 0x1EC2UL}, {0x1EC4UL, 0x1EC4UL}, {0x1EC6UL, 0x1EC6UL}, {0x1EC8UL, 0x1EC8UL}, {0x1ECAUL, 0x1ECAUL}, {0x1ECCUL, 0x1ECCUL}, {0x1ECEUL, 0x1ECEUL}, {0x1ED0UL, 0x1ED0UL}, {0x1ED2UL, 0x1ED2UL}, {0x1ED4UL, 0x1ED4UL}, {0x1ED6UL, 0x1ED6UL}, {0x1ED8UL, 0x1ED8UL}, {0x1EDAUL, 0x1EDAUL}, {0x1EDCUL, 0x1EDCUL}, {0x1EDEUL, 0x1EDEUL}, {0x1EE0UL, 0x1EE0UL}, {0x1EE2UL, 0x1EE2UL}, {0x1EE4UL, 0x1EE4UL}, {0x1EE6UL, 0x1EE6UL}, {0x1EE8UL, 0x1EE8UL}, {0x1EEAUL, 0x1EEAUL}, {0x1EECUL, 0x1EECUL}, {0x1EEEUL, 0x1EEEUL}, {0x1EF0UL, 0x1EF0UL}, {0x1EF2UL, 0x1EF2UL}, {0x1EF4UL, 0x1EF4UL}, {0x1EF6UL, 0x1EF6UL}, {0x1EF8UL, 0x1EF8UL}, {0x1EFAUL, 0x1EFAUL}, {0x1EFCUL, 0x1EFCUL}, {0x1EFEUL, 0x1EFEUL}, {0x1F08UL, 0x1F0FUL}, {0x1F18UL, 0x1F1DUL}, {0x1F28UL, 0x1F2FUL}, {0x1F38UL, 0x1F3FUL}, {0x1F48UL, 0x1F4DUL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F5FUL}, {0x1F68UL, 0x1F6FUL}, {0x1FB8UL, 0x1FBBUL}, {0x1FC8UL, 0x1FCBUL}, {0x1FD8UL, 0x1FDBUL}, {0x1FE8UL, 0x1FECUL}, {0x1FF8UL, 0x1FFBUL}, {0x2102UL, 0x2102UL}, {0x2107UL, 0x2107UL}, {0x210BUL, 0x210DUL}, {0x2110UL, 0x2112UL}, {0x2115UL, 0x2115UL}, {0x2119UL, 0x211DUL}, {0x2124UL, 0x2124UL}, {0x2126UL, 0x2126UL}, {0x2128UL, 0x2128UL}, {0x212AUL, 0x212DUL}, {0x2130UL, 0x2133UL}, {0x213EUL, 0x213FUL}, {0x2145UL, 0x2145UL}, {0x2183UL, 0x2183UL}, {0x2C00UL, 0x2C2FUL}, {0x2C60UL, 0x2C60UL}, {0x2C62UL, 0x2C64UL}, {0x2C67UL, 0x2C67UL}, {0x2C69UL, 0x2C69UL}, {0x2C6BUL, 0x2C6BUL}, {0x2C6DUL, 0x2C70UL}, {0x2C72UL, 0x2C72UL}, {0x2C75UL, 0x2C75UL}, {0x2C7EUL, 0x2C80UL}, {0x2C82UL, 0x2C82UL}, {0x2C84UL, 0x2C84UL}, {0x2C86UL, 0x2C86UL}, {0x2C88UL, 0x2C88UL}, {0x2C8AUL, 0x2C8AUL}, {0x2C8CUL, 0x2C8CUL}, {0x2C8EUL, 0x2C8EUL}, {0x2C90UL, 0x2C90UL}, {0x2C92UL, 0x2C92UL}, {0x2C94UL, 0x2C94UL}, {0x2C96UL, 0x2C96UL}, {0x2C98UL, 0x2C98UL}, {0x2C9AUL, 0x2C9AUL}, {0x2C9CUL, 0x2C9CUL}, {0x2C9EUL, 0x2C9EUL}, {0x2CA0UL, 0x2CA0UL}, {0x2CA2UL, 0x2CA2UL}, {0x2CA4UL, 0x2CA4UL}, {0x2CA6UL, 0x2CA6UL}, {0x2CA8UL, 0x2CA8UL}, {0x2CAAUL, 0x2CAAUL}, {0x2CACUL, 0x2CACUL}, {0x2CAEUL, 0x2CAEUL}, {0x2CB0UL, 0x2CB0UL}, {0x2CB2UL, 0x2CB2UL}, {0x2CB4UL, 0x2CB4UL}, {0x2CB6UL, 0x2CB6UL}, {0x2CB8UL, 0x2CB8UL}, {0x2CBAUL, 0x2CBAUL}, {0x2CBCUL, 0x2CBCUL}, {0x2CBEUL, 0x2CBEUL}, {0x2CC0UL, 0x2CC0UL}, {0x2CC2UL, 0x2CC2UL}, {0x2CC4UL, 0x2CC4UL}, {0x2CC6UL, 0x2CC6UL}, {0x2CC8UL, 0x2CC8UL}, {0x2CCAUL, 0x2CCAUL}, {0x2CCCUL, 0x2CCCUL}, {0x2CCEUL, 0x2CCEUL}, {0x2CD0UL, 0x2CD0UL}, {0x2CD2UL, 0x2CD2UL}, {0x2CD4UL, 0x2CD4UL}, {0x2CD6UL, 0x2CD6UL}, {0x2CD8UL, 0x2CD8UL}, {0x2CDAUL, 0x2CDAUL}, {0x2CDCUL, 0x2CDCUL}, {0x2CDEUL, 0x2CDEUL}, {0x2CE0UL, 0x2CE0UL}, {0x2CE2UL, 0x2CE2UL}, {0x2CEBUL, 0x2CEBUL}, {0x2CEDUL, 0x2CEDUL}, {0x2CF2UL, 0x2CF2UL}, {0xA640UL, 0xA640UL}, {0xA642UL, 0xA642UL}, {0xA644UL, 0xA644UL}, {0xA646UL, 0xA646UL}, {0xA648UL, 0xA648UL}, {0xA64AUL, 0xA64AUL}, {0xA64CUL, 0xA64CUL}, {0xA64EUL, 0xA64EUL}, {0xA650UL, 0xA650UL}, {0xA652UL, 0xA652UL}, {0xA654UL, 0xA654UL}, {0xA656UL, 0xA656UL}, {0xA658UL, 0xA658UL}, {0xA65AUL, 0xA65AUL}, {0xA65CUL, 0xA65CUL}, {0xA65EUL, 0xA65EUL}, {0xA660UL, 0xA660UL}, {0xA662UL, 0xA662UL}, {0xA664UL, 0xA664UL}, {0xA666UL, 0xA666UL}, {0xA668UL, 0xA668UL}, {0xA66AUL, 0xA66AUL}, {0xA66CUL, 0xA66CUL}, {0xA680UL, 0xA680UL}, {0xA682UL, 0xA682UL}, {0xA684UL, 0xA684UL}, {0xA686UL, 0xA686UL}, {0xA688UL, 0xA688UL}, {0xA68AUL, 0xA68AUL}, {0xA68CUL, 0xA68CUL}, {0xA68EUL, 0xA68EUL}, {0xA690UL, 0xA690UL}, {0xA692UL, 0xA692UL}, {0xA694UL, 0xA694UL}, {0xA696UL, 0xA696UL}, {0xA698UL, 0xA698UL}, {0xA69AUL, 0xA69AUL}, {0xA722UL, 0xA722UL}, {0xA724UL, 0xA724UL}, {0xA726UL, 0xA726UL}, {0xA728UL, 0xA728UL}, {0xA72AUL, 0xA72AUL}, {0xA72CUL, 0xA72CUL}, {0xA72EUL, 0xA72EUL}, {0xA732UL, 0xA732UL}, {0xA734UL, 0xA734UL}, {0xA736UL, 0xA736UL}, {0xA738UL, 0xA738UL}, {0xA73AUL, 0xA73AUL}, {0xA73CUL, 0xA73CUL}, {0xA73EUL, 0xA73EUL}, {0xA740UL, 0xA740UL}, {0xA742UL, 0xA742UL}, {0xA744UL, 0xA744UL}, {0xA746UL, 0xA746UL}, {0xA748UL, 0xA748UL}, {0xA74AUL, 0xA74AUL}, {0xA74CUL, 0xA74CUL}, {0xA74EUL, 0xA74EUL}, {0xA750UL, 0xA750UL}, {0xA752UL, 0xA752UL}, {0xA754UL, 0xA754UL}, {0xA756UL, 0xA756UL}, {0xA758UL, 0xA758UL}, {0xA75AUL, 0xA75AUL}, {0xA75CUL, 0xA75CUL}, {0xA75EUL, 0xA75EUL}, {0xA760UL, 0xA760UL}, {0xA762UL, 0xA762UL}, {0xA764UL, 0xA764UL}, {0xA766UL, 0xA766UL}, {0xA768UL, 0xA768UL}, {0xA76AUL, 0xA76AUL}, {0xA76CUL, 0xA76CUL}, {0xA76EUL, 0xA76EUL}, {0xA779UL, 0xA779UL}, {0xA77BUL, 0xA77BUL}, {0xA77DUL, 0xA77EUL}, {0xA780UL, 0xA780UL}, {0xA782UL, 0xA782UL}, {0xA784UL, 0xA784UL}, {0xA786UL, 0xA786UL}, {0xA78BUL, 0xA78BUL}, {0xA78DUL, 0xA78DUL}, {0xA790UL, 0xA790UL}, {0xA792UL, 0xA792UL}, {0xA796UL, 0xA796UL}, {0xA798UL, 0xA798UL}, {0xA79AUL, 0xA79AUL}, {0xA79CUL, 0xA79CUL}, {0xA79EUL, 0xA79EUL}, {0xA7A0UL, 0xA7A0UL}, {0xA7A2UL, 0xA7A2UL}, {0xA7A4UL, 0xA7A4UL}, {0xA7A6UL, 0xA7A6UL}, {0xA7A8UL, 0xA7A8UL}, {0xA7AAUL, 0xA7AEUL}, {0xA7B0UL, 0xA7B4UL}, {0xA7B6UL, 0xA7B6UL}, {0xA7B8UL, 0xA7B8UL}, {0xA7BAUL, 0xA7BAUL}, {0xA7BCUL, 0xA7BCUL}, {0xA7BEUL, 0xA7BEUL}, {0xA7C0UL, 0xA7C0UL}, {0xA7C2UL, 0xA7C2UL}, {0xA7C4UL, 0xA7C7UL}, {0xA7C9UL, 0xA7C9UL}, {0xA7D0UL, 0xA7D0UL}, {0xA7D6UL, 0xA7D6UL}, {0xA7D8UL, 0xA7D8UL}, {0xA7F5UL, 0xA7F5UL}, {0xFF21UL, 0xFF3AUL}, {0x10400UL, 0x10427UL}, {0x104B0UL, 0x104D3UL}, {0x10570UL, 0x1057AUL}, {0x1057CUL, 0x1058AUL}, {0x1058CUL, 0x10592UL}, {0x10594UL, 0x10595UL}, {0x10C80UL, 0x10CB2UL}, {0x118A0UL, 0x118BFUL}, {0x16E40UL, 0x16E5FUL}, {0x1D400UL, 0x1D419UL}, {0x1D434UL, 0x1D44DUL}, {0x1D468UL, 0x1D481UL}, {0x1D49CUL, 0x1D49CUL}, {0x1D49EUL, 0x1D49FUL}, {0x1D4A2UL, 0x1D4A2UL}, {0x1D4A5UL, 0x1D4A6UL}, {0x1D4A9UL, 0x1D4ACUL}, {0x1D4AEUL, 0x1D4B5UL}, {0x1D4D0UL, 0x1D4E9UL}, {0x1D504UL, 0x1D505UL}, {0x1D507UL, 0x1D50AUL}, {0x1D50DUL, 0x1D514UL}, {0x1D516UL, 0x1D51CUL}, {0x1D538UL, 0x1D539UL}, {0x1D53BUL, 0x1D53EUL}, {0x1D540UL, 0x1D544UL}, {0x1D546UL, 0x1D546UL}, {0x1D54AUL, 0x1D550UL}, {0x1D56CUL, 0x1D585UL}, {0x1D5A0UL, 0x1D5B9UL}, {0x1D5D4UL, 0x1D5EDUL}, {0x1D608UL, 0x1D621UL}, {0x1D63CUL, 0x1D655UL}, {0x1D670UL, 0x1D689UL}, {0x1D6A8UL, 0x1D6C0UL}, {0x1D6E2UL, 0x1D6FAUL}, {0x1D71CUL, 0x1D734UL}, {0x1D756UL, 0x1D76EUL}, {0x1D790UL, 0x1D7A8UL}, {0x1D7CAUL, 0x1D7CAUL}, {0x1E900UL, 0x1E921UL} };
+  static const SPEG::Utils::CharClass sensitive = Class(sensitiveRanges, 646);
+  static const SPEG::SChar foldedRanges[][2] = { {'A', 'Z'}, {'a', 'z'}, {0xB5UL, 0xB5UL}, {0xC0UL, 0xD6UL}, {0xD8UL, 0xF6UL}, {0xF8UL, 0x130UL}, {0x132UL, 0x137UL}, {0x139UL, 0x148UL}, {0x14AUL, 0x18CUL}, {0x18EUL, 0x19AUL}, {0x19CUL, 0x1A9UL}, {0x1ACUL, 0x1B9UL}, {0x1BCUL, 0x1BDUL}, {0x1BFUL, 0x1BFUL}, {0x1C4UL, 0x1EFUL}, {0x1F1UL, 0x220UL}, {0x222UL, 0x233UL}, {0x23AUL, 0x254UL}, {0x256UL, 0x257UL}, {0x259UL, 0x259UL}, {0x25BUL, 0x25CUL}, {0x260UL, 0x261UL}, {0x263UL, 0x263UL}, {0x265UL, 0x266UL}, {0x268UL, 0x26CUL}, {0x26FUL, 0x26FUL}, {0x271UL, 0x272UL}, {0x275UL, 0x275UL}, {0x27DUL, 0x27DUL}, {0x280UL, 0x280UL}, {0x282UL, 0x283UL}, {0x287UL, 0x28CUL}, {0x292UL, 0x292UL}, {0x29DUL, 0x29EUL}, {0x345UL, 0x345UL}, {0x370UL, 0x373UL}, {0x376UL, 0x377UL}, {0x37BUL, 0x37DUL}, {0x37FUL, 0x37FUL}, {0x386UL, 0x386UL}, {0x388UL, 0x38AUL}, {0x38CUL, 0x38CUL}, {0x38EUL, 0x38FUL}, {0x391UL, 0x3A1UL}, {0x3A3UL, 0x3AFUL}, {0x3B1UL, 0x3F5UL}, {0x3F7UL, 0x3FBUL}, {0x3FDUL, 0x481UL}, {0x48AUL, 0x52FUL}, {0x531UL, 0x556UL}, {0x561UL, 0x586UL}, {0x10A0UL, 0x10C5UL}, {0x10C7UL, 0x10C7UL}, {0x10CDUL, 0x10CDUL}, {0x10D0UL, 0x10FAUL}, {0x10FDUL, 0x10FFUL}, {0x13A0UL, 0x13F5UL}, {0x13F8UL, 0x13FDUL}, {0x1C80UL, 0x1C88UL}, {0x1C90UL, 0x1CBAUL}, {0x1CBDUL, 0x1CBFUL}, {0x1D79UL, 0x1D79UL}, {0x1D7DUL, 0x1D7DUL}, {0x1D8EUL, 0x1D8EUL}, {0x1E00UL, 0x1E95UL}, {0x1E9BUL, 0x1E9BUL}, {0x1E9EUL, 0x1E9EUL}, {0x1EA0UL, 0x1F15UL}, {0x1F18UL, 0x1F1DUL}, {0x1F20UL, 0x1F45UL}, {0x1F48UL, 0x1F4DUL}, {0x1F51UL, 0x1F51UL}, {0x1F53UL, 0x1F53UL}, {0x1F55UL, 0x1F55UL}, {0x1F57UL, 0x1F57UL}, {0x1F59UL, 0x1F59UL}, {0x1F5BUL, 0x1F5BUL}, {0x1F5DUL, 0x1F5DUL}, {0x1F5FUL, 0x1F7DUL}, {0x1FB0UL, 0x1FB1UL}, {0x1FB8UL, 0x1FBBUL}, {0x1FBEUL, 0x1FBEUL}, {0x1FC8UL, 0x1FCBUL}, {0x1FD0UL, 0x1FD1UL}, {0x1FD8UL, 0x1FDBUL}, {0x1FE0UL, 0x1FE1UL}, {0x1FE5UL, 0x1FE5UL}, {0x1FE8UL, 0x1FECUL}, {0x1FF8UL, 0x1FFBUL}, {0x2102UL, 0x2102UL}, {0x2107UL, 0x2107UL}, {0x210BUL, 0x210DUL}, {0x2110UL, 0x2112UL}, {0x2115UL, 0x2115UL}, {0x2119UL, 0x211DUL}, {0x2124UL, 0x2124UL}, {0x2126UL, 0x2126UL}, {0x2128UL, 0x2128UL}, {0x212AUL, 0x212DUL}, {0x2130UL, 0x2133UL}, {0x213EUL, 0x213FUL}, {0x2145UL, 0x2145UL}, {0x214EUL, 0x214EUL}, {0x2183UL, 0x2184UL}, {0x2C00UL, 0x2C70UL}, {0x2C72UL, 0x2C73UL}, {0x2C75UL, 0x2C76UL}, {0x2C7EUL, 0x2CE3UL}, {0x2CEBUL, 0x2CEEUL}, {0x2CF2UL, 0x2CF3UL}, {0x2D00UL, 0x2D25UL}, {0x2D27UL, 0x2D27UL}, {0x2D2DUL, 0x2D2DUL}, {0xA640UL, 0xA66DUL}, {0xA680UL, 0xA69BUL}, {0xA722UL, 0xA72FUL}, {0xA732UL, 0xA76FUL}, {0xA779UL, 0xA787UL}, {0xA78BUL, 0xA78DUL}, {0xA790UL, 0xA794UL}, {0xA796UL, 0xA7AEUL}, {0xA7B0UL, 0xA7CAUL}, {0xA7D0UL, 0xA7D1UL}, {0xA7D6UL, 0xA7D9UL}, {0xA7F5UL, 0xA7F6UL}, {0xAB53UL, 0xAB53UL}, {0xAB70UL, 0xABBFUL}, {0xFF21UL, 0xFF3AUL}, {0xFF41UL, 0xFF5AUL}, {0x10400UL, 0x1044FUL}, {0x104B0UL, 0x104D3UL}, {0x104D8UL, 0x104FBUL}, {0x10570UL, 0x1057AUL}, {0x1057CUL, 0x1058AUL}, {0x1058CUL, 0x10592UL}, {0x10594UL, 0x10595UL}, {0x10597UL, 0x105A1UL}, {0x105A3UL, 0x105B1UL}, {0x105B3UL, 0x105B9UL}, {0x105BBUL, 0x105BCUL}, {0x10C80UL, 0x10CB2UL}, {0x10CC0UL, 0x10CF2UL}, {0x118A0UL, 0x118DFUL}, {0x16E40UL, 0x16E7FUL}, {0x1D400UL, 0x1D419UL}, {0x1D434UL, 0x1D44DUL}, {0x1D468UL, 0x1D481UL}, {0x1D49CUL, 0x1D49CUL}, {0x1D49EUL, 0x1D49FUL}, {0x1D4A2UL, 0x1D4A2UL}, {0x1D4A5UL, 0x1D4A6UL}, {0x1D4A9UL, 0x1D4ACUL}, {0x1D4AEUL, 0x1D4B5UL}, {0x1D4D0UL, 0x1D4E9UL}, {0x1D504UL, 0x1D505UL}, {0x1D507UL, 0x1D50AUL}, {0x1D50DUL, 0x1D514UL}, {0x1D516UL, 0x1D51CUL}, {0x1D538UL, 0x1D539UL}, {0x1D53BUL, 0x1D53EUL}, {0x1D540UL, 0x1D544UL}, {0x1D546UL, 0x1D546UL}, {0x1D54AUL, 0x1D550UL}, {0x1D56CUL, 0x1D585UL}, {0x1D5A0UL, 0x1D5B9UL}, {0x1D5D4UL, 0x1D5EDUL}, {0x1D608UL, 0x1D621UL}, {0x1D63CUL, 0x1D655UL}, {0x1D670UL, 0x1D689UL}, {0x1D6A8UL, 0x1D6C0UL}, {0x1D6E2UL, 0x1D6FAUL}, {0x1D71CUL, 0x1D734UL}, {0x1D756UL, 0x1D76EUL}, {0x1D790UL, 0x1D7A8UL}, {0x1D7CAUL, 0x1D7CAUL}, {0x1E900UL, 0x1E943UL} };
+  static const SPEG::Utils::CharClass folded = Class(foldedRanges, 176);
+  context->AdjustPosition();
+  Position start = context->GetPosition();
+  // Get() returns the lower case character in case insensitive mode
+  const SPEG::Utils::CharClass& set =
+        context->Flags().IsFlagSet(SPEG_CASEINSENSITIVE) ? folded : sensitive;
+  if (!set.Contains(context->Get()) || !context->Forward())
+    return false;
+  context->AddMatch(start);
+  return true;
+}
+
+template <typename __CONTEXT>
+inline bool Check(__CONTEXT* context) {
+  return Node0(context);
+}
+
+template <typename __CHARTYPE>
+inline bool Test(const __CHARTYPE* str, unsigned long flags = 0) {
+  if (!str)
+    return false;
+  SPEG::Core::Context<__CHARTYPE> context(str, flags);
+  return Node0(&context);
+}
+
+// a Context<> is called directly, as Core::Direct() does
+class Validator : public SPEG::Core::NormalValidator {
+ public:
+  virtual bool Check(SPEG::Core::ContextInterface* context) const {
+    switch (context->Kind()) {
+      case SPEG::Core::CK_CHAR:
+        return Node0(static_cast<SPEG::Core::ContextA*>(context));
+      case SPEG::Core::CK_WCHAR:
+        return Node0(static_cast<SPEG::Core::ContextW*>(context));
+      default:
+        return Node0(context);
+    }
+  }
+};
+}  // namespace GeneratedGreek
+#endif  // STRINGOZZI_GENERATED_GENERATEDGREEK_H_
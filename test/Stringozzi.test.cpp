@@ -37,7 +37,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gtest/gtest.h"
 #define EMBEDDED_SOURCE
 #include "Stringozzi.h"
+#include "Stringozzi.Static.h"
+#include "Stringozzi.Generated.h"
 #include <string>
+#include <set>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 using namespace SPEG;
 using namespace SPEG::Utils;
@@ -99,6 +105,28 @@ TEST(Operators, TestEnclosed) {
 
 }
 
+TEST(StateKeepers, TestCaseFolded) {
+  Rule rule = Is("Via") > In("Xy") > Between('A', 'F') > Is('q') > End();
+  Rule rules[] = { rule, Compile(rule) };
+  unsigned long flags[] = { 0, SPEG_ITERATIVE };
+  for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); r++) {
+    StringozziA parser(rules[r]);
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      ASSERT_TRUE(parser.Test("ViaXAq", flags[f]));
+      ASSERT_FALSE(parser.Test("viaxaq", flags[f]));
+      ASSERT_TRUE(parser.Test("viaxaq", flags[f] | SPEG_CASEINSENSITIVE));
+      ASSERT_TRUE(parser.Test("VIAYFQ", flags[f] | SPEG_CASEINSENSITIVE));
+      ASSERT_FALSE(parser.Test("VIAYGQ", flags[f] | SPEG_CASEINSENSITIVE));
+    }
+  }
+  Rule modified = Is("ab") > CaseInsensitive() > Is("AB") > Between('a', 'c')
+        > CaseSensitive() > In("dE") > End();
+  ASSERT_TRUE(Actions::Test(modified, "abABCE"));
+  ASSERT_TRUE(Actions::Test(Compile(modified), "abaBcd"));
+  ASSERT_FALSE(Actions::Test(modified, "abABCe"));
+  ASSERT_FALSE(Actions::Test(Compile(modified), "ABABCE"));
+}
+
 TEST(Manipulators, TestLookAhead) {
   ASSERT_FALSE(Actions::Test(LookAhead(Is("ABC")) > End(), "ABC"));
   ASSERT_TRUE(Actions::Test(LookAhead(Is("ABC")) > Is("ABC") > End(), "ABC"));
@@ -210,6 +238,54 @@ TEST(Utils, TestUTF8ToUTF32Length) {
   ASSERT_EQ(Utils::UTF8ToUTF32Length(""), 1);
 }
 
+TEST(Utils, TestValidateUTF8) {
+  ASSERT_EQ(Utils::ValidateUTF8(""), Utils::TF_ASCII);
+  ASSERT_EQ(Utils::ValidateUTF8("GET / HTTP/1.1\r\n"), Utils::TF_ASCII);
+  ASSERT_EQ(Utils::ValidateUTF8("a\0b", "a\0b" + 3), Utils::TF_ASCII);
+  ASSERT_EQ(Utils::ValidateUTF8("caf\xC3\xA9"), Utils::TF_UTF8);
+  ASSERT_EQ(Utils::ValidateUTF8("\xE0\xA4\xB9\xED\x95\x9C\xF0\x90\x8D\x88")
+        , Utils::TF_UTF8);
+  ASSERT_EQ(Utils::ValidateUTF8("\xF4\x8F\xBF\xBF"), Utils::TF_UTF8);
+
+  const char* invalid[] = { "\x80", "a\xFF", "\xC0\xAF", "\xC1\xBF"
+        , "\xE0\x9F\xBF", "\xED\xA0\x80", "\xF0\x8F\xBF\xBF"
+        , "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xE2\x82", "\xC3\x28" };
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    ASSERT_EQ(Utils::ValidateUTF8(invalid[i]), Utils::TF_INVALID) << i;
+  const char* euro = "\xE2\x82\xAC";
+  ASSERT_EQ(Utils::ValidateUTF8(euro, euro + 2), Utils::TF_INVALID);
+  ASSERT_EQ(Utils::ValidateUTF8(euro, euro + 3), Utils::TF_UTF8);
+
+  // the ASCII runs are skipped by blocks, from every alignment
+  for (size_t i = 0; i < 80; i++) {
+    string text(i, 'a');
+    ASSERT_EQ(Utils::ValidateUTF8(text.c_str()), Utils::TF_ASCII) << i;
+    ASSERT_EQ(Utils::ValidateUTF8(text.data(), text.data() + text.size())
+          , Utils::TF_ASCII) << i;
+    text += "\xC3\xA9 ";
+    ASSERT_EQ(Utils::ValidateUTF8(text.c_str()), Utils::TF_UTF8) << i;
+    text += "\xC3\x28";
+    const char* at = NULL;
+    ASSERT_EQ(Utils::ValidateUTF8(text.c_str(), NULL, &at)
+          , Utils::TF_INVALID) << i;
+    ASSERT_EQ(at, text.c_str() + i + 3) << i;
+    ASSERT_EQ(Utils::ValidateUTF8(text.data(), text.data() + i + 3)
+          , Utils::TF_UTF8) << i;
+  }
+
+  // the texts fill their allocations, a load past either edge of them is 
+  // reported by the address sanitizer
+  for (size_t length = 0; length < 100; length++) {
+    char* buffer = new char[length + 1];
+    memset(buffer, 'a', length);
+    buffer[length] = 0;
+    ASSERT_EQ(Utils::ValidateUTF8(buffer), Utils::TF_ASCII) << length;
+    ASSERT_EQ(Utils::ValidateUTF8(buffer, buffer + length), Utils::TF_ASCII)
+          << length;
+    delete[] buffer;
+  }
+}
+
 #ifdef CX11_SUPPORTED
 
 TEST(Utils, TestUTF16ToUTF32) {
@@ -233,6 +309,63 @@ TEST(Utils, TestUTF16ToUTF32Length) {
 }
 #endif
 
+TEST(Utils, TestCaseFolding) {
+  ASSERT_EQ(Utils::CharToLower('A'), 'a');
+  ASSERT_EQ(Utils::CharToLower('@'), '@');
+  ASSERT_EQ(Utils::CharToLower(0xC9), 0xE9UL);       // É
+  ASSERT_EQ(Utils::CharToLower(0xB5), 0x3BCUL);      // micro sign
+  ASSERT_EQ(Utils::CharToLower(0x3A3), 0x3C3UL);     // Σ
+  ASSERT_EQ(Utils::CharToLower(0x3C2), 0x3C3UL);     // final ς
+  ASSERT_EQ(Utils::CharToLower(0x414), 0x434UL);     // Д
+  ASSERT_EQ(Utils::CharToLower(0x212A), 'k');        // Kelvin sign
+  ASSERT_EQ(Utils::CharToLower(0x1E9E), 0xDFUL);     // ẞ
+  ASSERT_EQ(Utils::CharToLower(0x10400), 0x10428UL); // Deseret
+  ASSERT_EQ(Utils::CharToLower(0xAB70), 0x13A0UL);   // Cherokee
+  ASSERT_EQ(Utils::CharToLower(0x130), 0x130UL);     // İ, Turkic only
+  ASSERT_EQ(Utils::CharToLower(0xDF), 0xDFUL);
+  ASSERT_EQ(Utils::CharToLower(0x10FFFF), 0x10FFFFUL);
+
+  Utils::CharClass folded;
+  Utils::Unfold(&folded, 'k', 'k');
+  ASSERT_TRUE(folded.Contains('k'));
+  ASSERT_TRUE(folded.Contains('K'));
+  ASSERT_TRUE(folded.Contains(0x212A));
+  ASSERT_FALSE(folded.Contains('j'));
+  Utils::CharClass greek;
+  Utils::Unfold(&greek, 0x3B1, 0x3C9);
+  ASSERT_TRUE(greek.Contains(0x391));
+  ASSERT_TRUE(greek.Contains(0x3C2));
+  ASSERT_TRUE(greek.Contains(0xB5));
+  ASSERT_FALSE(greek.Contains(0x3A2));
+}
+
+TEST(Operators, TestUnicodeCase) {
+  unsigned long flags = SPEG_CASEINSENSITIVE;
+  Rule name = Is("M\xC3\xBCller") > In("\xCE\xA3") > Between(L'\x0410', L'\x042F')
+        > End();
+  const char* text = "M\xC3\x9CLLER\xCF\x82\xD0\xB6";
+  ASSERT_FALSE(StringozziA(name).Test(text));
+  ASSERT_TRUE(StringozziA(name).Test(text, flags));
+  ASSERT_TRUE(StringozziA(Compile(name)).Test(text, flags));
+  ASSERT_TRUE(StringozziA(Optimize(name)).Test(text, flags));
+  ASSERT_FALSE(StringozziA(name).Test("MULLER\xCF\x82\xD0\xB6", flags));
+  ASSERT_TRUE(StringozziA(+Between(L'\x0430', L'\x044F') > End())
+        .Test("\xD0\x96\xD0\xB6\xD0\x94", flags));
+  ASSERT_TRUE(StringozziA(Determinize(+Between(L'\x0430', L'\x044F') > End()))
+        .Test("\xD0\x96\xD0\xB6\xD0\x94", flags));
+  ASSERT_TRUE(StringozziA(+(Is('k') | Is('s')) > End())
+        .Test("K\xE2\x84\xAAs\xC5\xBF", flags));
+
+  ASSERT_TRUE(StringozziW(Is("M\xC3\xBCller") > Is(L'\x03A3') > End())
+        .Test(L"M\x00DCLLER\x03C2", flags));
+#ifdef CX11_SUPPORTED
+  ASSERT_TRUE(StringozziU16(Is("M\xC3\xBCller") > Between(u'\u0410', u'\u042F')
+        > End()).Test(u"M\u00DCLLER\u0436", flags));
+  ASSERT_TRUE(StringozziU32(Is(U'\U00010400') > End())
+        .Test(U"\U00010428", flags));
+#endif
+}
+
 TEST(Operators, TestNumbers) {
   ASSERT_TRUE(StringozziA(Rational()).Test("2"));
   ASSERT_TRUE(StringozziA(Rational()).Test("2.0"));
@@ -405,6 +538,76 @@ TEST(Manipulators, TestSequence) {
   ASSERT_FALSE(StringozziA(Is('S') > Is('O') > End()).Test("SOO"));
 }
 
+TEST(Manipulators, TestNary) {
+  Rule seq = Is('a') > Is('b') > Is('c') > Is('d');
+  ASSERT_EQ(seq.Get()->Type(), Core::VT_SEQ);
+  ASSERT_EQ(static_cast<const Core::NaryValidator*>(seq.Get())->Count(), 4);
+  Rule choice = Is('a') | Is("bc") | (Is("de") | Is("e")) | Is('f');
+  ASSERT_EQ(static_cast<const Core::NaryValidator*>(choice.Get())->Count()
+        , 5);
+  Rule greedy = Is('a') || Is("ab") || Is("abc");
+  ASSERT_EQ(static_cast<const Core::NaryValidator*>(greedy.Get())->Count()
+        , 3);
+  // the shared chain is left as it is
+  Rule longer = seq > Is('e');
+  ASSERT_EQ(static_cast<const Core::NaryValidator*>(longer.Get())->Count()
+        , 5);
+  ASSERT_EQ(static_cast<const Core::NaryValidator*>(seq.Get())->Count(), 4);
+
+  // a single unnamed match for the whole chain
+  MatchesA m;
+  ASSERT_TRUE(StringozziA(seq).Match("abcd", m, SPEG_MATCHUNNAMED));
+  ASSERT_EQ(m.NumberOfMatches(), 1);
+  ASSERT_TRUE(StringozziA(choice > End()).Test("e"));
+  ASSERT_FALSE(StringozziA(choice > End()).Test("b"));
+  ASSERT_TRUE(StringozziA(greedy > End()).Test("abc"));
+  ASSERT_TRUE(StringozziA(Compile(greedy > End())).Test("abc"));
+  ASSERT_TRUE(StringozziA(Compile(choice > End())).Test("de", SPEG_ITERATIVE));
+  ASSERT_TRUE(StringozziA(Compile(greedy > End())).Test("abc", SPEG_ITERATIVE));
+  ASSERT_FALSE(StringozziA(Compile(seq)).Test("abd", SPEG_ITERATIVE));
+}
+
+TEST(Manipulators, TestCommit) {
+  Rule method = ((Is("GET") > Commit() > Is(' ')) | Is("GETS") | Is('G'))
+        > End();
+  Rule nested = (((Is('a') > Commit() > Is('b')) | Is("ac")) | Is('a'))
+        > End();
+  Rule greedy = ((Is('a') > Commit()) || Is("ab")) > End();
+  Rule rules[] = { method, nested, greedy, Compile(method), Compile(nested)
+        , Compile(greedy) };
+  unsigned long flags[] = { 0, SPEG_MEMOIZE, SPEG_ITERATIVE };
+  for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); r++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      StringozziA parser(rules[r]);
+      if (r % 3 == 0) {
+        ASSERT_TRUE(parser.Test("GET ", flags[f]));
+        // the other methods are not tried once GET is matched
+        ASSERT_FALSE(parser.Test("GETS", flags[f]));
+        ASSERT_TRUE(parser.Test("G", flags[f]));
+      } else if (r % 3 == 1) {
+        // the cut is scoped to the parenthesized choice, which is kept
+        ASSERT_TRUE(parser.Test("ab", flags[f]));
+        ASSERT_FALSE(parser.Test("ac", flags[f]));
+        ASSERT_TRUE(parser.Test("a", flags[f]));
+      } else {
+        ASSERT_TRUE(parser.Test("a", flags[f]));
+        ASSERT_FALSE(parser.Test("ab", flags[f]));
+      }
+    }
+  }
+  ASSERT_TRUE(StringozziA(Optimize(method)).Test("GET "));
+  ASSERT_FALSE(StringozziA(Optimize(method)).Test("GETS"));
+
+  // outside any choice the memoized outcomes before the cut are dropped
+  Rule committed = *(Memoize(Any()) > Commit());
+  Core::ContextA context("abcd", SPEG_MEMOIZE);
+  ASSERT_TRUE(committed.Get()->Check(&context));
+  ASSERT_EQ(context.Memoized(), 1);
+  Core::ContextA kept("abcd", SPEG_MEMOIZE);
+  ASSERT_TRUE((*Memoize(Any())).Get()->Check(&kept));
+  ASSERT_EQ(kept.Memoized(), 5);
+}
+
 TEST(Manipulators, TestZeroOrMore) {
   ASSERT_TRUE(StringozziA(*Is('L') > End()).Test(""));
   ASSERT_TRUE(StringozziA(*Is('L') > End()).Test("LLLLLL"));
@@ -509,6 +712,161 @@ TEST(Actions, TestReplaceInPlace) {
   ASSERT_STREQ(str.c_str(), "ABXYZFG");
 }
 
+TEST(Actions, TestBoundedText) {
+  // the bytes after the bound are never read as part of the text
+  const char buffer[] = "abc123XYZ";
+  ASSERT_TRUE(Actions::Test(Is("abc123") > End(), Bounded(buffer, 6)));
+  ASSERT_FALSE(Actions::Test(Is("abc123X"), Bounded(buffer, 6)));
+  ASSERT_FALSE(Actions::Search(Is("XYZ"), Bounded(buffer, 6)));
+  ASSERT_FALSE(Actions::Search(Is("123XYZ"), Bounded(buffer, 6)));
+  ASSERT_TRUE(Actions::Search(Is("123XYZ"), Bounded(buffer, 9)));
+  ASSERT_EQ(Actions::SearchAndGetIndex(Is("123"), Bounded(buffer, 6)), 3u);
+  ASSERT_EQ(Actions::SearchAndGetPtr(Is("c1"), Bounded(buffer, 6))
+        , buffer + 2);
+  ASSERT_TRUE(Actions::Test(End(), Bounded(buffer, 0)));
+  ASSERT_FALSE(Actions::Test(Any(), Bounded(buffer, 0)));
+
+  Rule word = +Between('a', 'z') > +Between('0', '9') > End();
+  Rule rules[] = { word, Compile(word), Determinize(word), Optimize(word) };
+  for (size_t i = 0; i < sizeof(rules) / sizeof(rules[0]); i++) {
+    ASSERT_TRUE(StringozziA(rules[i]).Test(Bounded(buffer, 6))) << i;
+    ASSERT_TRUE(StringozziA(rules[i]).Test(Bounded(buffer, 4))) << i;
+    ASSERT_FALSE(StringozziA(rules[i]).Test(Bounded(buffer, 3))) << i;
+    ASSERT_FALSE(StringozziA(rules[i]).Test(Bounded(buffer, 7))) << i;
+  }
+
+  // null characters are part of a text of known length
+  std::string record("key\0value", 9);
+  ASSERT_TRUE(Actions::Test(Is("key") > Any() > Is("value") > End(), record));
+  ASSERT_FALSE(Actions::Test(Is("key") > End(), record));
+  ASSERT_TRUE(Actions::Test(Is("key") > Is(SPEG_NUL), record));
+  ASSERT_TRUE(Actions::Test(+(Not(Is('v')) > Any()) > Is("value") > End()
+        , record));
+  std::vector<std::string> parts;
+  ASSERT_TRUE(Actions::Split(Is(SPEG_NUL), record, parts, 0, true, 5));
+  ASSERT_EQ(parts.size(), 2u);
+  ASSERT_EQ(parts[0], "key");
+  ASSERT_EQ(parts[1], "value");
+  ASSERT_EQ(Actions::Replace(Is(SPEG_NUL), record, "=")
+        , std::string("key=value"));
+
+  MatchesA m;
+  ASSERT_TRUE(Actions::Match(Is("value") >> "v", record, m));
+  ASSERT_STREQ(m.Get("v", 0), "value");
+
+  // a sequence cut by the bound is read as a replacement character
+  const char accent[] = "ab\xC3\xA9";
+  ASSERT_TRUE(Actions::Test(Is("ab") > Is(0xFFFD) > End()
+        , Bounded(accent, 3)));
+  ASSERT_TRUE(Actions::Test(Is("ab\xC3\xA9") > End()
+        , Bounded(accent, 4)));
+
+  // the spans over a text with no terminator stop at its end, a load past
+  // either edge of the allocation is reported by the address sanitizer
+  for (size_t length = 4; length < 100; length++) {
+    char* request = new char[length];
+    memcpy(request, "GET ", 4);
+    memset(request + 4, 'a', length - 4);
+    ASSERT_TRUE(Actions::Test(Is("GET ") > *Out(" \r\n") > End()
+          , Bounded(request, length))) << length;
+    ASSERT_TRUE(Actions::Test(Is("GET ") > *Out(" \r\n") > End()
+          , Bounded(request, length), SPEG_BYTES)) << length;
+    const char* ptr = request;
+    Utils::CharClass letters;
+    letters.AddRange('A', 'z');
+    ASSERT_EQ(Utils::Span(&ptr, request + length, letters, -1), 3u);
+    ptr = request + 4;
+    ASSERT_EQ(Utils::SpanBytes(&ptr, request + length, letters, -1)
+          , length - 4);
+    delete[] request;
+  }
+
+  std::wstring wide(L"x\0y", 3);
+  ASSERT_TRUE(Actions::Test(Is(L'x') > Any() > Is(L'y') > End(), wide));
+  ASSERT_EQ(Actions::SearchAndGetIndex(Is(L'y'), wide), 2u);
+  ASSERT_FALSE(Actions::Search(Is(L'y'), Bounded(wide.c_str(), 2)));
+#ifdef CX17_SUPPORTED
+  std::string_view view(buffer, 6);
+  ASSERT_TRUE(Actions::Test(Is("abc123") > End(), view));
+  ASSERT_TRUE(Actions::Test(End(), std::string_view()));
+#endif
+}
+
+TEST(Actions, TestBytes) {
+  // a byte is a Latin-1 character
+  ASSERT_TRUE(Actions::Test(Is("caf\xC3\xA9") > End(), "caf\xE9"
+        , SPEG_BYTES));
+  ASSERT_FALSE(Actions::Test(Is("caf\xC3\xA9") > End(), "caf\xE9"));
+  ASSERT_TRUE(Actions::Test(Is("CAF\xC3\x89") > End(), "caf\xE9"
+        , SPEG_BYTES | SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(Actions::Test(Is("caf") > Any() > Any() > End()
+        , "caf\xC3\xA9", SPEG_BYTES));
+  ASSERT_FALSE(Actions::Test(Is("caf") > Any() > Any() > End()
+        , "caf\xC3\xA9"));
+  ASSERT_TRUE(Actions::Test(Is('a') > Is(SPEG_NUL) > Is(L'\xE9') > End()
+        , Bounded("a\0\xE9", 3), SPEG_BYTES));
+
+  // the literals with characters above 127 are sought byte by byte
+  ASSERT_EQ(Actions::SearchAndGetIndex(Is("\xC3\xA9t\xC3\xA9s")
+        , "les \xE9t\xE9s", SPEG_BYTES), 4u);
+  ASSERT_EQ(Actions::SearchAndGetIndex(Is("\xC3\xA9!"), "abc\xE9!"
+        , SPEG_BYTES), 3u);
+  ASSERT_EQ(Actions::SearchAndGetIndex(Is("\xC3\xA9!")
+        , Bounded("abc\xE9!", 4), SPEG_BYTES), (size_t)-1);
+
+  Rule upper = +Between(L'\xC0', L'\xDE') > Is(' ') > End();
+  Rule rules[] = { upper, Compile(upper), Determinize(upper)
+        , Optimize(upper) };
+  for (size_t i = 0; i < sizeof(rules) / sizeof(rules[0]); i++) {
+    ASSERT_TRUE(StringozziA(rules[i]).Test("\xC0\xC9\xDE ", SPEG_BYTES))
+          << i;
+    ASSERT_TRUE(StringozziA(rules[i]).Test("\xE0\xE9\xFE "
+          , SPEG_BYTES | SPEG_CASEINSENSITIVE)) << i;
+    ASSERT_FALSE(StringozziA(rules[i]).Test("\xC0\xDF ", SPEG_BYTES)) << i;
+    ASSERT_TRUE(StringozziA(rules[i]).Test("\xC3\x89 ")) << i;
+    ASSERT_EQ(StringozziA(rules[i]).SearchAndGetIndex("ab\xC9 "
+          , SPEG_BYTES), 2u) << i;
+  }
+
+  ASSERT_TRUE(Static::Test<SPEG_BYTES>(Static::Is("caf\xC3\xA9")
+        > Static::End(), "caf\xE9"));
+}
+
+TEST(Actions, TestValidate) {
+  ASSERT_TRUE(Actions::Test(Is("caf\xC3\xA9") > End(), "caf\xC3\xA9"
+        , SPEG_VALIDATE));
+  ASSERT_TRUE(Actions::Test(Is("CAF\xC3\x89") > End(), "caf\xC3\xA9"
+        , SPEG_VALIDATE | SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(Actions::Test(Is("GET ") > +Any(), "GET /", SPEG_VALIDATE));
+  ASSERT_TRUE(Actions::Test(Is('a') > Is(SPEG_NUL) > Is("\xC3\xA9") > End()
+        , Bounded("a\0\xC3\xA9", 4), SPEG_VALIDATE));
+
+  // an invalid text is reported instead of being decoded
+  ASSERT_FALSE(Actions::Test(Any() > Any() > End(), "\xC3\x28"
+        , SPEG_VALIDATE));
+  ASSERT_FALSE(Actions::Test(End(), "\xFF", SPEG_VALIDATE));
+  ASSERT_FALSE(Actions::Search(Is('b'), "b\xFF", SPEG_VALIDATE));
+  ASSERT_EQ(Actions::Test(Any(), "\xED\xA0\x80", Limits(100), SPEG_VALIDATE)
+        , ST_INVALID);
+  ASSERT_EQ(Actions::Search(Any(), "\xFF", Limits(100), SPEG_VALIDATE)
+        , ST_INVALID);
+  MatchesA m;
+  ASSERT_EQ(Actions::Match(Any(), "a\xFF", m, Limits(100), SPEG_VALIDATE)
+        , ST_INVALID);
+  string out = "unset";
+  ASSERT_EQ(Actions::Replace(Is('a'), "a\xFF", "b", &out, Limits(100)
+        , SPEG_VALIDATE), ST_INVALID);
+  ASSERT_EQ(out, "unset");
+  vector<string> parts;
+  ASSERT_EQ(Actions::Split(Is(','), "a,\xFF", parts, Limits(100)
+        , SPEG_VALIDATE), ST_INVALID);
+  ASSERT_TRUE(parts.empty());
+
+  // SPEG_BYTES texts are not UTF-8
+  ASSERT_TRUE(Actions::Test(Any() > End(), "\xFF"
+        , SPEG_VALIDATE | SPEG_BYTES));
+}
+
 TEST(Actions, TestSearch) {
   const char* str = "osaama";
   str = Actions::SearchAndGetPtr(Is('a'), str);
@@ -557,6 +915,67 @@ TEST(Primitives, TestAny) {
   ASSERT_FALSE(Actions::Test(Any(), ""));
 }
 
+// a context implemented outside the library, it is run through the
+// virtual functions of the interface
+class ForwardingContext : public Core::ContextInterface {
+  Core::ContextA _context;
+
+ public:
+  explicit ForwardingContext(const char* str, unsigned long flags = 0)
+    : _context(str, flags) {}
+  virtual bool Forward() { return _context.Forward(); }
+  virtual bool Backward() { return _context.Backward(); }
+  virtual bool BOT() { return _context.BOT(); }
+  virtual bool EOT() { return _context.EOT(); }
+  virtual Utils::Flags& Flags() { return _context.Flags(); }
+  virtual int Compare(SChar chr) { return _context.Compare(chr); }
+  virtual SChar Get() { return _context.Get(); }
+  virtual Core::Position GetPosition() { return _context.GetPosition(); }
+  virtual void SetPosition(Core::Position pos) { _context.SetPosition(pos); }
+  virtual void AddMatch(Core::Position start) { _context.AddMatch(start); }
+  virtual void AddMatch(const char* key, Core::Position start) {
+    _context.AddMatch(key, start);
+  }
+  virtual unsigned int NumberOfMatches(const char* key) {
+    return _context.NumberOfMatches(key);
+  }
+  virtual void SetVar(const char* vname, const char* vval) {
+    _context.SetVar(vname, vval);
+  }
+  virtual bool GetVar(const char* vname, char const ** vval) {
+    return _context.GetVar(vname, vval);
+  }
+  virtual bool DelVar(const char* vname) { return _context.DelVar(vname); }
+  virtual Core::Position AdjustPosition() {
+    return _context.AdjustPosition();
+  }
+};
+
+TEST(Primitives, TestCustomContext) {
+  ASSERT_EQ(Core::ContextA("", 0).Kind(), Core::CK_CHAR);
+  ASSERT_EQ(Core::ContextW(L"", 0).Kind(), Core::CK_WCHAR);
+  ASSERT_EQ(ForwardingContext("").Kind(), Core::CK_CUSTOM);
+
+  Rule rule = Is("GET") > Is(' ') > +Between('a', 'z') > In("?#")
+        > Any() > (Literals(Is("ab") | Is("cd")) | *Digit()) > End();
+  Rule rules[] = { rule, Compile(rule) };
+  const char* texts[] = { "GET index?xab", "GET index#x42", "GET index?x" };
+  for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); r++) {
+    for (size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+      unsigned long flags[] = { 0, SPEG_ITERATIVE };
+      for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+        ForwardingContext custom(texts[t], flags[f]);
+        Core::ContextA direct(texts[t], flags[f]);
+        ASSERT_TRUE(rules[r].Get()->Check(&custom));
+        ASSERT_TRUE(rules[r].Get()->Check(&direct));
+        ASSERT_EQ(custom.GetPosition(), direct.GetPosition());
+      }
+    }
+    ForwardingContext custom("GET index?xyz");
+    ASSERT_FALSE(rules[r].Get()->Check(&custom));
+  }
+}
+
 TEST(Primitives, TestRuleConstructor) {
   ASSERT_FALSE(Actions::Test(Rule(), "A"));
   ASSERT_FALSE(Actions::Test(Rule(), "a"));
@@ -580,6 +999,1205 @@ TEST(Manipulators, TestCallbackValidator) {
 }
 
 
+// the rules every engine is compared with the tree on, the tests of an
+// engine add the ones it treats in its own way
+void SameRules(vector<Rule>* rules) {
+  Utils::PlaceHolder ph;
+  Rule nested = Is('(') > *(Out("()") | Ref(ph)) > Is(')');
+  ph.Inject(nested);
+
+  Rule shared[] = { IPv4() > End(), IPv6() > End(), Host() > End()
+        , Scientific(), nested, (Is("Via") | Is('V')) > End()
+        , Is('V') || Is("Via"), Beginning() > Is("B") > Is("B") > End()
+        , Until(Is("HTTP")) > Is("HTTP/") > Natural()
+        , Not(Digit()) > Any() > ~Is('1') > 2 * Digit()
+        , Range(1, 3) * Is("A") > End(), Rule() };
+  rules->assign(shared, shared + sizeof(shared) / sizeof(shared[0]));
+}
+
+// the texts the rules are parsed on
+vector<string> SameInputs() {
+  const char* shared[] = { "", "GET /index.html HTTP/1.1\r\n"
+        , "  GET / HTTP/1.1\r\n", "get /a?b=c HTTP/1.0\r\n", "xx HTTP/2"
+        , "172.76.22.67", "2001:db8:3:4:f2::192.0.2.33", "www.example.com"
+        , "(fdkjfd(fdj(d))jds(xx))", "4.5557e+12", "Via", "V", "  B B", "BB"
+        , "AAA", "x123", "12ab:", "#$%abc", "aaa:ccc bbb dddd"
+        , "\xC3\xA9" "a\xC3\xA9" };
+  return vector<string>(shared, shared + sizeof(shared) / sizeof(shared[0]));
+}
+
+// the modes the rules are parsed in
+const unsigned long SAME_FLAGS[] = { 0, SPEG_CASEINSENSITIVE
+      , SPEG_IGNORESPACES, SPEG_MEMOIZE, SPEG_MATCHNAMED | SPEG_MATCHUNNAMED
+      , SPEG_BYTES, SPEG_VALIDATE };
+
+// the engine built from the tree finds the same as the tree, it is run
+// with the extra flags on top
+void AssertSameAsTree(StringozziA* tree, StringozziA* engine
+    , const char* str, unsigned long flags, unsigned long extra = 0) {
+  MatchesA expected;
+  MatchesA actual;
+  ASSERT_EQ(tree->Test(str, flags), engine->Test(str, flags | extra))
+        << str << " in mode " << flags;
+  ASSERT_EQ(tree->SearchAndGetPtr(str, flags)
+        , engine->SearchAndGetPtr(str, flags | extra))
+        << str << " in mode " << flags;
+  ASSERT_EQ(tree->Match(str, expected, flags)
+        , engine->Match(str, actual, flags | extra))
+        << str << " in mode " << flags;
+  ASSERT_EQ(expected.NumberOfMatches(), actual.NumberOfMatches())
+        << str << " in mode " << flags;
+}
+
+void AssertSameAsTree(const Rule& tree, const Rule& engine, const char* str
+    , unsigned long flags, unsigned long extra = 0) {
+  StringozziA expected(tree);
+  StringozziA actual(engine);
+  AssertSameAsTree(&expected, &actual, str, flags, extra);
+}
+
+void AssertSameAsTree(const Rule& tree, const Rule& engine
+    , const vector<string>& inputs, unsigned long extra = 0) {
+  StringozziA expected(tree);
+  StringozziA actual(engine);
+  for (size_t i = 0; i < inputs.size(); i++) {
+    for (size_t f = 0; f < sizeof(SAME_FLAGS) / sizeof(SAME_FLAGS[0]); f++) {
+      AssertSameAsTree(&expected, &actual, inputs[i].c_str(), SAME_FLAGS[f]
+            , extra);
+    }
+  }
+}
+
+// the program compiled from the rule, run recursively, iteratively and
+// memoized
+void AssertSameAsCompiled(const Rule& rule, const char* str
+    , unsigned long flags = 0) {
+  Rule compiled = rule.Compile();
+  AssertSameAsTree(rule, compiled, str, flags);
+  AssertSameAsTree(rule, compiled, str, flags, SPEG_ITERATIVE);
+  AssertSameAsTree(rule, compiled, str, flags, SPEG_ITERATIVE | SPEG_MEMOIZE);
+}
+
+void AssertSameAsCompiled(const Rule& rule, const vector<string>& inputs) {
+  Rule compiled = rule.Compile();
+  AssertSameAsTree(rule, compiled, inputs);
+  AssertSameAsTree(rule, compiled, inputs, SPEG_ITERATIVE);
+  AssertSameAsTree(rule, compiled, inputs, SPEG_ITERATIVE | SPEG_MEMOIZE);
+}
+
+TEST(Engine, TestCompiledRule) {
+  vector<Rule> rules;
+  SameRules(&rules);
+  Rule own[] = { Any() > InChain() > InChain() > End()
+        , (Is('a') & LookBack(Is("aa"))), Is(':') & LookBack(Is("aaa"))
+        , Set("VAR") > If("VAR") > Is('O'), Is('O') > CaseInsensitive()
+        > Is('o') > CaseSensitive() > Is('O')
+        , (*((Is('O') >> "O") | (Is('K') >> "K") | Is('S'))) > End()
+        > IfMatched("O", 3), Until(Is("HTTP")) > SkipTo(2) > Is("TP")
+        , Symbol() };
+  rules.insert(rules.end(), own, own + sizeof(own) / sizeof(own[0]));
+  vector<string> inputs = SameInputs();
+  inputs.push_back("ABC");
+  inputs.push_back("OOOS");
+
+  for (size_t r = 0; r < rules.size(); r++)
+    AssertSameAsCompiled(rules[r], inputs);
+
+  // the phrases of the sequence are fused and the class is matched in 
+  // place unless spaces are skipped or unnamed matches are recorded, 
+  // \xE2\x84\xAA is the Kelvin sign folded into 'k'
+  Rule header = +(Is("Keep") > Is("-Alive: ") > +Digit() > Is(';'))
+        > Out(" ;") > End();
+  const char* headers[] = { "Keep-Alive: 42;x", "keep-alive: 4;x"
+        , "\xE2\x84\xAA" "eep-Alive: 42;x", "Keep -Alive:  42 ; x"
+        , "Keep-Alive: 42;;", "Keep-Alive: " };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHUNNAMED, SPEG_CASEINSENSITIVE | SPEG_BYTES };
+  for (size_t i = 0; i < sizeof(headers) / sizeof(headers[0]); i++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++)
+      AssertSameAsCompiled(header, headers[i], flags[f]);
+  }
+  ASSERT_TRUE(Actions::Test(Compile(header), headers[2]
+        , SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(Actions::Test(Compile(header), headers[3], SPEG_IGNORESPACES));
+
+  // the search skips the characters its rule cannot start with in the 
+  // case mode of the text
+  Rule method = +CapitalAlphabet() > Is(' ') > Is('/');
+  const char* lines[] = { "host: x\r\nget /", "Host: x\r\nGET /", "GET/"
+        , "\xC3\xA9t\xC3\xA9 GET /", "" };
+  unsigned long modes[] = { 0, SPEG_CASEINSENSITIVE, SPEG_BYTES
+        , SPEG_CASEINSENSITIVE | SPEG_BYTES, SPEG_IGNORESPACES };
+  for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+    for (size_t f = 0; f < sizeof(modes) / sizeof(modes[0]); f++)
+      AssertSameAsCompiled(method, lines[i], modes[f]);
+  }
+  ASSERT_EQ(lines[0] + 9, StringozziA(Compile(method)).SearchAndGetPtr(
+        lines[0], SPEG_CASEINSENSITIVE));
+  ASSERT_EQ(NULL, StringozziA(Compile(method)).SearchAndGetPtr(lines[0]));
+}
+
+TEST(Engine, TestCompiledMatch) {
+  MatchesA m;
+  Rule rule = Compile((*(Is("o") >> "O")) > (Extract(Is("s"), "S"))
+          > (Extract(Is("j"))) > End());
+  ASSERT_TRUE(StringozziA(rule).Match("   OOO  SJ    "
+          , m, SPEG_CASEINSENSITIVE | SPEG_IGNORESPACES));
+  ASSERT_EQ(m.NumberOfMatches(), 4);
+  ASSERT_EQ(m.NumberOfMatches("O"), 3);
+  ASSERT_STREQ(m.Get("S", 0), "S");
+  MatchesA iterative;
+  ASSERT_TRUE(StringozziA(rule).Match("   OOO  SJ    ", iterative
+          , SPEG_CASEINSENSITIVE | SPEG_IGNORESPACES | SPEG_ITERATIVE));
+  ASSERT_EQ(iterative.NumberOfMatches(), 4);
+  ASSERT_EQ(iterative.NumberOfMatches("O"), 3);
+  ASSERT_TRUE(Actions::Test(Compile(CallBack(Is("A"), CallBackFunction
+          , NULL)), "AB"));
+  ASSERT_TRUE(Actions::Test(Compile(Compile(Is("AB")) > End()), "AB"));
+}
+
+TEST(Engine, TestIterative) {
+  PlaceHolder ph;
+  Rule nested = Is('(') > *(Out("()") | Ref(ph)) > Is(')');
+  ph.Inject(nested);
+  Rule compiled = Compile(nested > End());
+
+  // far deeper than the thread stack allows to recurse
+  string deep = string(100000, '(') + "x" + string(100000, ')');
+  ASSERT_TRUE(Actions::Test(compiled, deep.c_str(), SPEG_ITERATIVE));
+  ASSERT_TRUE(Actions::Test(compiled, deep.c_str()
+        , SPEG_ITERATIVE | SPEG_MEMOIZE));
+  deep.erase(deep.size() - 1);
+  ASSERT_FALSE(Actions::Test(compiled, deep.c_str(), SPEG_ITERATIVE));
+  ASSERT_EQ(StringozziA(compiled).Test(deep.c_str(), Limits(1000)
+        , SPEG_ITERATIVE), ST_EXCEEDED);
+
+  ASSERT_TRUE(Actions::Test(Compile((Is('a') || Is("aa")) > End()), "aa"
+        , SPEG_ITERATIVE));
+  ASSERT_FALSE(Actions::Test(Compile((Is('a') | Is("aa")) > End()), "aa"
+        , SPEG_ITERATIVE));
+  ASSERT_TRUE(Actions::Test(Compile(Range(2, 3) * Is("ab") > End())
+        , "ababab", SPEG_ITERATIVE));
+  ASSERT_FALSE(Actions::Test(Compile(Range(2, 3) * Is("ab") > End())
+        , "ab", SPEG_ITERATIVE));
+}
+
+// the rules Stringozzi.Generated.h is generated from
+void GeneratedRules(vector<pair<string, Rule> >* rules) {
+  Utils::PlaceHolder ph;
+  Rule nested = Is('(') > *(Out("()") | Ref(ph)) > Is(')');
+  ph.Inject(nested);
+
+  rules->push_back(make_pair("GeneratedRequestLine", +CapitalAlphabet()
+        > Is(' ') > +Out(" \r\n") > Is(' ') > Is("HTTP/") > Digit()
+        > Is('.') > Digit() > Is("\r\n")));
+  rules->push_back(make_pair("GeneratedHost", Host()));
+  rules->push_back(make_pair("GeneratedNested", nested));
+  rules->push_back(make_pair("GeneratedMethods", Literals(Is("GET")
+        | Is("GETS") | Is("POST") | Is("PUT")) > End()));
+  rules->push_back(make_pair("GeneratedScan", (Until(Is("HTTP"))
+        > Is("HTTP")) || Memoize(Any() > InChain())));
+  rules->push_back(make_pair("GeneratedLookBack"
+        , Is(':') & LookBack(Is("aaa"))));
+  rules->push_back(make_pair("GeneratedState", Set("V", "x\"y")
+        > If("V", "x\"y") > Del("V") > (Is('O') >> "O") > CaseInsensitive()
+        > Is('o') > CaseSensitive() > IfMatched("O", 1)));
+  rules->push_back(make_pair("GeneratedCommit", ((Is("GET") > Commit()
+        > Is(' ')) | Is("GETS") | Is("PUT")) > ((Is('a') > Commit()
+        > Is('b')) || Is("ac") || Any())));
+  rules->push_back(make_pair("GeneratedGreek", +(Script("Greek")
+        | Category("Nd")) > UnicodeWhiteSpace() > Category("Lu")));
+}
+
+TEST(Engine, TestGenerate) {
+  vector<pair<string, Rule> > rules;
+  GeneratedRules(&rules);
+  string source;
+  for (size_t i = 0; i < rules.size(); i++) {
+    string generated;
+    ASSERT_TRUE(Generate(rules[i].second, rules[i].first.c_str()
+          , &generated));
+    source += generated;
+  }
+
+  // the checked in header is kept in sync with the generator
+  string path = __FILE__;
+  path = path.substr(0, path.find_last_of("/\\") + 1)
+        + "Stringozzi.Generated.h";
+  std::ifstream file(path.c_str(), std::ios::binary);
+  std::stringstream content;
+  content << file.rdbuf();
+  // the first line that differs is reported
+  const string checked = content.str();
+  size_t at = 0;
+  while (at < checked.size() && at < source.size()
+        && checked[at] == source[at])
+    at++;
+  size_t begin = at ? checked.rfind('\n', at - 1) + 1 : 0;
+  size_t line = std::count(checked.begin(), checked.begin() + begin, '\n');
+  ASSERT_TRUE(checked == source) << path
+        << " is out of sync with the generator at line " << line + 1
+        << "\n  checked in: "
+        << checked.substr(begin, checked.find('\n', begin) - begin)
+        << "\n  generated:  "
+        << source.substr(begin, source.find('\n', begin) - begin);
+
+  string ignored;
+  ASSERT_FALSE(Generate(CallBack(Is('A'), CallBackFunction, NULL), "X"
+        , &ignored));
+  Utils::PlaceHolder ph;
+  ASSERT_FALSE(Generate(Is('A') > Ref(ph), "X", &ignored));
+}
+
+TEST(Engine, TestSkip) {
+  Core::ContextA plain("HTTP/1.1", 0);
+  ASSERT_FALSE(plain.Skip("HTTPS", 5));
+  ASSERT_EQ(plain.Get(), 'H');
+  ASSERT_TRUE(plain.Skip("HTTP/", 5));
+  ASSERT_EQ(plain.Get(), '1');
+  ASSERT_FALSE(plain.Skip("1.1 ", 4));
+
+  Core::ContextA bounded(Utils::Text<char>("HTTP/1.1", 4), 0);
+  ASSERT_FALSE(bounded.Skip("HTTP/", 5));
+  ASSERT_TRUE(bounded.Skip("HTTP", 4));
+  ASSERT_TRUE(bounded.EOT());
+
+  // the Kelvin sign is a k in case insensitive mode
+  Core::ContextA folded("\xE2\x84\xAA" "ey", SPEG_CASEINSENSITIVE);
+  ASSERT_TRUE(folded.Skip("KEY", 3));
+  ASSERT_TRUE(folded.EOT());
+
+  Core::ContextW wide(L"GET /", 0);
+  ASSERT_TRUE(wide.Skip("GET ", 4));
+  ASSERT_EQ(wide.Get(), '/');
+
+  Core::ContextA limited(Utils::Text<char>("GET /"), 0
+        , Utils::Budget(Utils::Limits(2)));
+  ASSERT_FALSE(limited.Skip("GET", 3));
+  ASSERT_TRUE(limited.Exceeded());
+}
+
+TEST(Engine, TestGeneratedRule) {
+  vector<string> inputs = SameInputs();
+  const char* own[] = { "gets", "GETS", "POSTS", "PUT", "OoO", "Ooo", "ABC"
+        , "GET ab", "GET ac", "PUTac", "PUTx"
+        , "\xCE\x91\xCE\xB2\xCF\x83" "3\xE2\x80\x83\xCE\xA3"
+        , "\xCE\xB1 \xCF\x82", "1\t\xC2\xB5" };
+  inputs.insert(inputs.end(), own, own + sizeof(own) / sizeof(own[0]));
+  vector<pair<string, Rule> > rules;
+  GeneratedRules(&rules);
+
+  // in the order of GeneratedRules()
+  Rule generated[] = { new GeneratedRequestLine::Validator()
+        , new GeneratedHost::Validator(), new GeneratedNested::Validator()
+        , new GeneratedMethods::Validator(), new GeneratedScan::Validator()
+        , new GeneratedLookBack::Validator(), new GeneratedState::Validator()
+        , new GeneratedCommit::Validator(), new GeneratedGreek::Validator() };
+  ASSERT_EQ(rules.size(), sizeof(generated) / sizeof(generated[0]));
+  for (size_t r = 0; r < rules.size(); r++)
+    AssertSameAsTree(rules[r].second, generated[r], inputs);
+  ASSERT_TRUE(GeneratedRequestLine::Test("GET / HTTP/1.1\r\n"));
+  ASSERT_TRUE(GeneratedMethods::Test("put", SPEG_CASEINSENSITIVE));
+  ASSERT_FALSE(GeneratedMethods::Test("put"));
+}
+
+void CountFunction(Core::Position start
+	, Core::Position end
+	, void* context)
+{
+	(*(int*)context)++;
+}
+
+TEST(Manipulators, TestMemoize) {
+  int count = 0;
+  PlaceHolder ph;
+  Rule inner = Is('(') > Ref(ph) > Is(')');
+  Rule nested = CallBack((inner > Is('a')) | (inner > Is('b')) | Is('x')
+        , CountFunction, &count);
+  ph.Inject(nested);
+  const char* str = "((((((((((((x)b)b)b)b)b)b)b)b)b)b)b)b";
+
+  ASSERT_TRUE(Actions::Test(nested > End(), str));
+  ASSERT_EQ(count, 8191);
+
+  count = 0;
+  ASSERT_TRUE(Actions::Test(nested > End(), str, SPEG_MEMOIZE));
+  ASSERT_EQ(count, 13);
+
+  count = 0;
+  ASSERT_TRUE(Actions::Test(Compile(nested > End()), str, SPEG_MEMOIZE));
+  ASSERT_EQ(count, 13);
+
+  count = 0;
+  PlaceHolder ph2;
+  Rule inner2 = Is('(') > Ref(ph2) > Is(')');
+  Rule selected = Memoize(CallBack((inner2 > Is('a')) | (inner2 > Is('b'))
+        | Is('x'), CountFunction, &count));
+  ph2.Inject(selected);
+  ASSERT_TRUE(Actions::Test(selected > End(), str));
+  ASSERT_EQ(count, 13);
+  ASSERT_FALSE(Actions::Test(selected > End(), "((x)b)c"));
+}
+
+TEST(Manipulators, TestMemoizeMatches) {
+  Rule item = (Is('k') >> "K") > Is(':') > ((+Digit() >> "V") | Is('x'));
+  Rule rule = (item > Is(';') > Is('!')) | (item > Is(';')) | item;
+  const char* inputs[] = { "k:12;", "  k:5;!", "k:x", "k:", "k:7", "" };
+
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    MatchesA plain;
+    MatchesA memo;
+    ASSERT_EQ(StringozziA(rule).Match(inputs[i], plain)
+          , StringozziA(rule).Match(inputs[i], memo, SPEG_MEMOIZE));
+    ASSERT_EQ(plain.NumberOfMatches("K"), memo.NumberOfMatches("K"));
+    ASSERT_EQ(plain.NumberOfMatches("V"), memo.NumberOfMatches("V"));
+    ASSERT_EQ(plain.NumberOfMatches(MATCHES_TOKEN)
+          , memo.NumberOfMatches(MATCHES_TOKEN));
+    if (plain.NumberOfMatches("V")) {
+      ASSERT_STREQ(plain.Get("V"), memo.Get("V"));
+    }
+  }
+
+  Core::ContextA context("k:1;", SPEG_MEMOIZE);
+  ASSERT_TRUE(Memoize(rule).Check(&context));
+}
+
+TEST(Manipulators, TestMemoizeVariables) {
+  Rule g = Memoize(If("V", "x") > Is('a'));
+  Rule rule = (g > Is('!')) | (Set("V", "x") > g > End());
+  ASSERT_TRUE(Actions::Test(rule, "a"));
+  ASSERT_TRUE(Actions::Test(rule, "a", SPEG_MEMOIZE));
+  ASSERT_TRUE(Actions::Test(Compile(rule), "a"));
+  ASSERT_TRUE(Actions::Test(Compile(rule), "a", SPEG_MEMOIZE | SPEG_ITERATIVE));
+  ASSERT_FALSE(Actions::Test(rule, "a!"));
+
+  PlaceHolder ph;
+  Rule ref = Ref(ph);
+  Rule refs = (ref > Is('!')) | (Set("V", "x") > ref > End());
+  Rule choice = (If("V", "x") > Is('a')) | Is('b');
+  ph.Inject(choice);
+  ASSERT_TRUE(Actions::Test(refs, "a", SPEG_MEMOIZE));
+  ASSERT_TRUE(Actions::Test(Compile(refs), "a", SPEG_MEMOIZE));
+  ASSERT_TRUE(Actions::Test(Compile(refs), "a", SPEG_MEMOIZE | SPEG_ITERATIVE));
+
+  ASSERT_TRUE(Analysis::Stateful(g.Get()));
+  ASSERT_FALSE(Analysis::Stateful((Is('a') | Is('b')).Get()));
+}
+
+TEST(Analysis, TestFirstSet) {
+  Analysis::FirstSet set = Analysis::First((Is("GET") | Is("post")).Get());
+  ASSERT_TRUE(set.Contains('G'));
+  ASSERT_TRUE(set.Contains('g'));
+  ASSERT_TRUE(set.Contains('P'));
+  ASSERT_FALSE(set.Contains('E'));
+  ASSERT_FALSE(set.Nullable);
+  ASSERT_TRUE(set.Pure);
+
+  set = Analysis::First((~Is('-') > Digit()).Get());
+  ASSERT_TRUE(set.Contains('-'));
+  ASSERT_TRUE(set.Contains('7'));
+  ASSERT_FALSE(set.Contains('+'));
+  ASSERT_FALSE(set.Nullable);
+
+  set = Analysis::First((Between(0x100, 0x200) & Any()).Get());
+  ASSERT_TRUE(set.Beyond);
+  ASSERT_FALSE(set.Contains('a'));
+
+  ASSERT_TRUE(Analysis::First((*Is('a')).Get()).Nullable);
+  ASSERT_FALSE(Analysis::First((Is('a') >> "A").Get()).Pure);
+  ASSERT_TRUE(Analysis::First(Until(Is('a')).Get()).Contains('z'));
+}
+
+void NoOpFunction(Core::Position start
+	, Core::Position end
+	, void* context)
+{
+}
+
+TEST(Analysis, TestDispatch) {
+  // callbacks are not pure, so the alternatives wrapped in them are never 
+  // skipped and the rule behaves as it has no jump table
+  Rule alternatives[] = { Is("GET"), Is("POST"), Is("PUT") > ~Is('S')
+        , In("xyz") >> "XYZ", *Digit(), Is('P') > Is("ATCH") };
+  Rule pruned = Rule(Is("\t")) || alternatives[0];
+  Rule tried = CallBack(Is("\t"), NoOpFunction, NULL)
+        || CallBack(alternatives[0], NoOpFunction, NULL);
+  for (size_t i = 1; i < sizeof(alternatives) / sizeof(alternatives[0]); i++) {
+    pruned = pruned | alternatives[i];
+    tried = tried | CallBack(alternatives[i], NoOpFunction, NULL);
+  }
+  ASSERT_TRUE(static_cast<Manipulators::OrValidator*>(pruned.Get())
+          ->Choices().Active());
+
+  const char* inputs[] = { "GET /", "post", "PUTS", "PATCH", "x", "12", ""
+        , "  PUT", "\xC3\x89", "patch" };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES };
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      ASSERT_EQ(StringozziA(pruned).SearchAndGetPtr(inputs[i], flags[f])
+            , StringozziA(tried).SearchAndGetPtr(inputs[i], flags[f]));
+      MatchesA prunedMatches;
+      MatchesA triedMatches;
+      ASSERT_EQ(StringozziA(pruned > End()).Match(inputs[i], prunedMatches
+            , flags[f]), StringozziA(tried > End()).Match(inputs[i]
+            , triedMatches, flags[f]));
+      ASSERT_EQ(prunedMatches.NumberOfMatches(MATCHES_TOKEN)
+            , triedMatches.NumberOfMatches(MATCHES_TOKEN));
+      ASSERT_EQ(prunedMatches.NumberOfMatches("XYZ")
+            , triedMatches.NumberOfMatches("XYZ"));
+      AssertSameAsCompiled(pruned, inputs[i], flags[f]);
+    }
+  }
+  ASSERT_TRUE(Actions::Test(IPv6() > End(), "2001:db8:3:4:f2::192.0.2.33"));
+  ASSERT_TRUE(Actions::Test(CaseInsensitive() > (Is("get") | Is("put"))
+        , "PUT"));
+  ASSERT_FALSE(Actions::Test(CaseSensitive() > (Is("get") | Is("put"))
+        , "PUT", SPEG_CASEINSENSITIVE));
+
+  // the links of a long chain are merged before they are ever parsed, only
+  // the final choice is analyzed
+  Rule headers = Is("X-Header-0:");
+  for (unsigned int i = 1; i < 1600; i++) {
+    char name[32];
+    sprintf(name, "X-Header-%u:", i);
+    headers = headers | Is(static_cast<const char*>(name));
+  }
+  ASSERT_EQ(static_cast<Core::NaryValidator*>(headers.Get())->Count(), 1600u);
+  ASSERT_TRUE(Actions::Test(headers, "X-Header-1599: x"));
+  ASSERT_TRUE(Actions::Test(headers, "x-header-17: x", SPEG_CASEINSENSITIVE));
+  ASSERT_FALSE(Actions::Test(headers, "X-Header-1600: x"));
+  ASSERT_FALSE(Actions::Test(headers, "Y-Header-1: x"));
+}
+
+TEST(Analysis, TestPrefix) {
+  vector<SChar> prefix = Analysis::Prefix((Is("Content") > Is('-')
+        > Is("Length:") > +Digit()).Get());
+  ASSERT_EQ(prefix.size(), 15);
+  ASSERT_EQ(prefix[7], '-');
+  prefix = Analysis::Prefix((Is("Content") > Is('-')).Get(), false);
+  ASSERT_EQ(prefix.size(), 7);
+  prefix = Analysis::Prefix(((Is("ab") >> "AB") > Is('c')).Get());
+  ASSERT_EQ(prefix.size(), 2);
+  ASSERT_TRUE(Analysis::Prefix((Set("A") > Is("ab")).Get()).empty());
+  ASSERT_TRUE(Analysis::Prefix((*Is("ab")).Get()).empty());
+  ASSERT_TRUE(Analysis::Prefix((Is("ab") | Is("ac")).Get()).empty());
+}
+
+TEST(Actions, TestSearchByPrefix) {
+  // a leading negation has no literal, so it searches character by 
+  // character
+  Rule rules[] = { Is("Content-Length:") > *WhiteSpace() > +Digit()
+        , Is("\xE2\x82\xAC") > Digit(), Is("ab") > Is('c')
+        , (Is("ab") >> "AB") > Is('c') };
+  const char* inputs[] = { "Host: x\r\nContent-Length: 12\r\n"
+        , "content-length:5 Content-Length:6", "\xE2\x82\xAC \xE2\x82\xAC" "7"
+        , "ababd abc", "", "Content-Length:" };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHNAMED | SPEG_MATCHUNNAMED };
+
+  for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); r++) {
+    Rule plain = Not(Is('\x01')) > rules[r];
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+      for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++)
+        AssertSameAsTree(plain, rules[r], inputs[i], flags[f]);
+      MatchesA matches;
+      MatchesA plainMatches;
+      Core::ContextA context(inputs[i], SPEG_MATCHNAMED);
+      Core::ContextA plainContext(inputs[i], SPEG_MATCHNAMED);
+      ASSERT_EQ(Until(rules[r]).Check(&context)
+            , Until(plain).Check(&plainContext));
+      ASSERT_EQ(context.Matches().NumberOfMatches("AB")
+            , plainContext.Matches().NumberOfMatches("AB"));
+    }
+  }
+
+  std::wstring text = L"x \x20AC" L"1 \x20AC\x20AC" L"2";
+  ASSERT_STREQ(StringozziW(Is(L'\x20AC') > Is(L'\x20AC') > Digit())
+        .SearchAndGetPtr(text.c_str()), L"\x20AC\x20AC" L"2");
+  ASSERT_EQ(StringozziA(Is("Length:") > Digit()).Replace("Length:1 Length:2"
+        , "L", 0, 2), "L L");
+}
+
+TEST(Utils, TestFind) {
+  vector<SChar> chars;
+  Utils::Decode("--boundary\xE2\x82\xAC", chars);
+  Utils::Literal boundary(chars);
+  ASSERT_EQ(boundary.Bytes.size(), 13);
+
+  const char* text = "x--bound --boundar--boundary\xE2\x82\xAC--boundary\xE2";
+  ASSERT_EQ(Utils::Find(text, boundary), text + 18);
+  ASSERT_EQ(Utils::Find(text + 20, boundary), (const char*)NULL);
+  ASSERT_EQ(Utils::Find("", boundary), (const char*)NULL);
+
+  const wchar_t* wtext = L"--boundar--boundary\x20AC";
+  ASSERT_EQ(Utils::Find(wtext, boundary), wtext + 9);
+  const char16_t* utext = u"--boundary--boundary\x20AC";
+  ASSERT_EQ(Utils::Find(utext, boundary), utext + 10);
+  ASSERT_EQ(Utils::Find(u"--boundary\x20AD", boundary)
+        , (const char16_t*)NULL);
+
+  std::string body(100000, 'a');
+  body += "--boundary\xE2\x82\xAC tail";
+  Rule rule = Is("--boundary\xE2\x82\xAC") > WhiteSpace() > Is("tail");
+  ASSERT_EQ(StringozziA(rule).SearchAndGetPtr(body.c_str())
+        , body.c_str() + 100000);
+  ASSERT_EQ(StringozziA(rule).SearchAndGetPtr(body.c_str()
+        , SPEG_MATCHUNNAMED), body.c_str() + 100000);
+}
+
+TEST(Primitives, TestLiterals) {
+  const char* headers[] = { "Via", "From", "To", "Call-ID", "F", "Contact"
+        , "Content-Length", "Content", "VIA" };
+  Rule trie = Literals(headers, sizeof(headers) / sizeof(headers[0]));
+  ASSERT_EQ(trie.Get()->Type(), Core::VT_TRIE);
+  ASSERT_TRUE(Actions::Test(trie > Is(':'), "Content-Length:"));
+  ASSERT_TRUE(Actions::Test(trie > Is(':'), "Content:"));
+  ASSERT_FALSE(Actions::Test(trie > Is("rom"), "From"));
+  ASSERT_TRUE(Actions::Test(trie > Is(':'), "From:"));
+  ASSERT_TRUE(Actions::Test(trie > Is(':'), "F:"));
+  ASSERT_FALSE(Actions::Test(trie, "Cal"));
+  ASSERT_FALSE(Actions::Test(trie, "via"));
+  ASSERT_TRUE(Actions::Test(trie, "via", SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(Actions::Test(trie > End(), "CALL-id", SPEG_CASEINSENSITIVE));
+
+  vector<std::wstring> words;
+  words.push_back(L"ab");
+  words.push_back(L"abc\x20AC");
+  ASSERT_TRUE(StringozziW(Literals(words) > Is(L'c')).Test(L"abc\x20AC"));
+  ASSERT_FALSE(StringozziW(Literals(words) > End()).Test(L"abc\x20AC"));
+
+  Rule choice = Is("Via") | Is("From") | Is('T') | (Is("Call-ID")
+        | Is("F")) | Is("Content") | Is("Content-Length") | Is("");
+  Rule merged = Literals(choice);
+  ASSERT_EQ(merged.Get()->Type(), Core::VT_TRIE);
+  ASSERT_EQ(Literals(Is("A") | Digit()).Get()->Type(), Core::VT_OR);
+
+  const char* inputs[] = { "Via", "From", "To", "Call-ID", "Fr", "Content-Length"
+        , "Content", "content-length", "  Call-ID", "Cont", "", "x" };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES };
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      MatchesA choiceMatches;
+      MatchesA mergedMatches;
+      ASSERT_EQ(StringozziA(choice > End()).Test(inputs[i], flags[f])
+            , StringozziA(merged > End()).Test(inputs[i], flags[f]));
+      ASSERT_EQ(StringozziA(choice).Match(inputs[i], choiceMatches, flags[f])
+            , StringozziA(merged).Match(inputs[i], mergedMatches, flags[f]));
+      ASSERT_EQ(choiceMatches.NumberOfMatches(MATCHES_TOKEN)
+            , mergedMatches.NumberOfMatches(MATCHES_TOKEN));
+      for (size_t m = 0; m < choiceMatches.NumberOfMatches(MATCHES_TOKEN); m++)
+        ASSERT_STREQ(choiceMatches.Get(MATCHES_TOKEN, m)
+              , mergedMatches.Get(MATCHES_TOKEN, m));
+      AssertSameAsCompiled(merged, inputs[i], flags[f]);
+    }
+  }
+}
+
+TEST(Primitives, TestCharClass) {
+  ASSERT_EQ((Digit() | Alphabet()).Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(Out("xyz").Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(Hex().Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(Symbol().Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(WhiteSpace().Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(In("xyz").Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(Between('a', 'f').Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ(Between("af").Get()->Type(), Core::VT_CLASS);
+  ASSERT_EQ((Is('\0') | Digit()).Get()->Type(), Core::VT_OR);
+  ASSERT_EQ((Is("ab") | Digit()).Get()->Type(), Core::VT_OR);
+  ASSERT_TRUE(Actions::Test(+Hex() > End(), "09afAF"));
+  ASSERT_FALSE(Actions::Test(+Hex() > End(), "09afAFg"));
+  ASSERT_TRUE(Actions::Test(+Alphanumeric() > End(), "09afAFg"));
+  ASSERT_FALSE(Actions::Test(Symbol(), ""));
+
+  Rule rules[] = { Digit() | Alphabet(), Out("xyz"), Hex(), Symbol()
+        , Between(0x100, 0x200) | Is('q'), Any() & !Between(0x80, 0x17F)
+        , Not(Digit()) & Between('0', 'Z'), Between('A', 'z') & In("MNmn[")
+        , Is('k') | Between('E', 'G'), Between(0x41, 0x5A) & !In("QR")
+        , WhiteSpace(), In("kS_"), Between("KS") };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHUNNAMED, SPEG_BYTES };
+  for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); r++) {
+    ASSERT_EQ(rules[r].Get()->Type(), Core::VT_CLASS);
+    Rule tree(static_cast<Primitives::CharClassValidator*>(rules[r].Get())
+          ->Tree());
+    for (SChar chr = 1; chr < 0x300; chr++) {
+      string str;
+      Utils::UTF32ToUTF8(chr, str);
+      str = " " + str + "!";
+      for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+        ASSERT_EQ(StringozziA(rules[r]).Test(str.c_str() + 1, flags[f])
+              , StringozziA(tree).Test(str.c_str() + 1, flags[f])) << chr;
+        ASSERT_EQ(StringozziA(rules[r]).Test(str.c_str(), flags[f])
+              , StringozziA(tree).Test(str.c_str(), flags[f])) << chr;
+        ASSERT_EQ(StringozziA(rules[r] > Is('!')).Test(str.c_str() + 1
+              , flags[f]), StringozziA(tree > Is('!')).Test(str.c_str() + 1
+              , flags[f])) << chr;
+      }
+    }
+  }
+}
+TEST(Primitives, TestProperties) {
+  ASSERT_EQ(Category("Lu").Get()->Type(), Core::VT_PROPERTY);
+  ASSERT_EQ((Category("L") | Is('_')).Get()->Type(), Core::VT_CLASS);
+
+  // \xC3\x89 \xC3\xA9 \xCE\xA3 \xD9\xA3 are \u00C9 \u00E9 \u03A3 and the
+  // Arabic-Indic digit three
+  ASSERT_TRUE(Actions::Test(+Category("L") > End(), "a\xC3\x89\xCE\xA3"));
+  ASSERT_FALSE(Actions::Test(+Category("L") > End(), "a1"));
+  ASSERT_TRUE(Actions::Test(Category("Lu"), "\xC3\x89"));
+  ASSERT_FALSE(Actions::Test(Category("Lu"), "\xC3\xA9"));
+  ASSERT_TRUE(Actions::Test(Category("Lu"), "\xC3\xA9", SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(Actions::Test(Category("uppercase letter"), "\xCE\xA3"));
+  ASSERT_TRUE(Actions::Test(+Category("Nd") > End(), "7\xD9\xA3"));
+  ASSERT_TRUE(Actions::Test(Category("Number"), "\xC2\xBD"));
+  ASSERT_TRUE(Actions::Test(Category("LC"), "a"));
+  ASSERT_FALSE(Actions::Test(Category("LC"), "\xD9\x85"));
+  ASSERT_TRUE(Actions::Test(Category("Lo"), "\xD9\x85"));
+  ASSERT_TRUE(Actions::Test(Category("Cn"), "\xF4\x8F\xBF\xBF"));
+  ASSERT_FALSE(Actions::Test(Category("Cc"), ""));
+  ASSERT_TRUE(Actions::Test(Category("Cc"), "\x01"));
+  ASSERT_FALSE(Actions::Test(Category("Xx"), "a"));
+  ASSERT_FALSE(Actions::Test(Category(NULL), "a"));
+
+  ASSERT_TRUE(Actions::Test(+Script("Arabic") > End()
+        , "\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7"));
+  ASSERT_TRUE(Actions::Test(Script("Arab"), "\xD9\x85"));
+  ASSERT_FALSE(Actions::Test(Script("Arabic"), "a"));
+  ASSERT_TRUE(Actions::Test(Script("latin"), "a"));
+  ASSERT_TRUE(Actions::Test(Script("Greek"), "\xCE\xA3"));
+  ASSERT_TRUE(Actions::Test(Script("Adlam"), "\xF0\x9E\xA4\x80"));
+  ASSERT_FALSE(Actions::Test(Script("Klingon"), "a"));
+
+  // \xE2\x80\x83 is the em space, \xE2\x80\x8B the zero width space
+  ASSERT_TRUE(Actions::Test(+UnicodeWhiteSpace() > End()
+        , " \t\r\n\xC2\xA0\xE2\x80\x83\xE3\x80\x80"));
+  ASSERT_FALSE(Actions::Test(UnicodeWhiteSpace(), "\xE2\x80\x8B"));
+  ASSERT_TRUE(StringozziW(+UnicodeWhiteSpace() > Category("Lu"))
+        .Test(L"\x2028\x0391"));
+
+  Rule rule = +(Script("Cyrillic") | Category("Nd")) > UnicodeWhiteSpace()
+        > Category("Lu");
+  const char* inputs[] = { "\xD0\x96\xD0\xB6\xD9\xA3 \xD0\x94"
+        , "\xD0\x96\xD0\xB6 \xD0\xB4", "1\xE2\x80\x83Q", "a Q", "" };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHUNNAMED };
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      AssertSameAsTree(rule, Compile(rule), inputs[i], flags[f]);
+      AssertSameAsTree(rule, Optimize(rule), inputs[i], flags[f]);
+      AssertSameAsTree(rule, Determinize(rule), inputs[i], flags[f]);
+    }
+  }
+  ASSERT_TRUE(StringozziA(rule).Test(inputs[0]));
+  ASSERT_FALSE(StringozziA(rule).Test(inputs[1]));
+  ASSERT_TRUE(StringozziA(rule).Test(inputs[1], SPEG_CASEINSENSITIVE));
+  ASSERT_TRUE(StringozziA(rule).Test(inputs[2]));
+  ASSERT_FALSE(StringozziA(rule).Test(inputs[3]));
+}
+
+const Core::StringValidator* Operand(const Core::StringValidator* validator) {
+  return static_cast<const Core::UnaryValidator*>(validator)->GetOperand();
+}
+
+const Core::StringValidator* Operand(const Rule& rule) {
+  return Operand(rule.Get());
+}
+
+TEST(Analysis, TestOptimize) {
+  Rule a = Is('a');
+  vector<string> report;
+  Rule rule = Optimize(!!a, 0, &report);
+  ASSERT_EQ(rule.Get()->Type(), Core::VT_LOOKAHEAD);
+  ASSERT_EQ(Operand(rule), a.Get());
+  ASSERT_EQ(report.size(), 1);
+  ASSERT_EQ(report[0], "Not(Not(x)) -> LookAhead(x)");
+  ASSERT_EQ(Optimize(!LookAhead(a)).Get()->Type(), Core::VT_NOT);
+  ASSERT_EQ(Optimize(LookAhead(!a)).Get()->Type(), Core::VT_NOT);
+
+  Rule repeats[] = { *(*a), ~(*a), *(~a), ~~a, 2 * (3 * a), *(+a), +(+a)
+        , 1 * a, 2 * (+a) };
+  unsigned int limits[][2] = { { 0, -1u }, { 0, -1u }, { 0, -1u }, { 0, 1 }
+        , { 6, 6 }, { 0, -1u }, { 1, -1u } };
+  for (size_t r = 0; r < 7; r++) {
+    rule = Optimize(repeats[r]);
+    ASSERT_EQ(rule.Get()->Type(), Core::VT_REPEAT) << r;
+    ASSERT_EQ(Operand(rule), a.Get()) << r;
+    const Manipulators::RepeatValidator* repeat =
+          static_cast<const Manipulators::RepeatValidator*>(rule.Get());
+    ASSERT_EQ(repeat->MinIterations(), limits[r][0]) << r;
+    ASSERT_EQ(repeat->MaxIterations(), limits[r][1]) << r;
+  }
+  ASSERT_EQ(Optimize(repeats[7]).Get(), a.Get());
+  ASSERT_EQ(Operand(Optimize(repeats[8]))->Type(), Core::VT_REPEAT);
+
+  report.clear();
+  rule = Optimize(Is('G') > Is('E') > Is("T ") > Digit() > Is('/') > Is('1')
+        , 0, &report);
+  ASSERT_EQ(report.size(), 2);
+  ASSERT_EQ(report[0], "Is('G') > Is('E') > Is(\"T \") -> Is(\"GET \")");
+  ASSERT_TRUE(Actions::Test(rule > End(), "GET 9/1"));
+  ASSERT_FALSE(Actions::Test(rule, "GET9/1"));
+  ASSERT_TRUE(Actions::Test(rule, "get 9/1", SPEG_CASEINSENSITIVE));
+  rule = Optimize(Is('G') > Is('E'), SPEG_IGNORESPACES);
+  ASSERT_TRUE(Actions::Test(rule, "G E", SPEG_IGNORESPACES));
+  rule = Optimize(Is("Via") | Is("From") | Is('T'));
+  ASSERT_EQ(rule.Get()->Type(), Core::VT_TRIE);
+  rule = !!a;
+  ASSERT_EQ(Optimize(rule, SPEG_MATCHUNNAMED).Get(), rule.Get());
+
+  Rule grammar[] = { IPv4(), Host() > End(), Scientific()
+        , (Is('x') > Is('y')) >> "XY" > ~~Digit() > !!Is(':')
+        , CallBack(Is('a') > Is('b'), NoOpFunction, NULL) > 2 * (2 * Hex())
+        , Compile(Is('a') > Is('b') > (Is("ab") | Is("ba")))
+        , Until(Is('a') > Is('b')) > LookBack(Is('b') > !!Is('b')) };
+  const char* inputs[] = { "", "172.76.22.67", "xy7:", "ab0a1f", "abba"
+        , "4.5557e+12", "x y7:", "xy :", "www.example.com", "cab", "ABAB" };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHNAMED };
+  for (size_t r = 0; r < sizeof(grammar) / sizeof(grammar[0]); r++) {
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+      Rule optimized = Optimize(grammar[r], flags[f]);
+      for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        MatchesA expected;
+        MatchesA actual;
+        ASSERT_EQ(StringozziA(grammar[r]).Match(inputs[i], expected, flags[f])
+              , StringozziA(optimized).Match(inputs[i], actual, flags[f]))
+              << r << inputs[i];
+        ASSERT_EQ(expected.NumberOfMatches("XY")
+              , actual.NumberOfMatches("XY"));
+        if (flags[f] & SPEG_IGNORESPACES)
+          continue;
+        ASSERT_EQ(StringozziA(grammar[r]).SearchAndGetPtr(inputs[i], flags[f])
+              , StringozziA(optimized).SearchAndGetPtr(inputs[i], flags[f]))
+              << r << inputs[i];
+      }
+    }
+  }
+}
+
+void CollectNodes(const Core::StringValidator* validator
+    , std::set<const Core::StringValidator*>* nodes) {
+  if (!nodes->insert(validator).second)
+    return;
+  switch (validator->Type()) {
+    case Core::VT_AND:
+      CollectNodes(static_cast<const Core::BinaryValidator*>(validator)
+            ->GetFirstOperand(), nodes);
+      CollectNodes(static_cast<const Core::BinaryValidator*>(validator)
+            ->GetSecondOperand(), nodes);
+      break;
+    case Core::VT_SEQ:
+    case Core::VT_OR:
+    case Core::VT_GREEDYOR: {
+      const Core::NaryValidator* nary =
+            static_cast<const Core::NaryValidator*>(validator);
+      for (size_t i = 0; i < nary->Count(); i++)
+        CollectNodes(nary->GetOperand(i), nodes);
+      break;
+    }
+    case Core::VT_NOT:
+    case Core::VT_LOOKAHEAD:
+    case Core::VT_LOOKBACK:
+    case Core::VT_UNTIL:
+    case Core::VT_REPEAT:
+    case Core::VT_EXTRACT:
+    case Core::VT_CALLBACK:
+    case Core::VT_MEMO:
+      CollectNodes(Operand(validator), nodes);
+      break;
+    case Core::VT_CLASS:
+      CollectNodes(static_cast<const Primitives::CharClassValidator*>(
+            validator)->Tree(), nodes);
+      break;
+    default:
+      break;
+  }
+}
+
+size_t CountNodes(const Rule& rule) {
+  std::set<const Core::StringValidator*> nodes;
+  CollectNodes(rule.Get(), &nodes);
+  return nodes.size();
+}
+
+TEST(Analysis, TestShare) {
+  Rule pair = Between("09") > Between("09");
+  Rule shared = Share(pair);
+  const Core::NaryValidator* seq =
+        static_cast<const Core::NaryValidator*>(shared.Get());
+  ASSERT_EQ(seq->GetOperand(0), seq->GetOperand(1));
+  ASSERT_EQ(CountNodes(pair), 5);
+  ASSERT_EQ(CountNodes(shared), 3);
+
+  Rule time = (Digit() > Digit() >> "H") > Is(':') > (Digit() > Digit()
+        >> "M") > ~(Is(':') > (Digit() > Digit() >> "S"));
+  ASSERT_LT(CountNodes(Share(time)), CountNodes(time));
+  Rule grammar[] = { IPv4(), IPv6() > End(), Host(), time
+        , (Hex() | Is("ab")) > (Hex() | Is("ab")) > (Hex() | Is("ba")) };
+  const char* inputs[] = { "", "172.76.22.67", "2001:db8:3:4:f2::192.0.2.33"
+        , "12:30:59", "12:3", "abf", "www.example.com" };
+  for (size_t r = 0; r < sizeof(grammar) / sizeof(grammar[0]); r++) {
+    shared = Share(grammar[r]);
+    // the builtins are already shared
+    ASSERT_LE(CountNodes(shared), CountNodes(grammar[r])) << r;
+    ASSERT_EQ(CountNodes(Share(shared)), CountNodes(shared)) << r;
+    ASSERT_LE(CountNodes(Optimize(grammar[r])), CountNodes(shared)) << r;
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+      MatchesA expected;
+      MatchesA actual;
+      ASSERT_EQ(StringozziA(grammar[r]).Match(inputs[i], expected
+            , SPEG_MATCHNAMED | SPEG_MATCHUNNAMED)
+            , StringozziA(shared).Match(inputs[i], actual
+            , SPEG_MATCHNAMED | SPEG_MATCHUNNAMED)) << r << inputs[i];
+      ASSERT_EQ(expected.NumberOfMatches(), actual.NumberOfMatches());
+      ASSERT_EQ(StringozziA(grammar[r]).SearchAndGetPtr(inputs[i])
+            , StringozziA(shared).SearchAndGetPtr(inputs[i]));
+    }
+  }
+}
+
+TEST(Primitives, TestBuiltins) {
+  ASSERT_EQ(Digit().Get(), Digit().Get());
+  ASSERT_EQ(IPv6().Get(), IPv6().Get());
+  ASSERT_EQ(Host().Get(), Host().Get());
+  ASSERT_EQ(End().Get(), End().Get());
+  ASSERT_EQ(CountNodes(Share(IPv6())), CountNodes(IPv6()));
+  ASSERT_EQ(CountNodes(Share(Host())), CountNodes(Host()));
+
+  // IPv4 appears once in Host, not once per IPv6 alternative
+  std::set<const Core::StringValidator*> nodes;
+  CollectNodes(Host().Get(), &nodes);
+  ASSERT_EQ(nodes.count(IPv4().Get()), 1);
+  ASSERT_LT(nodes.size(), CountNodes(IPv4()) + CountNodes(IPv6()) + 60);
+  ASSERT_TRUE(Actions::Test(IPv6() > End(), "2001:db8:3:4:f2::192.0.2.33"));
+}
+
+TEST(Utils, TestSpan) {
+  Utils::CharClass digits;
+  digits.AddRange('0', '9');
+  digits.Add(0x20AC);
+  std::string text(300, '7');
+  text += "\xE2\x82\xAC" "12x34";
+  for (size_t offset = 0; offset < 64; offset++) {
+    const char* ptr = text.c_str() + offset;
+    ASSERT_EQ(Utils::Span(&ptr, digits, -1), 300 - offset + 3);
+    ASSERT_EQ(*ptr, 'x');
+    ptr = text.c_str() + offset;
+    ASSERT_EQ(Utils::Span(&ptr, digits, 17), 17);
+    ASSERT_EQ(ptr, text.c_str() + offset + 17);
+  }
+  const char* ptr = "";
+  ASSERT_EQ(Utils::Span(&ptr, digits, -1), 0);
+  const wchar_t* wptr = L"12\x20AC" L"3a";
+  ASSERT_EQ(Utils::Span(&wptr, digits, -1), 4);
+
+  Utils::CharClass any;
+  any.AddRange(1, (SChar)-1);
+  std::string line(1000, 'a');
+  line[999] = '\x7F';
+  ptr = line.c_str();
+  ASSERT_EQ(Utils::Span(&ptr, any, -1), 1000);
+  ASSERT_EQ(*ptr, 0);
+
+  // the texts fill their allocations, a load past either edge of them is 
+  // reported by the address sanitizer
+  for (size_t length = 0; length < 100; length++) {
+    char* buffer = new char[length + 1];
+    memset(buffer, '5', length);
+    buffer[length] = 0;
+    ptr = buffer;
+    ASSERT_EQ(Utils::Span(&ptr, digits, -1), length);
+    ptr = buffer;
+    ASSERT_EQ(Utils::Span(&ptr, any, -1), length);
+    delete[] buffer;
+  }
+}
+
+// the callback hides the character class from the repetition
+Rule SpanRule(size_t index, bool opaque) {
+  Rule classes[] = { Alphanumeric(), Alphanumeric(), Digit(), Hex()
+        , Any() & !Is(':'), Any(), WhiteSpace(), Is('k') | Between(0xE0, 0xFF)
+        , Between('A', 'Z') };
+  Rule operand = opaque ? CallBack(classes[index], NoOpFunction, NULL)
+        : classes[index];
+  switch (index) {
+    case 0: return *operand;
+    case 1: return +operand > Is(':');
+    case 2: return 3 * operand;
+    case 3: return ZeroOrMore(operand, 4) > End();
+    case 4: return *operand > Is(':');
+    case 5: return *operand > End();
+    case 6: return +operand > Is('k');
+    case 7: return +operand;
+    default: return *operand > End();
+  }
+}
+
+TEST(Manipulators, TestRepeatSpan) {
+  std::string token(150, 'k');
+  token += "9\xC3\xA9:";
+  const char* inputs[] = { "", "abc123:", "12345", "fFaA", "fFaA0", "  kk"
+        , "ABCd", "KKK\xC3\xA9\xC3\xA9:", token.c_str() };
+  unsigned long flags[] = { 0, SPEG_CASEINSENSITIVE, SPEG_IGNORESPACES
+        , SPEG_MATCHUNNAMED, SPEG_BYTES };
+  for (size_t r = 0; r < 9; r++) {
+    Rule spanned = SpanRule(r, false);
+    Rule plain = SpanRule(r, true);
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+      for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+        AssertSameAsTree(plain, spanned, inputs[i], flags[f]);
+        AssertSameAsCompiled(spanned, inputs[i], flags[f]);
+      }
+    }
+  }
+  ASSERT_FALSE(Actions::Test(+Alphanumeric() > Is(':'), token.c_str()));
+  ASSERT_TRUE(Actions::Test(+(Alphanumeric() | Is(0xE9)) > Is(':')
+        , token.c_str()));
+  ASSERT_FALSE(Actions::Test(+Digit() > End(), token.c_str()));
+  ASSERT_TRUE(Actions::Test(WhiteSpaces() > Is('k'), "  \t kk"));
+  ASSERT_TRUE(Actions::Test(*Between('a', 'z') > End(), "ABCd"
+        , SPEG_CASEINSENSITIVE));
+  ASSERT_EQ(StringozziA(3 * Digit()).SearchAndGetPtr("x12 4567"), "x12 4567"
+        + 4);
+}
+template <unsigned long __FLAGS, typename __RULE>
+void AssertSameAsStatic(const Rule& rule, const Static::Expr<__RULE>& fixed) {
+  vector<string> inputs = SameInputs();
+  // \xE9 alone is not UTF-8, the static parsers read it as the runtime
+  inputs.push_back("\xE9" "a\xC9");
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const char* str = inputs[i].c_str();
+    ASSERT_EQ(StringozziA(rule).Test(str, __FLAGS)
+          , Static::Test<__FLAGS>(fixed, str)) << str;
+    ASSERT_EQ(StringozziA(rule > End()).Test(str, __FLAGS)
+          , Static::Test<__FLAGS>(fixed > Static::End(), str)) << str;
+    ASSERT_EQ(StringozziA(rule).SearchAndGetPtr(str, __FLAGS)
+          , Static::Search<__FLAGS>(fixed, str)) << str;
+  }
+  // both read the code units of UTF-16, a surrogate pair is two of them
+  const char16_t* units[] = { u"", u"\U0001F600x", u"x\U0001F600"
+        , u"V\U0001F600B" };
+  for (size_t i = 0; i < sizeof(units) / sizeof(units[0]); i++) {
+    ASSERT_EQ(StringozziU16(rule).Test(units[i], __FLAGS)
+          , Static::Test<__FLAGS>(fixed, units[i])) << i;
+    ASSERT_EQ(StringozziU16(rule).SearchAndGetPtr(units[i], __FLAGS)
+          , Static::Search<__FLAGS>(fixed, units[i])) << i;
+  }
+}
+
+template <typename __RULE>
+void AssertSameAsStatic(const Rule& rule, const Static::Expr<__RULE>& fixed) {
+  AssertSameAsStatic<0>(rule, fixed);
+  AssertSameAsStatic<SPEG_CASEINSENSITIVE>(rule, fixed);
+  AssertSameAsStatic<SPEG_BYTES>(rule, fixed);
+  AssertSameAsStatic<SPEG_BYTES | SPEG_CASEINSENSITIVE>(rule, fixed);
+  AssertSameAsStatic<SPEG_IGNORESPACES>(rule, fixed);
+  AssertSameAsStatic<SPEG_IGNORESPACES | SPEG_CASEINSENSITIVE>(rule, fixed);
+}
+
+TEST(Static, TestStaticRules) {
+  AssertSameAsStatic(+CapitalAlphabet() > Is(' ') > +Out(" \r\n") > Is(' ')
+        > Is("HTTP/") > Digit() > Is('.') > Digit() > Is("\r\n")
+        , +Static::CapitalAlphabet() > Static::Is(' ')
+        > +Static::Out(" \r\n") > Static::Is(' ') > Static::Is("HTTP/")
+        > Static::Digit() > Static::Is('.') > Static::Digit()
+        > Static::Is("\r\n"));
+  AssertSameAsStatic(IPv4(), Static::IPv4());
+  AssertSameAsStatic(Scientific(), Static::Scientific());
+  AssertSameAsStatic((Is("Via") | Is('V')) > End()
+        , (Static::Is("Via") | Static::Is('V')) > Static::End());
+  AssertSameAsStatic(Is('V') || Is("Via")
+        , Static::Is('V') || Static::Is("Via"));
+  AssertSameAsStatic(Beginning() > Is("B") > Is("B") > End()
+        , Static::Beginning() > Static::Is("B") > Static::Is("B")
+        > Static::End());
+  AssertSameAsStatic(Is(':') & LookBack(Is("aaa"))
+        , Static::Is(':') & Static::LookBack(Static::Is("aaa")));
+  AssertSameAsStatic(Until(Is("HTTP")) > Is("HTTP")
+        , Static::Until(Static::Is("HTTP")) > Static::Is("HTTP"));
+  AssertSameAsStatic(*Symbol() > Alphabet() > WordEnd()
+        , *Static::Symbol() > Static::Alphabet() > Static::WordEnd());
+  AssertSameAsStatic(Range(1, 4) * Hex() > Is(':')
+        , Range(1, 4) * Static::Hex() > Static::Is(':'));
+  AssertSameAsStatic(+In("\xC3\xA9" "a") > End()
+        , +Static::In("\xC3\xA9" "a") > Static::End());
+  AssertSameAsStatic(Not(Digit()) > Any() > ~Is('1') > 2 * Digit()
+        , Static::Not(Static::Digit()) > Static::Any() > ~Static::Is('1')
+        > 2 * Static::Digit());
+  AssertSameAsStatic(SkipTo(Is("HTTP")) > Is("HTTP/") > Natural()
+        , Static::SkipTo(Static::Is("HTTP")) > Static::Is("HTTP/")
+        > Static::Natural());
+  AssertSameAsStatic(Any() > Is('x') > End()
+        , Static::Any() > Static::Is('x') > Static::End());
+
+  const char* text = "123ab";
+  ASSERT_EQ(Static::Match(+Static::Digit(), text), text + 3);
+  ASSERT_EQ(Static::Match(+Static::Alphabet(), text), (const char*)NULL);
+  ASSERT_TRUE(Static::Test(Static::Is(L"\x20AC") > Static::End()
+        , L"\x20AC"));
+  ASSERT_TRUE(Static::Test(Static::Is(u"\x20AC") > Static::End()
+        , u"\x20AC"));
+}
+
+TEST(Engine, TestAutomaton) {
+  vector<Rule> rules;
+  SameRules(&rules);
+  Rule own[] = { Literals(Is("GET") | Is("GETS") | Is("POST")) > End()
+        , (Is("abc") | Is('a')) > Is("bd"), *(Is("abc") | Is("ab")) > Is('x')
+        , +(Is('a') > ~Is('b')) > End(), LookAhead(Is("ab")) > Any()
+        , (Is("ab") > Any()) & LookAhead(Is("abc")), 3 * ~Is('a') > Is('b')
+        , Until(Is('a') > !Is('b')), *(Any() > Is('b')) > End()
+        , (Is('a') & !Is("ab")) > Is('a'), Is("ab") > Until(Is("ab"))
+        , Set("V") > (Is("ab") | Is('a')) > Is('c')
+        , (Is('a') || Is("ab")) > Is('c') };
+  rules.insert(rules.end(), own, own + sizeof(own) / sizeof(own[0]));
+
+  vector<string> inputs = SameInputs();
+  const char* fixed[] = { "GETS", "post", "GET / HTTP/1.1", "x12", "aaaa"
+        , "abd", "ababx", "abcabx", "abab", "aab", "abc", "abcd", "ac" };
+  inputs.insert(inputs.end(), fixed, fixed + sizeof(fixed) / sizeof(fixed[0]));
+  const char alphabet[] = "abcxAB.1: ";
+  unsigned int seed = 7;
+  for (size_t i = 0; i < 300; i++) {
+    string input;
+    for (size_t j = i % 13; j > 0; j--) {
+      seed = seed * 1103515245 + 12345;
+      input += alphabet[(seed >> 16) % (sizeof(alphabet) - 1)];
+    }
+    inputs.push_back(input);
+  }
+
+  for (size_t r = 0; r < rules.size(); r++)
+    AssertSameAsTree(rules[r], Determinize(rules[r]), inputs);
+
+  // only the regular part of a rule becomes an automaton
+  Rule whole = Determinize(own[1]);
+  ASSERT_EQ(whole.Get()->Type(), Core::VT_AUTOMATON);
+  ASSERT_EQ(Until(whole).Get()->Type(), Core::VT_AUTOMATON);
+  ASSERT_TRUE(Engine::AutomatonValidator::Regular(rules[0].Get()));
+  ASSERT_FALSE(Engine::AutomatonValidator::Regular(rules[2].Get()));
+  ASSERT_FALSE(Engine::AutomatonValidator::Regular(own[11].Get()));
+  Rule part = Determinize(own[11]);
+  const Core::NaryValidator* seq =
+        static_cast<const Core::NaryValidator*>(part.Get());
+  ASSERT_EQ(seq->Type(), Core::VT_SEQ);
+  ASSERT_EQ(seq->Count(), 3);
+  ASSERT_EQ(seq->GetOperand(1)->Type(), Core::VT_AUTOMATON);
+}
+
+TEST(Engine, TestAutomatonCache) {
+  Rule rule = IPv4() > End();
+  Engine::AutomatonValidator* automaton =
+        new Engine::AutomatonValidator(rule.Get());
+  Rule determinized(automaton);
+  ASSERT_EQ(automaton->States(false), 2);
+  ASSERT_TRUE(Actions::Test(determinized, "172.76.22.67"));
+  ASSERT_TRUE(Actions::Test(determinized, "10.0.0.1"));
+  size_t states = automaton->States(false);
+  ASSERT_GT(states, 2);
+  ASSERT_TRUE(Actions::Test(determinized, "172.76.22.67"));
+  ASSERT_EQ(automaton->States(false), states);
+  ASSERT_FALSE(automaton->Overflowed(false));
+  ASSERT_EQ(automaton->States(true), 2);
+  ASSERT_TRUE(StringozziW(determinized).Test(L"10.0.0.1"));
+  ASSERT_FALSE(StringozziW(determinized).Test(L"10.0.0.1a"));
+  ASSERT_EQ(StringozziW(Determinize(rule)).SearchAndGetPtr(L"ip 10.0.0.1")
+        , StringozziW(rule).SearchAndGetPtr(L"ip 10.0.0.1"));
+
+  // the tree is parsed once the states exceed the limit
+  Engine::AutomatonValidator* small =
+        new Engine::AutomatonValidator(rule.Get(), 4);
+  Rule limited(small);
+  ASSERT_TRUE(Actions::Test(limited, "172.76.22.67"));
+  ASSERT_TRUE(small->Overflowed(false));
+  ASSERT_TRUE(Actions::Test(limited, "10.0.0.1"));
+  ASSERT_FALSE(Actions::Test(limited, "10.0.0.256"));
+  ASSERT_EQ(small->States(false), 4);
+}
+
+TEST(Actions, TestLimits) {
+  ASSERT_EQ(StringozziA(Is("abc")).Test("abc", Limits(3)), ST_MATCHED);
+  ASSERT_EQ(StringozziA(Is("abc")).Test("abc", Limits(2)), ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Is("abc")).Test("abd", Limits(100)), ST_FAILED);
+  ASSERT_EQ(StringozziA(Is("abc")).Test("abc", Limits()), ST_MATCHED);
+  ASSERT_EQ(StringozziA(Is("abc")).Test(NULL, Limits()), ST_FAILED);
+
+  // every alternative parses the rest again .. 2^40 tries
+  Utils::PlaceHolder ph;
+  Rule inner = Ref(ph);
+  Rule nested = (Is('a') > inner > Is('c'))
+        | (Is('a') > inner > Is('d')) | Is('b');
+  ph.Inject(nested);
+  string text(40, 'a');
+  ASSERT_EQ(StringozziA(nested).Test(text.c_str(), Limits(100000))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Compile(nested)).Test(text.c_str(), Limits(100000))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(nested).Search(text.c_str(), Limits(100000))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(nested).Test(text.c_str(), Limits(100000)
+        , SPEG_MEMOIZE), ST_FAILED);
+  unsigned long started = Utils::Clock();
+  ASSERT_EQ(StringozziA(nested).Test(text.c_str(), Limits::Within(2000))
+        , ST_EXCEEDED);
+  ASSERT_LT(Utils::Clock() - started, 1000000UL);
+  ASSERT_EQ(StringozziA(nested).Test("aabcc", Limits::Within(1000000))
+        , ST_MATCHED);
+
+  // repeating an empty match takes a step each time
+  ASSERT_EQ(StringozziA(*Not(Is('x'))).Test("abc", Limits(1000))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Compile(*Not(Is('x')))).Test("abc", Limits(1000))
+        , ST_EXCEEDED);
+
+  // the halted cursor is out of the text and never moved back
+  string tail(64, 'b');
+  Rule behind = *Any() > LookBack(Is('a'));
+  ASSERT_EQ(StringozziA(behind).Test(tail.c_str(), Limits(1)), ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Compile(behind)).Test(tail.c_str(), Limits(1))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Compile(behind)).Test(tail.c_str(), Limits(1)
+        , SPEG_ITERATIVE), ST_EXCEEDED);
+
+  // the characters the scanners skip are counted
+  string haystack = string(1000, 'a') + "xyz";
+  ASSERT_EQ(StringozziA(Is("xyz")).Search(haystack.c_str(), Limits(100))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Determinize(Is("xy") > (Is('z') | Is("zz"))))
+        .Search(haystack.c_str(), Limits(100)), ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(+Is('a')).Test(haystack.c_str(), Limits(100))
+        , ST_EXCEEDED);
+  ASSERT_EQ(StringozziA(Is("xyz")).Search(haystack.c_str(), Limits(2000))
+        , ST_MATCHED);
+
+  MatchesA matches;
+  ASSERT_EQ(StringozziA(Is("Osama") >> "name").Match("1234Osama5", matches
+        , Limits(100)), ST_MATCHED);
+  ASSERT_EQ(matches.NumberOfMatches("name"), 1);
+  MatchesA none;
+  ASSERT_EQ(StringozziA(Is("Osama") >> "name").Match("1234Osama5", none
+        , Limits(6)), ST_EXCEEDED);
+  ASSERT_EQ(none.NumberOfMatches("name"), 0);
+
+  string replaced;
+  ASSERT_EQ(StringozziA(Is("Osama")).Replace("12OsamaOsama3", "l", &replaced
+        , Limits(100), 0, 2), ST_MATCHED);
+  ASSERT_STREQ(replaced.c_str(), "12ll3");
+  ASSERT_EQ(StringozziA(Is("Osama")).Replace("12OsamaOsama3", "l", &replaced
+        , Limits(8), 0, 2), ST_EXCEEDED);
+  ASSERT_STREQ(replaced.c_str(), "12ll3");
+
+  char csv[] = "a,b,,c";
+  vector<string> parts;
+  ASSERT_EQ(StringozziA(Is(',')).Split(csv, parts, Limits(100), 0, true, 3)
+        , ST_MATCHED);
+  ASSERT_EQ(parts.size(), 3);
+  ASSERT_STREQ(parts[2].c_str(), "c");
+  vector<string> cut;
+  ASSERT_EQ(StringozziA(Is(',')).Split(csv, cut, Limits(3), 0, true, 3)
+        , ST_EXCEEDED);
+  ASSERT_TRUE(cut.empty());
+}
 
 int main(int argc, char** argv) {
 	
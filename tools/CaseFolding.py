@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Writes include/Stringozzi.CaseFolding.h, the Unicode simple case folding
+(the C and S entries of CaseFolding.txt) of the Unicode version of the
+Python interpreter, as three lookup stages: the block of every 64 code
+points, the delta index of every code point of a block and the deltas.
+
+    python3 tools/CaseFolding.py > include/Stringozzi.CaseFolding.h
+"""
+import sys
+import unicodedata
+
+SHIFT = 6
+BLOCK = 1 << SHIFT
+
+
+def fold(code):
+    """the simple case folding of the code point"""
+    char = chr(code)
+    folded = char.casefold()
+    if len(folded) == 1:
+        return ord(folded)
+    # the full folding expands it, the simple one is its lower case if any
+    lower = char.lower()
+    return ord(lower) if len(lower) == 1 else code
+
+
+def tables():
+    folding = {}
+    for code in range(0x110000):
+        if 0xD800 <= code < 0xE000:
+            continue
+        folded = fold(code)
+        if folded != code:
+            folding[code] = folded
+    limit = (max(folding) // BLOCK + 1) * BLOCK
+
+    deltas = [0] + sorted(set(f - c for c, f in folding.items()))
+    index = dict((delta, i) for i, delta in enumerate(deltas))
+    # the block 0 folds nothing
+    blocks = {tuple([0] * BLOCK): 0}
+    stage1 = []
+    for start in range(0, limit, BLOCK):
+        block = tuple(index[folding.get(c, c) - c]
+                      for c in range(start, start + BLOCK))
+        stage1.append(blocks.setdefault(block, len(blocks)))
+    stage2 = []
+    for block, _ in sorted(blocks.items(), key=lambda item: item[1]):
+        stage2.extend(block)
+    assert len(blocks) < 256 and len(deltas) < 256
+    return limit, stage1, stage2, deltas
+
+
+def array(kind, name, values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]))
+    return ('  static const %s %s[] = {\n%s\n  };\n'
+            % (kind, name, ',\n'.join(lines)))
+
+
+def main():
+    limit, stage1, stage2, deltas = tables()
+    out = sys.stdout
+    out.write('// generated by tools/CaseFolding.py from Unicode %s, '
+              'do not edit\n' % unicodedata.unidata_version)
+    out.write('#ifndef INCLUDE_STRINGOZZI_CASEFOLDING_H_\n'
+              '#define INCLUDE_STRINGOZZI_CASEFOLDING_H_\n\n')
+    out.write('// the code points from SPEG_FOLDING_LIMIT on fold to '
+              'themselves\n')
+    out.write('#define SPEG_FOLDING_LIMIT 0x%XUL\n' % limit)
+    out.write('#define SPEG_FOLDING_SHIFT %d\n\n' % SHIFT)
+    out.write('namespace SPEG {\nnamespace Utils {\n\n')
+    out.write('// the block of every 2^SPEG_FOLDING_SHIFT code points, the '
+              'block 0 folds\n// nothing\n')
+    out.write('inline const unsigned char* FoldingBlocks() {\n')
+    out.write(array('unsigned char', 'blocks', stage1, 16))
+    out.write('  return blocks;\n}\n\n')
+    out.write('// the index of the delta of every code point of a block\n')
+    out.write('inline const unsigned char* FoldingIndexes() {\n')
+    out.write(array('unsigned char', 'indexes', stage2, 16))
+    out.write('  return indexes;\n}\n\n')
+    out.write('// added to a code point to fold it\n')
+    out.write('inline const long* FoldingDeltas() {\n')
+    out.write(array('long', 'deltas', deltas, 8))
+    out.write('  return deltas;\n}\n\n')
+    out.write('}  // namespace Utils\n}  // namespace SPEG\n\n'
+              '#endif  // INCLUDE_STRINGOZZI_CASEFOLDING_H_\n')
+
+
+if __name__ == '__main__':
+    main()
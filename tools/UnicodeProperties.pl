@@ -0,0 +1,108 @@
+#!/usr/bin/env perl
+# Writes src/Stringozzi.Properties.h, the ranges of the general categories,
+# the scripts and the White_Space property of the Unicode version of the
+# Perl interpreter (the Python one has no scripts), every range list as
+# the 16 bit deltas between its boundaries.
+#
+#     perl tools/UnicodeProperties.pl > src/Stringozzi.Properties.h
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invlist prop_values prop_value_aliases);
+
+my @CATEGORIES = qw(Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po
+    Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co Cn);
+
+my @deltas;
+
+# appends the boundaries of the property, returns its first delta and
+# the number of deltas
+sub ranges {
+  my @list = grep { $_ <= 0x110000 } prop_invlist(shift);
+  # the last range is open up to the end of the code points
+  push @list, 0x110000 if @list % 2;
+  my $first = @deltas;
+  my $previous = 0;
+  for my $boundary (@list) {
+    my $delta = $boundary - $previous;
+    while ($delta >= 0xFFFF) {
+      push @deltas, 0xFFFF;
+      $delta -= 0xFFFF;
+    }
+    push @deltas, $delta;
+    $previous = $boundary;
+  }
+  return ($first, @deltas - $first);
+}
+
+sub entry {
+  my ($name, $alias, $first, $count) = @_;
+  return sprintf('  {"%s", "%s", %d, %d}', $name, $alias, $first, $count);
+}
+
+my @categories;
+for my $category (@CATEGORIES) {
+  my (undef, $long) = prop_value_aliases('gc', $category);
+  push @categories, entry($category, $long, ranges("gc=$category"));
+}
+
+# Katakana_Or_Hiragana has no characters of its own
+my %names;
+for my $code (prop_values('sc')) {
+  my (undef, $long) = prop_value_aliases('sc', $code);
+  $names{$long} = $code if defined $long && prop_invlist("sc=$code");
+}
+my @scripts;
+for my $long (sort { lc($a) cmp lc($b) } keys %names) {
+  push @scripts, entry($long, $names{$long}, ranges("sc=$names{$long}"));
+}
+
+my $spaces = entry('White_Space', 'WSpace', ranges('White_Space'));
+
+my @lines;
+for (my $i = 0; $i < @deltas; $i += 12) {
+  my $last = $i + 11 < $#deltas ? $i + 11 : $#deltas;
+  push @lines, '  ' . join(', ', @deltas[$i .. $last]);
+}
+
+my $version = Unicode::UCD::UnicodeVersion();
+print <<"END";
+// generated by tools/UnicodeProperties.pl from Unicode $version, do not edit
+#ifndef SRC_STRINGOZZI_PROPERTIES_H_
+#define SRC_STRINGOZZI_PROPERTIES_H_
+
+namespace SPEG {
+namespace Utils {
+
+// a property value, the Count deltas of PropertyDeltas from First
+struct Property {
+  const char* Name;
+  const char* Alias;
+  unsigned int First;
+  unsigned int Count;
+};
+
+// the boundaries of the ranges, each one is the delta from the previous
+// one and they alternate between the first character of a range and the
+// character after it .. a delta of 0xFFFF adds up with the next one
+static const unsigned short PropertyDeltas[] = {
+@{[ join(",\n", @lines) ]}
+};
+
+// the general categories of two letters
+static const Property Categories[] = {
+@{[ join(",\n", @categories) ]}
+};
+
+// the scripts, sorted by name
+static const Property Scripts[] = {
+@{[ join(",\n", @scripts) ]}
+};
+
+static const Property WhiteSpaceProperty =
+$spaces;
+
+}  // namespace Utils
+}  // namespace SPEG
+
+#endif  // SRC_STRINGOZZI_PROPERTIES_H_
+END